@@ -26,29 +26,108 @@
 
 #include "Open3D/Geometry/Image.h"
 
-namespace {
-/// Isotropic 2D kernels are separable:
-/// two 1D kernels are applied in x and y direction.
-const std::vector<double> Gaussian3 = {0.25, 0.5, 0.25};
-const std::vector<double> Gaussian5 = {0.0625, 0.25, 0.375, 0.25, 0.0625};
-const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
-                                       0.21875, 0.109375, 0.03125};
-const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
-const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
-}  // unnamed namespace
+#include <algorithm>
+#include <utility>
+
+#include "Open3D/Geometry/ImageBufferPool.h"
+#include "Open3D/Geometry/ImageView.h"
 
 namespace open3d {
 namespace geometry {
 
+Image::Image(const Image &other)
+    : Geometry2D(Geometry::GeometryType::Image),
+      width_(other.width_),
+      height_(other.height_),
+      num_of_channels_(other.num_of_channels_),
+      bytes_per_channel_(other.bytes_per_channel_) {
+    CopyDataBuffer(other.data_);
+}
+
+Image::Image(Image &&other) noexcept
+    : Geometry2D(Geometry::GeometryType::Image),
+      width_(other.width_),
+      height_(other.height_),
+      num_of_channels_(other.num_of_channels_),
+      bytes_per_channel_(other.bytes_per_channel_),
+      data_(std::move(other.data_)) {
+    other.width_ = 0;
+    other.height_ = 0;
+    other.num_of_channels_ = 0;
+    other.bytes_per_channel_ = 0;
+    other.data_.clear();
+}
+
+Image &Image::operator=(const Image &other) {
+    if (this != &other) {
+        Geometry2D::operator=(other);
+        width_ = other.width_;
+        height_ = other.height_;
+        num_of_channels_ = other.num_of_channels_;
+        bytes_per_channel_ = other.bytes_per_channel_;
+        CopyDataBuffer(other.data_);
+    }
+    return *this;
+}
+
+Image &Image::operator=(Image &&other) noexcept {
+    if (this != &other) {
+        Geometry2D::operator=(other);
+        width_ = other.width_;
+        height_ = other.height_;
+        num_of_channels_ = other.num_of_channels_;
+        bytes_per_channel_ = other.bytes_per_channel_;
+        // the old buffer goes back to the pool before the other one is taken
+        if (!data_.empty() && ImageBufferPool::GetInstance().IsEnabled()) {
+            ImageBufferPool::GetInstance().Release(data_);
+        }
+        data_ = std::move(other.data_);
+        other.data_.clear();
+        other.width_ = 0;
+        other.height_ = 0;
+        other.num_of_channels_ = 0;
+        other.bytes_per_channel_ = 0;
+    }
+    return *this;
+}
+
+Image::~Image() {
+    if (!data_.empty() && ImageBufferPool::GetInstance().IsEnabled()) {
+        ImageBufferPool::GetInstance().Release(data_);
+    }
+}
+
 Image &Image::Clear() {
     width_ = 0;
     height_ = 0;
     num_of_channels_ = 0;
     bytes_per_channel_ = 0;
+    if (!data_.empty() && ImageBufferPool::GetInstance().IsEnabled()) {
+        ImageBufferPool::GetInstance().Release(data_);
+    }
     data_.clear();
     return *this;
 }
 
+void Image::ResizeDataBuffer(size_t num_bytes) {
+    ImageBufferPool &pool = ImageBufferPool::GetInstance();
+    if (data_.size() == num_bytes || !pool.IsEnabled()) {
+        data_.resize(num_bytes);
+    } else if (pool.Exchange(data_, num_bytes)) {
+        std::fill(data_.begin(), data_.end(), 0);
+    }
+}
+
+void Image::CopyDataBuffer(const std::vector<uint8_t> &data) {
+    ImageBufferPool &pool = ImageBufferPool::GetInstance();
+    if (data_.size() == data.size() || !pool.IsEnabled()) {
+        data_ = data;
+    } else {
+        pool.Exchange(data_, data.size());
+        std::copy(data.begin(), data.end(), data_.begin());
+    }
+}
+
 bool Image::IsEmpty() const { return !HasData(); }
 
 Eigen::Vector2d Image::GetMinBound() const { return Eigen::Vector2d(0.0, 0.0); }
@@ -105,16 +184,9 @@ template uint16_t *Image::PointerAt<uint16_t>(int u, int v, int ch) const;
 
 std::shared_ptr<Image> Image::ConvertDepthToFloatImage(
         double depth_scale /* = 1000.0*/, double depth_trunc /* = 3.0*/) const {
-    // don't need warning message about image type
-    // as we call CreateFloatImage
-    auto output = CreateFloatImage();
-    for (int y = 0; y < output->height_; y++) {
-        for (int x = 0; x < output->width_; x++) {
-            float *p = output->PointerAt<float>(x, y);
-            *p /= (float)depth_scale;
-            if (*p >= depth_trunc) *p = 0.0f;
-        }
-    }
+    auto output = std::make_shared<Image>();
+    ImageView(*this).ConvertDepthToFloatImage(*output, depth_scale,
+                                              depth_trunc);
     return output;
 }
 
@@ -147,30 +219,7 @@ Image &Image::LinearTransform(double scale, double offset /* = 0.0*/) {
 
 std::shared_ptr<Image> Image::Downsample() const {
     auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogError("[Downsample] Unsupported image format.");
-    }
-    int half_width = (int)floor((double)width_ / 2.0);
-    int half_height = (int)floor((double)height_ / 2.0);
-    output->Prepare(half_width, half_height, 1, 4);
-
-#ifdef _OPENMP
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-#endif
-    for (int y = 0; y < output->height_; y++) {
-        for (int x = 0; x < output->width_; x++) {
-            float *p1 = PointerAt<float>(x * 2, y * 2);
-            float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
-            float *p3 = PointerAt<float>(x * 2, y * 2 + 1);
-            float *p4 = PointerAt<float>(x * 2 + 1, y * 2 + 1);
-            float *p = output->PointerAt<float>(x, y);
-            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
-        }
-    }
+    ImageView(*this).Downsample(*output);
     return output;
 }
 
@@ -213,30 +262,7 @@ std::shared_ptr<Image> Image::FilterHorizontal(
 
 std::shared_ptr<Image> Image::Filter(Image::FilterType type) const {
     auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogError("[Filter] Unsupported image format.");
-    }
-
-    switch (type) {
-        case Image::FilterType::Gaussian3:
-            output = Filter(Gaussian3, Gaussian3);
-            break;
-        case Image::FilterType::Gaussian5:
-            output = Filter(Gaussian5, Gaussian5);
-            break;
-        case Image::FilterType::Gaussian7:
-            output = Filter(Gaussian7, Gaussian7);
-            break;
-        case Image::FilterType::Sobel3Dx:
-            output = Filter(Sobel31, Sobel32);
-            break;
-        case Image::FilterType::Sobel3Dy:
-            output = Filter(Sobel32, Sobel31);
-            break;
-        default:
-            utility::LogError("[Filter] Unsupported filter type.");
-            break;
-    }
+    ImageView(*this).Filter(*output, type);
     return output;
 }
 
@@ -253,85 +279,74 @@ ImagePyramid Image::FilterPyramid(const ImagePyramid &input,
 std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
                                      const std::vector<double> &dy) const {
     auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogError("[Filter] Unsupported image format.");
-    }
+    ImageView(*this).Filter(*output, dx, dy);
+    return output;
+}
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Transpose();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Transpose();
-    return temp4;
+std::pair<std::shared_ptr<Image>, std::shared_ptr<Image>> Image::FilterSobel()
+        const {
+    auto output_dx = std::make_shared<Image>();
+    auto output_dy = std::make_shared<Image>();
+    ImageView(*this).FilterSobel(*output_dx, *output_dy);
+    return std::make_pair(output_dx, output_dy);
 }
 
-std::shared_ptr<Image> Image::Transpose() const {
+std::shared_ptr<Image> Image::FilterAndDownsample(
+        Image::FilterType type) const {
     auto output = std::make_shared<Image>();
-    output->Prepare(height_, width_, num_of_channels_, bytes_per_channel_);
+    ImageView(*this).FilterAndDownsample(*output, type);
+    return output;
+}
 
-    int out_bytes_per_line = output->BytesPerLine();
-    int in_bytes_per_line = BytesPerLine();
-    int bytes_per_pixel = num_of_channels_ * bytes_per_channel_;
+std::shared_ptr<Image> Image::FilterBilateral(int half_kernel_size,
+                                              double sigma_space,
+                                              double sigma_depth) const {
+    auto output = std::make_shared<Image>();
+    ImageView(*this).FilterBilateral(*output, half_kernel_size, sigma_space,
+                                     sigma_depth);
+    return output;
+}
 
-#ifdef _OPENMP
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-#endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            std::copy(
-                    data_.data() + y * in_bytes_per_line + x * bytes_per_pixel,
-                    data_.data() + y * in_bytes_per_line +
-                            (x + 1) * bytes_per_pixel,
-                    output->data_.data() + x * out_bytes_per_line +
-                            y * bytes_per_pixel);
-        }
+std::shared_ptr<Image> Image::FilterJointBilateral(const Image &guide,
+                                                   int half_kernel_size,
+                                                   double sigma_space,
+                                                   double sigma_color) const {
+    auto output = std::make_shared<Image>();
+    if (guide.num_of_channels_ != 1 || guide.bytes_per_channel_ != 4) {
+        auto guide_f = guide.CreateFloatImage();
+        ImageView(*this).FilterJointBilateral(*output, ImageView(*guide_f),
+                                              half_kernel_size, sigma_space,
+                                              sigma_color);
+    } else {
+        ImageView(*this).FilterJointBilateral(*output, ImageView(guide),
+                                              half_kernel_size, sigma_space,
+                                              sigma_color);
     }
+    return output;
+}
 
+std::shared_ptr<Image> Image::FilterMedian(
+        int half_kernel_size /* = 1 */) const {
+    auto output = std::make_shared<Image>();
+    ImageView(*this).FilterMedian(*output, half_kernel_size);
     return output;
 }
 
-std::shared_ptr<Image> Image::FlipVertical() const {
+std::shared_ptr<Image> Image::Transpose() const {
     auto output = std::make_shared<Image>();
-    output->Prepare(width_, height_, num_of_channels_, bytes_per_channel_);
+    ImageView(*this).Transpose(*output);
+    return output;
+}
 
-    int bytes_per_line = BytesPerLine();
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
-        std::copy(data_.data() + y * bytes_per_line,
-                  data_.data() + (y + 1) * bytes_per_line,
-                  output->data_.data() + (height_ - y - 1) * bytes_per_line);
-    }
+std::shared_ptr<Image> Image::FlipVertical() const {
+    auto output = std::make_shared<Image>();
+    ImageView(*this).FlipVertical(*output);
     return output;
 }
 
 std::shared_ptr<Image> Image::FlipHorizontal() const {
     auto output = std::make_shared<Image>();
-    output->Prepare(width_, height_, num_of_channels_, bytes_per_channel_);
-
-    int bytes_per_line = BytesPerLine();
-    int bytes_per_pixel = num_of_channels_ * bytes_per_channel_;
-#ifdef _OPENMP
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-#endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            std::copy(data_.data() + y * bytes_per_line + x * bytes_per_pixel,
-                      data_.data() + y * bytes_per_line +
-                              (x + 1) * bytes_per_pixel,
-                      output->data_.data() + y * bytes_per_line +
-                              (width_ - x - 1) * bytes_per_pixel);
-        }
-    }
-
+    ImageView(*this).FlipHorizontal(*output);
     return output;
 }
 
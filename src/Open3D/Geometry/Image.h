@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "Open3D/Geometry/Geometry2D.h"
@@ -85,7 +86,11 @@ public:
 public:
     /// \brief Default Constructor.
     Image() : Geometry2D(Geometry::GeometryType::Image) {}
-    ~Image() override {}
+    Image(const Image &other);
+    Image(Image &&other) noexcept;
+    Image &operator=(const Image &other);
+    Image &operator=(Image &&other) noexcept;
+    ~Image() override;
 
 public:
     Image &Clear() override;
@@ -111,6 +116,8 @@ public:
     }
 
     /// \brief Prepare Image properties and allocate Image buffer.
+    ///
+    /// The buffer is reused if its size does not change.
     Image &Prepare(int width,
                    int height,
                    int num_of_channels,
@@ -179,9 +186,60 @@ public:
     std::shared_ptr<Image> FilterHorizontal(
             const std::vector<double> &kernel) const;
 
+    /// Function to compute the Sobel3Dx and Sobel3Dy filtered images in a
+    /// single pass.
+    ///
+    /// \return The x-gradient and the y-gradient image.
+    std::pair<std::shared_ptr<Image>, std::shared_ptr<Image>> FilterSobel()
+            const;
+
     /// Function to 2x image downsample using simple 2x2 averaging.
     std::shared_ptr<Image> Downsample() const;
 
+    /// Function to filter and 2x downsample an image in a single pass, gives
+    /// the same result as Filter(type) followed by Downsample().
+    std::shared_ptr<Image> FilterAndDownsample(Image::FilterType type) const;
+
+    /// \brief Function to filter a float depth image with a bilateral filter.
+    ///
+    /// Every valid pixel is replaced by the average of the valid pixels in
+    /// its (2 * half_kernel_size + 1)^2 neighborhood, weighted by a Gaussian
+    /// of their distance in pixels and a Gaussian of their depth difference.
+    /// Pixels with depth <= 0 or NaN are invalid and are kept as they are.
+    ///
+    /// \param half_kernel_size Radius of the filter window.
+    /// \param sigma_space Standard deviation of the spatial weight in pixels.
+    /// \param sigma_depth Standard deviation of the depth weight.
+    std::shared_ptr<Image> FilterBilateral(int half_kernel_size,
+                                           double sigma_space,
+                                           double sigma_depth) const;
+
+    /// \brief Function to filter a float depth image with a bilateral filter
+    /// guided by a color image.
+    ///
+    /// Like FilterBilateral, but the range weight is a Gaussian of the
+    /// intensity difference in guide. Invalid pixels are filled from the
+    /// valid pixels of their neighborhood, pixels without valid neighbors
+    /// are kept.
+    ///
+    /// \param guide Color or intensity image of the same size, it is
+    /// converted like CreateFloatImage.
+    /// \param half_kernel_size Radius of the filter window.
+    /// \param sigma_space Standard deviation of the spatial weight in pixels.
+    /// \param sigma_color Standard deviation of the intensity weight.
+    std::shared_ptr<Image> FilterJointBilateral(const Image &guide,
+                                                int half_kernel_size,
+                                                double sigma_space,
+                                                double sigma_color) const;
+
+    /// \brief Function to filter a float depth image with a median filter.
+    ///
+    /// Every pixel is replaced by the median of the valid pixels (depth > 0)
+    /// in its (2 * half_kernel_size + 1)^2 neighborhood, which also fills
+    /// holes smaller than the window. Pixels without valid neighbors are
+    /// kept.
+    std::shared_ptr<Image> FilterMedian(int half_kernel_size = 1) const;
+
     /// Function to dilate 8bit mask map.
     std::shared_ptr<Image> Dilate(int half_kernel_size = 1) const;
 
@@ -216,9 +274,18 @@ public:
 
 protected:
     void AllocateDataBuffer() {
-        data_.resize(width_ * height_ * num_of_channels_ * bytes_per_channel_);
+        ResizeDataBuffer((size_t)width_ * height_ * num_of_channels_ *
+                         bytes_per_channel_);
     }
 
+    /// Resizes the buffer like std::vector::resize. If pooling is enabled
+    /// (see ImageBufferPool) and the size changes, the buffer is exchanged
+    /// through the pool and zero filled.
+    void ResizeDataBuffer(size_t num_bytes);
+
+    /// Copies data into the buffer, through the pool if the size changes.
+    void CopyDataBuffer(const std::vector<uint8_t> &data);
+
 public:
     /// Width of the image.
     int width_ = 0;
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ImageBufferPool.h"
+
+#include <iterator>
+
+namespace open3d {
+namespace geometry {
+
+ImageBufferPool &ImageBufferPool::GetInstance() {
+    // Never destroyed, images may be released during static destruction.
+    static ImageBufferPool *instance = new ImageBufferPool();
+    return *instance;
+}
+
+void ImageBufferPool::SetEnabled(bool enabled) {
+    enabled_ = enabled;
+    if (!enabled) {
+        Clear();
+    }
+}
+
+void ImageBufferPool::SetMaxCachedBytes(size_t max_cached_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_cached_bytes_ = max_cached_bytes;
+    // drop buffers until the cache fits
+    for (auto it = buffers_.begin();
+         it != buffers_.end() && cached_bytes_ > max_cached_bytes_;) {
+        while (!it->second.empty() && cached_bytes_ > max_cached_bytes_) {
+            it->second.pop_back();
+            cached_bytes_ -= it->first;
+            num_cached_buffers_--;
+        }
+        it = it->second.empty() ? buffers_.erase(it) : std::next(it);
+    }
+}
+
+size_t ImageBufferPool::GetMaxCachedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_cached_bytes_;
+}
+
+bool ImageBufferPool::Exchange(std::vector<uint8_t> &buffer,
+                               size_t num_bytes) {
+    std::vector<uint8_t> cached;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ReleaseLocked(buffer);
+        auto it = buffers_.find(num_bytes);
+        if (it != buffers_.end()) {
+            cached = std::move(it->second.back());
+            it->second.pop_back();
+            if (it->second.empty()) {
+                buffers_.erase(it);
+            }
+            cached_bytes_ -= num_bytes;
+            num_cached_buffers_--;
+            num_reused_++;
+        } else if (num_bytes > 0) {
+            num_allocated_++;
+        }
+    }
+    if (cached.empty()) {
+        buffer.resize(num_bytes);
+        return false;
+    }
+    buffer.swap(cached);
+    return true;
+}
+
+void ImageBufferPool::Release(std::vector<uint8_t> &buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ReleaseLocked(buffer);
+}
+
+void ImageBufferPool::ReleaseLocked(std::vector<uint8_t> &buffer) {
+    const size_t num_bytes = buffer.size();
+    if (num_bytes > 0 && cached_bytes_ + num_bytes <= max_cached_bytes_) {
+        buffers_[num_bytes].push_back(std::move(buffer));
+        cached_bytes_ += num_bytes;
+        num_cached_buffers_++;
+    }
+    std::vector<uint8_t>().swap(buffer);
+}
+
+void ImageBufferPool::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffers_.clear();
+    cached_bytes_ = 0;
+    num_cached_buffers_ = 0;
+}
+
+size_t ImageBufferPool::GetNumCachedBuffers() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_cached_buffers_;
+}
+
+size_t ImageBufferPool::GetCachedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+}
+
+size_t ImageBufferPool::GetNumReused() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_reused_;
+}
+
+size_t ImageBufferPool::GetNumAllocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_allocated_;
+}
+
+void ImageBufferPool::ResetStatistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_reused_ = 0;
+    num_allocated_ = 0;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class ImageBufferPool
+///
+/// \brief Process wide cache of Image pixel buffers.
+///
+/// Pipelines like RGBD odometry and TSDF integration create many temporary
+/// images of the same few shapes for every frame. When the pool is enabled,
+/// Image returns its buffer to the pool when it is destroyed, cleared or
+/// resized, and Image::Prepare takes a cached buffer of the same size
+/// instead of allocating a new one. Buffers are matched by their size in
+/// bytes, which is all that matters for reusing an allocation.
+///
+/// The pool is disabled by default and is safe to use from multiple threads.
+class ImageBufferPool {
+public:
+    ImageBufferPool(ImageBufferPool const &) = delete;
+    void operator=(ImageBufferPool const &) = delete;
+
+    static ImageBufferPool &GetInstance();
+
+public:
+    /// \brief Enables or disables pooling. Disabling the pool releases all
+    /// cached buffers.
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return enabled_; }
+
+    /// \brief Sets the maximum number of bytes kept in the pool, buffers
+    /// released beyond the limit are freed.
+    void SetMaxCachedBytes(size_t max_cached_bytes);
+    size_t GetMaxCachedBytes() const;
+
+    /// \brief Replaces buffer by a buffer of num_bytes bytes, buffer itself
+    /// is returned to the pool. Returns `true` if a cached buffer was reused,
+    /// its content is left unspecified, otherwise the buffer is zero filled.
+    bool Exchange(std::vector<uint8_t> &buffer, size_t num_bytes);
+
+    /// \brief Returns buffer to the pool, buffer is left empty.
+    void Release(std::vector<uint8_t> &buffer);
+
+    /// Frees all cached buffers.
+    void Clear();
+
+    /// Returns the number of cached buffers.
+    size_t GetNumCachedBuffers() const;
+    /// Returns the number of bytes held by the cached buffers.
+    size_t GetCachedBytes() const;
+    /// Returns the number of buffers served from the pool.
+    size_t GetNumReused() const;
+    /// Returns the number of buffers the pool had to allocate.
+    size_t GetNumAllocated() const;
+    /// Resets the reuse and allocation counters.
+    void ResetStatistics();
+
+private:
+    ImageBufferPool() {}
+
+    /// Caches buffer, requires mutex_ to be held.
+    void ReleaseLocked(std::vector<uint8_t> &buffer);
+
+private:
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_;
+    /// Cached buffers by size in bytes.
+    std::unordered_map<size_t, std::vector<std::vector<uint8_t>>> buffers_;
+    size_t num_cached_buffers_ = 0;
+    size_t cached_bytes_ = 0;
+    size_t max_cached_bytes_ = size_t(256) << 20;
+    size_t num_reused_ = 0;
+    size_t num_allocated_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImageView.h"
 
 namespace open3d {
 namespace geometry {
@@ -63,59 +64,7 @@ std::shared_ptr<Image> Image::CreateDepthToCameraDistanceMultiplierFloatImage(
 std::shared_ptr<Image> Image::CreateFloatImage(
         Image::ColorToIntensityConversionType type /* = WEIGHTED*/) const {
     auto fimage = std::make_shared<Image>();
-    if (IsEmpty()) {
-        return fimage;
-    }
-    fimage->Prepare(width_, height_, 1, 4);
-    for (int i = 0; i < height_ * width_; i++) {
-        float *p = (float *)(fimage->data_.data() + i * 4);
-        const uint8_t *pi =
-                data_.data() + i * num_of_channels_ * bytes_per_channel_;
-        if (num_of_channels_ == 1) {
-            // grayscale image
-            if (bytes_per_channel_ == 1) {
-                *p = (float)(*pi) / 255.0f;
-            } else if (bytes_per_channel_ == 2) {
-                const uint16_t *pi16 = (const uint16_t *)pi;
-                *p = (float)(*pi16);
-            } else if (bytes_per_channel_ == 4) {
-                const float *pf = (const float *)pi;
-                *p = *pf;
-            }
-        } else if (num_of_channels_ == 3) {
-            if (bytes_per_channel_ == 1) {
-                if (type == Image::ColorToIntensityConversionType::Equal) {
-                    *p = ((float)(pi[0]) + (float)(pi[1]) + (float)(pi[2])) /
-                         3.0f / 255.0f;
-                } else if (type ==
-                           Image::ColorToIntensityConversionType::Weighted) {
-                    *p = (0.2990f * (float)(pi[0]) + 0.5870f * (float)(pi[1]) +
-                          0.1140f * (float)(pi[2])) /
-                         255.0f;
-                }
-            } else if (bytes_per_channel_ == 2) {
-                const uint16_t *pi16 = (const uint16_t *)pi;
-                if (type == Image::ColorToIntensityConversionType::Equal) {
-                    *p = ((float)(pi16[0]) + (float)(pi16[1]) +
-                          (float)(pi16[2])) /
-                         3.0f;
-                } else if (type ==
-                           Image::ColorToIntensityConversionType::Weighted) {
-                    *p = (0.2990f * (float)(pi16[0]) +
-                          0.5870f * (float)(pi16[1]) +
-                          0.1140f * (float)(pi16[2]));
-                }
-            } else if (bytes_per_channel_ == 4) {
-                const float *pf = (const float *)pi;
-                if (type == Image::ColorToIntensityConversionType::Equal) {
-                    *p = (pf[0] + pf[1] + pf[2]) / 3.0f;
-                } else if (type ==
-                           Image::ColorToIntensityConversionType::Weighted) {
-                    *p = (0.2990f * pf[0] + 0.5870f * pf[1] + 0.1140f * pf[2]);
-                }
-            }
-        }
-    }
+    ImageView(*this).CreateFloatImage(*fimage, type);
     return fimage;
 }
 
@@ -158,9 +107,8 @@ ImagePyramid Image::CreatePyramid(size_t num_of_levels,
         } else {
             if (with_gaussian_filter) {
                 // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
-                auto level_b = pyramid_image[i - 1]->Filter(
+                auto level_bd = pyramid_image[i - 1]->FilterAndDownsample(
                         Image::FilterType::Gaussian3);
-                auto level_bd = level_b->Downsample();
                 pyramid_image.push_back(level_bd);
             } else {
                 auto level_d = pyramid_image[i - 1]->Downsample();
@@ -0,0 +1,759 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/ImageView.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+using open3d::geometry::Image;
+using open3d::geometry::ImageView;
+
+/// Isotropic 2D kernels are separable:
+/// two 1D kernels are applied in x and y direction.
+const std::vector<double> Gaussian3 = {0.25, 0.5, 0.25};
+const std::vector<double> Gaussian5 = {0.0625, 0.25, 0.375, 0.25, 0.0625};
+const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
+                                       0.21875, 0.109375, 0.03125};
+const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
+const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+/// Separable filters process the image in blocks of rows. A block filters
+/// the input rows it depends on horizontally into a small buffer, the
+/// vertical pass reads from that buffer and writes the output rows. The
+/// blocks are independent and the buffers stay in cache.
+const int kFilterBlockRows = 32;
+
+const std::vector<double> &GetSeparableKernel(Image::FilterType type,
+                                              bool vertical) {
+    switch (type) {
+        case Image::FilterType::Gaussian3:
+            return Gaussian3;
+        case Image::FilterType::Gaussian5:
+            return Gaussian5;
+        case Image::FilterType::Gaussian7:
+            return Gaussian7;
+        case Image::FilterType::Sobel3Dx:
+            return vertical ? Sobel32 : Sobel31;
+        case Image::FilterType::Sobel3Dy:
+            return vertical ? Sobel31 : Sobel32;
+        default:
+            open3d::utility::LogError("[Filter] Unsupported filter type.");
+            return Gaussian3;
+    }
+}
+
+std::vector<float> ToFloatKernel(const std::vector<double> &kernel) {
+    if (kernel.size() % 2 != 1) {
+        open3d::utility::LogError("[Filter] Unsupported kernel size.");
+    }
+    return std::vector<float>(kernel.begin(), kernel.end());
+}
+
+/// Prepares output for the result of an operator on input. The output buffer
+/// is reused if its size does not change, so it must not hold the input.
+void PrepareOutput(const ImageView &input,
+                   Image &output,
+                   int width,
+                   int height,
+                   int num_of_channels,
+                   int bytes_per_channel,
+                   const char *name) {
+    const uint8_t *begin = output.data_.data();
+    const uint8_t *end = begin + output.data_.size();
+    if (!input.IsEmpty() && input.data_ >= begin && input.data_ < end) {
+        open3d::utility::LogError(
+                "[{}] The output image must not alias the input.", name);
+    }
+    output.Prepare(width, height, num_of_channels, bytes_per_channel);
+}
+
+void CheckFloatImage(const ImageView &input, const char *name) {
+    if (input.num_of_channels_ != 1 || input.bytes_per_channel_ != 4) {
+        open3d::utility::LogError("[{}] Unsupported image format.", name);
+    }
+}
+
+/// Copies row y of a single channel float image to padded_row and replicates
+/// the border pixels half_size times on both sides.
+void PadRow(const ImageView &input, int y, int half_size, float *padded_row) {
+    const float *row = input.RowAt<float>(y);
+    std::fill(padded_row, padded_row + half_size, row[0]);
+    std::copy(row, row + input.width_, padded_row + half_size);
+    std::fill(padded_row + half_size + input.width_,
+              padded_row + 2 * half_size + input.width_,
+              row[input.width_ - 1]);
+}
+
+/// Filters a padded row (see PadRow) of the given width with kernel. The
+/// products are accumulated in double in kernel order, which gives the same
+/// results as Image::FilterHorizontal.
+void FilterPaddedRow(const float *padded_row,
+                     int width,
+                     const std::vector<float> &kernel,
+                     double *accumulator,
+                     float *output) {
+    std::fill(accumulator, accumulator + width, 0.0);
+    for (size_t i = 0; i < kernel.size(); i++) {
+        const float weight = kernel[i];
+        const float *shifted = padded_row + i;
+        for (int x = 0; x < width; x++) {
+            accumulator[x] += shifted[x] * weight;
+        }
+    }
+    for (int x = 0; x < width; x++) {
+        output[x] = (float)accumulator[x];
+    }
+}
+
+/// Filters row y vertically with kernel. The buffer holds the horizontally
+/// filtered rows starting at buffer_begin, rows outside the image are clamped
+/// to the border.
+void FilterBufferedColumn(const float *buffer,
+                          int buffer_begin,
+                          int width,
+                          int height,
+                          const std::vector<float> &kernel,
+                          int y,
+                          double *accumulator,
+                          float *output) {
+    const int half_size = (int)kernel.size() / 2;
+    std::fill(accumulator, accumulator + width, 0.0);
+    for (int i = -half_size; i <= half_size; i++) {
+        const int y_shift = std::min(std::max(y + i, 0), height - 1);
+        const float weight = kernel[i + half_size];
+        const float *row = buffer + (size_t)(y_shift - buffer_begin) * width;
+        for (int x = 0; x < width; x++) {
+            accumulator[x] += row[x] * weight;
+        }
+    }
+    for (int x = 0; x < width; x++) {
+        output[x] = (float)accumulator[x];
+    }
+}
+
+/// Horizontally filters the rows [row_begin, row_end) into buffer.
+void FilterRowsHorizontal(const ImageView &input,
+                          const std::vector<float> &kernel,
+                          int row_begin,
+                          int row_end,
+                          std::vector<float> &padded_row,
+                          std::vector<double> &accumulator,
+                          float *buffer) {
+    const int half_size = (int)kernel.size() / 2;
+    padded_row.resize(input.width_ + 2 * half_size);
+    for (int y = row_begin; y < row_end; y++) {
+        PadRow(input, y, half_size, padded_row.data());
+        FilterPaddedRow(padded_row.data(), input.width_, kernel,
+                        accumulator.data(),
+                        buffer + (size_t)(y - row_begin) * input.width_);
+    }
+}
+
+/// Spatial weights of a (2 * half_size + 1)^2 window, row by row.
+std::vector<float> GetSpatialWeights(int half_size, double sigma_space) {
+    const int size = 2 * half_size + 1;
+    std::vector<float> weights(size * size);
+    for (int dy = -half_size; dy <= half_size; dy++) {
+        for (int dx = -half_size; dx <= half_size; dx++) {
+            weights[(dy + half_size) * size + dx + half_size] = (float)std::exp(
+                    -(dx * dx + dy * dy) / (2.0 * sigma_space * sigma_space));
+        }
+    }
+    return weights;
+}
+
+void CheckBilateralParameters(int half_kernel_size,
+                              double sigma_space,
+                              double sigma_range,
+                              const char *name) {
+    if (half_kernel_size < 0 || sigma_space <= 0 || sigma_range <= 0) {
+        open3d::utility::LogError("[{}] Invalid filter parameters.", name);
+    }
+}
+
+/// Depth values <= 0 and NaN mark missing measurements.
+inline bool IsValidDepth(float d) { return d > 0; }
+
+}  // unnamed namespace
+
+namespace open3d {
+namespace geometry {
+
+ImageView::ImageView(const Image &image)
+    : data_(image.data_.data()),
+      width_(image.width_),
+      height_(image.height_),
+      num_of_channels_(image.num_of_channels_),
+      bytes_per_channel_(image.bytes_per_channel_),
+      stride_(image.BytesPerLine()) {}
+
+ImageView::ImageView(const uint8_t *data,
+                     int width,
+                     int height,
+                     int num_of_channels,
+                     int bytes_per_channel,
+                     int stride /* = 0*/)
+    : data_(data),
+      width_(width),
+      height_(height),
+      num_of_channels_(num_of_channels),
+      bytes_per_channel_(bytes_per_channel),
+      stride_(stride) {
+    if (width < 0 || height < 0 || num_of_channels < 0 ||
+        bytes_per_channel < 0) {
+        utility::LogError("[ImageView] Invalid image dimensions.");
+    }
+    if (stride_ == 0) {
+        stride_ = BytesPerPixel() * width;
+    } else if (stride_ < BytesPerPixel() * width) {
+        utility::LogError("[ImageView] Stride {} is smaller than a row.",
+                          stride);
+    }
+}
+
+ImageView::ImageView(uint8_t *data,
+                     int width,
+                     int height,
+                     int num_of_channels,
+                     int bytes_per_channel,
+                     int stride,
+                     ReleaseCallback release)
+    : ImageView(data,
+                width,
+                height,
+                num_of_channels,
+                bytes_per_channel,
+                stride) {
+    if (release) {
+        buffer_ = std::shared_ptr<uint8_t>(data, release);
+    }
+}
+
+ImageView ImageView::Crop(int u, int v, int width, int height) const {
+    if (u < 0 || v < 0 || width < 0 || height < 0 || u + width > width_ ||
+        v + height > height_) {
+        utility::LogError(
+                "[Crop] Region ({}, {}, {}, {}) is outside of the {} x {} "
+                "view.",
+                u, v, width, height, width_, height_);
+    }
+    ImageView view(*this);
+    view.data_ = PointerAt<uint8_t>(u, v);
+    view.width_ = width;
+    view.height_ = height;
+    return view;
+}
+
+void ImageView::CopyTo(Image &output) const {
+    PrepareOutput(*this, output, width_, height_, num_of_channels_,
+                  bytes_per_channel_, "CopyTo");
+    const int bytes_per_line = output.BytesPerLine();
+    for (int y = 0; y < height_; y++) {
+        const uint8_t *row = RowAt<uint8_t>(y);
+        std::copy(row, row + bytes_per_line,
+                  output.data_.data() + (size_t)y * bytes_per_line);
+    }
+}
+
+void ImageView::CreateFloatImage(
+        Image &output,
+        Image::ColorToIntensityConversionType type /* = WEIGHTED*/) const {
+    if (IsEmpty()) {
+        output.Clear();
+        return;
+    }
+    PrepareOutput(*this, output, width_, height_, 1, 4, "CreateFloatImage");
+    for (int y = 0; y < height_; y++) {
+        float *p = output.PointerAt<float>(0, y);
+        const uint8_t *pi = RowAt<uint8_t>(y);
+        for (int x = 0; x < width_; x++, p++, pi += BytesPerPixel()) {
+            if (num_of_channels_ == 1) {
+                // grayscale image
+                if (bytes_per_channel_ == 1) {
+                    *p = (float)(*pi) / 255.0f;
+                } else if (bytes_per_channel_ == 2) {
+                    const uint16_t *pi16 = (const uint16_t *)pi;
+                    *p = (float)(*pi16);
+                } else if (bytes_per_channel_ == 4) {
+                    const float *pf = (const float *)pi;
+                    *p = *pf;
+                }
+            } else if (num_of_channels_ == 3) {
+                if (bytes_per_channel_ == 1) {
+                    if (type == Image::ColorToIntensityConversionType::Equal) {
+                        *p = ((float)(pi[0]) + (float)(pi[1]) +
+                              (float)(pi[2])) /
+                             3.0f / 255.0f;
+                    } else if (type == Image::ColorToIntensityConversionType::
+                                               Weighted) {
+                        *p = (0.2990f * (float)(pi[0]) +
+                              0.5870f * (float)(pi[1]) +
+                              0.1140f * (float)(pi[2])) /
+                             255.0f;
+                    }
+                } else if (bytes_per_channel_ == 2) {
+                    const uint16_t *pi16 = (const uint16_t *)pi;
+                    if (type == Image::ColorToIntensityConversionType::Equal) {
+                        *p = ((float)(pi16[0]) + (float)(pi16[1]) +
+                              (float)(pi16[2])) /
+                             3.0f;
+                    } else if (type == Image::ColorToIntensityConversionType::
+                                               Weighted) {
+                        *p = (0.2990f * (float)(pi16[0]) +
+                              0.5870f * (float)(pi16[1]) +
+                              0.1140f * (float)(pi16[2]));
+                    }
+                } else if (bytes_per_channel_ == 4) {
+                    const float *pf = (const float *)pi;
+                    if (type == Image::ColorToIntensityConversionType::Equal) {
+                        *p = (pf[0] + pf[1] + pf[2]) / 3.0f;
+                    } else if (type == Image::ColorToIntensityConversionType::
+                                               Weighted) {
+                        *p = (0.2990f * pf[0] + 0.5870f * pf[1] +
+                              0.1140f * pf[2]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ImageView::ConvertDepthToFloatImage(
+        Image &output,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 3.0*/) const {
+    // don't need warning message about image type
+    // as we call CreateFloatImage
+    CreateFloatImage(output);
+    for (int y = 0; y < output.height_; y++) {
+        for (int x = 0; x < output.width_; x++) {
+            float *p = output.PointerAt<float>(x, y);
+            *p /= (float)depth_scale;
+            if (*p >= depth_trunc) *p = 0.0f;
+        }
+    }
+}
+
+void ImageView::Transpose(Image &output) const {
+    PrepareOutput(*this, output, height_, width_, num_of_channels_,
+                  bytes_per_channel_, "Transpose");
+
+    int out_bytes_per_line = output.BytesPerLine();
+    int bytes_per_pixel = BytesPerPixel();
+
+#ifdef _OPENMP
+#ifdef _WIN32
+#pragma omp parallel for schedule(static)
+#else
+#pragma omp parallel for collapse(2) schedule(static)
+#endif
+#endif
+    for (int y = 0; y < height_; y++) {
+        for (int x = 0; x < width_; x++) {
+            const uint8_t *pi = PointerAt<uint8_t>(x, y);
+            std::copy(pi, pi + bytes_per_pixel,
+                      output.data_.data() + x * out_bytes_per_line +
+                              y * bytes_per_pixel);
+        }
+    }
+}
+
+void ImageView::FlipVertical(Image &output) const {
+    PrepareOutput(*this, output, width_, height_, num_of_channels_,
+                  bytes_per_channel_, "FlipVertical");
+
+    int bytes_per_line = output.BytesPerLine();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < height_; y++) {
+        const uint8_t *row = RowAt<uint8_t>(y);
+        std::copy(row, row + bytes_per_line,
+                  output.data_.data() + (height_ - y - 1) * bytes_per_line);
+    }
+}
+
+void ImageView::FlipHorizontal(Image &output) const {
+    PrepareOutput(*this, output, width_, height_, num_of_channels_,
+                  bytes_per_channel_, "FlipHorizontal");
+
+    int bytes_per_line = output.BytesPerLine();
+    int bytes_per_pixel = BytesPerPixel();
+#ifdef _OPENMP
+#ifdef _WIN32
+#pragma omp parallel for schedule(static)
+#else
+#pragma omp parallel for collapse(2) schedule(static)
+#endif
+#endif
+    for (int y = 0; y < height_; y++) {
+        for (int x = 0; x < width_; x++) {
+            const uint8_t *pi = PointerAt<uint8_t>(x, y);
+            std::copy(pi, pi + bytes_per_pixel,
+                      output.data_.data() + y * bytes_per_line +
+                              (width_ - x - 1) * bytes_per_pixel);
+        }
+    }
+}
+
+void ImageView::Filter(Image &output, Image::FilterType type) const {
+    CheckFloatImage(*this, "Filter");
+    Filter(output, GetSeparableKernel(type, false),
+           GetSeparableKernel(type, true));
+}
+
+void ImageView::Filter(Image &output,
+                       const std::vector<double> &dx,
+                       const std::vector<double> &dy) const {
+    CheckFloatImage(*this, "Filter");
+    const std::vector<float> kernel_x = ToFloatKernel(dx);
+    const std::vector<float> kernel_y = ToFloatKernel(dy);
+    const int half_size_y = (int)kernel_y.size() / 2;
+    PrepareOutput(*this, output, width_, height_, 1, 4, "Filter");
+    if (IsEmpty()) {
+        return;
+    }
+
+    const int num_blocks = (height_ + kFilterBlockRows - 1) / kFilterBlockRows;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<float> padded_row, buffer;
+        std::vector<double> accumulator(width_);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int block = 0; block < num_blocks; block++) {
+            const int y_begin = block * kFilterBlockRows;
+            const int y_end = std::min(y_begin + kFilterBlockRows, height_);
+            const int row_begin = std::max(y_begin - half_size_y, 0);
+            const int row_end = std::min(y_end + half_size_y, height_);
+            buffer.resize((size_t)(row_end - row_begin) * width_);
+            FilterRowsHorizontal(*this, kernel_x, row_begin, row_end,
+                                 padded_row, accumulator, buffer.data());
+            for (int y = y_begin; y < y_end; y++) {
+                FilterBufferedColumn(buffer.data(), row_begin, width_, height_,
+                                     kernel_y, y, accumulator.data(),
+                                     output.PointerAt<float>(0, y));
+            }
+        }
+    }
+}
+
+void ImageView::FilterSobel(Image &output_dx, Image &output_dy) const {
+    CheckFloatImage(*this, "FilterSobel");
+    if (&output_dx == &output_dy) {
+        utility::LogError("[FilterSobel] The outputs must be different.");
+    }
+    const std::vector<float> derivative = ToFloatKernel(Sobel31);
+    const std::vector<float> smoothing = ToFloatKernel(Sobel32);
+    PrepareOutput(*this, output_dx, width_, height_, 1, 4, "FilterSobel");
+    PrepareOutput(*this, output_dy, width_, height_, 1, 4, "FilterSobel");
+    if (IsEmpty()) {
+        return;
+    }
+
+    // Both gradients share the padded input rows, the x-gradient smoothes
+    // the horizontal derivative and the y-gradient differentiates the
+    // horizontally smoothed rows.
+    const int num_blocks = (height_ + kFilterBlockRows - 1) / kFilterBlockRows;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<float> padded_row(width_ + 2), buffer_d, buffer_s;
+        std::vector<double> accumulator(width_);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int block = 0; block < num_blocks; block++) {
+            const int y_begin = block * kFilterBlockRows;
+            const int y_end = std::min(y_begin + kFilterBlockRows, height_);
+            const int row_begin = std::max(y_begin - 1, 0);
+            const int row_end = std::min(y_end + 1, height_);
+            buffer_d.resize((size_t)(row_end - row_begin) * width_);
+            buffer_s.resize((size_t)(row_end - row_begin) * width_);
+            for (int y = row_begin; y < row_end; y++) {
+                const size_t offset = (size_t)(y - row_begin) * width_;
+                PadRow(*this, y, 1, padded_row.data());
+                FilterPaddedRow(padded_row.data(), width_, derivative,
+                                accumulator.data(), buffer_d.data() + offset);
+                FilterPaddedRow(padded_row.data(), width_, smoothing,
+                                accumulator.data(), buffer_s.data() + offset);
+            }
+            for (int y = y_begin; y < y_end; y++) {
+                FilterBufferedColumn(buffer_d.data(), row_begin, width_,
+                                     height_, smoothing, y, accumulator.data(),
+                                     output_dx.PointerAt<float>(0, y));
+                FilterBufferedColumn(buffer_s.data(), row_begin, width_,
+                                     height_, derivative, y,
+                                     accumulator.data(),
+                                     output_dy.PointerAt<float>(0, y));
+            }
+        }
+    }
+}
+
+void ImageView::Downsample(Image &output) const {
+    CheckFloatImage(*this, "Downsample");
+    int half_width = (int)floor((double)width_ / 2.0);
+    int half_height = (int)floor((double)height_ / 2.0);
+    PrepareOutput(*this, output, half_width, half_height, 1, 4, "Downsample");
+
+#ifdef _OPENMP
+#ifdef _WIN32
+#pragma omp parallel for schedule(static)
+#else
+#pragma omp parallel for collapse(2) schedule(static)
+#endif
+#endif
+    for (int y = 0; y < output.height_; y++) {
+        for (int x = 0; x < output.width_; x++) {
+            const float *p1 = PointerAt<float>(x * 2, y * 2);
+            const float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
+            const float *p3 = PointerAt<float>(x * 2, y * 2 + 1);
+            const float *p4 = PointerAt<float>(x * 2 + 1, y * 2 + 1);
+            float *p = output.PointerAt<float>(x, y);
+            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
+        }
+    }
+}
+
+void ImageView::FilterAndDownsample(Image &output,
+                                    Image::FilterType type) const {
+    CheckFloatImage(*this, "FilterAndDownsample");
+    const std::vector<float> kernel_x =
+            ToFloatKernel(GetSeparableKernel(type, false));
+    const std::vector<float> kernel_y =
+            ToFloatKernel(GetSeparableKernel(type, true));
+    const int half_size_y = (int)kernel_y.size() / 2;
+    int half_width = (int)floor((double)width_ / 2.0);
+    int half_height = (int)floor((double)height_ / 2.0);
+    PrepareOutput(*this, output, half_width, half_height, 1, 4,
+                  "FilterAndDownsample");
+    if (output.IsEmpty()) {
+        return;
+    }
+
+    // Only the filtered rows 2y and 2y + 1 of every output row y are needed,
+    // they are averaged like in Downsample.
+    const int num_blocks =
+            (half_height + kFilterBlockRows - 1) / kFilterBlockRows;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<float> padded_row, buffer;
+        std::vector<float> row0(width_), row1(width_);
+        std::vector<double> accumulator(width_);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int block = 0; block < num_blocks; block++) {
+            const int y_begin = block * kFilterBlockRows;
+            const int y_end = std::min(y_begin + kFilterBlockRows, half_height);
+            const int row_begin = std::max(2 * y_begin - half_size_y, 0);
+            const int row_end = std::min(2 * y_end + half_size_y, height_);
+            buffer.resize((size_t)(row_end - row_begin) * width_);
+            FilterRowsHorizontal(*this, kernel_x, row_begin, row_end,
+                                 padded_row, accumulator, buffer.data());
+            for (int y = y_begin; y < y_end; y++) {
+                FilterBufferedColumn(buffer.data(), row_begin, width_, height_,
+                                     kernel_y, 2 * y, accumulator.data(),
+                                     row0.data());
+                FilterBufferedColumn(buffer.data(), row_begin, width_, height_,
+                                     kernel_y, 2 * y + 1, accumulator.data(),
+                                     row1.data());
+                float *p = output.PointerAt<float>(0, y);
+                for (int x = 0; x < half_width; x++) {
+                    p[x] = (row0[x * 2] + row0[x * 2 + 1] + row1[x * 2] +
+                            row1[x * 2 + 1]) /
+                           4.0f;
+                }
+            }
+        }
+    }
+}
+
+void ImageView::FilterBilateral(Image &output,
+                                int half_kernel_size,
+                                double sigma_space,
+                                double sigma_depth) const {
+    CheckFloatImage(*this, "FilterBilateral");
+    CheckBilateralParameters(half_kernel_size, sigma_space, sigma_depth,
+                             "FilterBilateral");
+    PrepareOutput(*this, output, width_, height_, 1, 4, "FilterBilateral");
+    const int size = 2 * half_kernel_size + 1;
+    const std::vector<float> space_weights =
+            GetSpatialWeights(half_kernel_size, sigma_space);
+    const float depth_coeff = (float)(-0.5 / (sigma_depth * sigma_depth));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < height_; y++) {
+        const float *center_row = RowAt<float>(y);
+        float *p = output.PointerAt<float>(0, y);
+        const int y_begin = std::max(y - half_kernel_size, 0);
+        const int y_end = std::min(y + half_kernel_size, height_ - 1);
+        for (int x = 0; x < width_; x++) {
+            const float d = center_row[x];
+            if (!IsValidDepth(d)) {
+                p[x] = d;
+                continue;
+            }
+            const int x_begin = std::max(x - half_kernel_size, 0);
+            const int x_end = std::min(x + half_kernel_size, width_ - 1);
+            const int x_offset = x - half_kernel_size;
+            float sum = 0.0f, sum_weights = 0.0f;
+            for (int yy = y_begin; yy <= y_end; yy++) {
+                const float *row = RowAt<float>(yy);
+                const float *weights = space_weights.data() +
+                                       (yy - y + half_kernel_size) * size;
+                for (int xx = x_begin; xx <= x_end; xx++) {
+                    const float v = row[xx];
+                    if (IsValidDepth(v)) {
+                        const float diff = v - d;
+                        const float w = weights[xx - x_offset] *
+                                        std::exp(diff * diff * depth_coeff);
+                        sum += w * v;
+                        sum_weights += w;
+                    }
+                }
+            }
+            // the center pixel is valid and contributes, so sum_weights is
+            // positive
+            p[x] = sum / sum_weights;
+        }
+    }
+}
+
+void ImageView::FilterJointBilateral(Image &output,
+                                     const ImageView &guide,
+                                     int half_kernel_size,
+                                     double sigma_space,
+                                     double sigma_color) const {
+    CheckFloatImage(*this, "FilterJointBilateral");
+    CheckFloatImage(guide, "FilterJointBilateral");
+    if (guide.width_ != width_ || guide.height_ != height_) {
+        utility::LogError(
+                "[FilterJointBilateral] The guide image has a different "
+                "size.");
+    }
+    CheckBilateralParameters(half_kernel_size, sigma_space, sigma_color,
+                             "FilterJointBilateral");
+    PrepareOutput(*this, output, width_, height_, 1, 4,
+                  "FilterJointBilateral");
+    const int size = 2 * half_kernel_size + 1;
+    const std::vector<float> space_weights =
+            GetSpatialWeights(half_kernel_size, sigma_space);
+    const float color_coeff = (float)(-0.5 / (sigma_color * sigma_color));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < height_; y++) {
+        const float *center_row = RowAt<float>(y);
+        const float *center_guide = guide.RowAt<float>(y);
+        float *p = output.PointerAt<float>(0, y);
+        const int y_begin = std::max(y - half_kernel_size, 0);
+        const int y_end = std::min(y + half_kernel_size, height_ - 1);
+        for (int x = 0; x < width_; x++) {
+            const float g = center_guide[x];
+            const int x_begin = std::max(x - half_kernel_size, 0);
+            const int x_end = std::min(x + half_kernel_size, width_ - 1);
+            const int x_offset = x - half_kernel_size;
+            float sum = 0.0f, sum_weights = 0.0f;
+            for (int yy = y_begin; yy <= y_end; yy++) {
+                const float *row = RowAt<float>(yy);
+                const float *guide_row = guide.RowAt<float>(yy);
+                const float *weights = space_weights.data() +
+                                       (yy - y + half_kernel_size) * size;
+                for (int xx = x_begin; xx <= x_end; xx++) {
+                    const float v = row[xx];
+                    if (IsValidDepth(v)) {
+                        const float diff = guide_row[xx] - g;
+                        const float w = weights[xx - x_offset] *
+                                        std::exp(diff * diff * color_coeff);
+                        sum += w * v;
+                        sum_weights += w;
+                    }
+                }
+            }
+            p[x] = sum_weights > 0.0f ? sum / sum_weights : center_row[x];
+        }
+    }
+}
+
+void ImageView::FilterMedian(Image &output, int half_kernel_size) const {
+    CheckFloatImage(*this, "FilterMedian");
+    if (half_kernel_size < 0) {
+        utility::LogError("[FilterMedian] Invalid filter parameters.");
+    }
+    PrepareOutput(*this, output, width_, height_, 1, 4, "FilterMedian");
+    const int size = 2 * half_kernel_size + 1;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<float> window(size * size);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int y = 0; y < height_; y++) {
+            float *p = output.PointerAt<float>(0, y);
+            const int y_begin = std::max(y - half_kernel_size, 0);
+            const int y_end = std::min(y + half_kernel_size, height_ - 1);
+            for (int x = 0; x < width_; x++) {
+                const int x_begin = std::max(x - half_kernel_size, 0);
+                const int x_end = std::min(x + half_kernel_size, width_ - 1);
+                int count = 0;
+                for (int yy = y_begin; yy <= y_end; yy++) {
+                    const float *row = RowAt<float>(yy);
+                    for (int xx = x_begin; xx <= x_end; xx++) {
+                        if (IsValidDepth(row[xx])) {
+                            window[count++] = row[xx];
+                        }
+                    }
+                }
+                if (count == 0) {
+                    p[x] = *PointerAt<float>(x, y);
+                    continue;
+                }
+                std::nth_element(window.begin(), window.begin() + count / 2,
+                                 window.begin() + count);
+                p[x] = window[count / 2];
+            }
+        }
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "Open3D/Geometry/Image.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class ImageView
+///
+/// \brief Non-owning, strided, read-only view of image pixels.
+///
+/// A view references the pixels of an Image or of an external buffer and
+/// never modifies them, so a view of a const Image is safe. Rows are
+/// stride_ bytes apart, so a view can describe a region of interest of a
+/// larger image (see Crop) without copying. The operators of ImageView write
+/// into caller-provided output images and reuse their allocation when the
+/// size does not change.
+///
+/// A view of an Image does not keep the image alive and is invalidated when
+/// the image is resized. An external buffer can be adopted together with a
+/// release callback, which is called once all views of the buffer have been
+/// destroyed.
+class ImageView {
+public:
+    /// \brief Callback releasing an adopted external buffer.
+    typedef std::function<void(uint8_t *)> ReleaseCallback;
+
+public:
+    /// \brief Default Constructor, creates an empty view.
+    ImageView() {}
+    /// \brief Creates a view of all pixels of image.
+    explicit ImageView(const Image &image);
+    /// \brief Creates a view of an external buffer.
+    ///
+    /// \param data Pointer to the first pixel.
+    /// \param width Width of the view in pixels.
+    /// \param height Height of the view in pixels.
+    /// \param num_of_channels Number of channels per pixel.
+    /// \param bytes_per_channel Number of bytes per channel.
+    /// \param stride Distance between rows in bytes, 0 for packed rows.
+    ImageView(const uint8_t *data,
+              int width,
+              int height,
+              int num_of_channels,
+              int bytes_per_channel,
+              int stride = 0);
+    /// \brief Creates a view that adopts an external buffer.
+    ///
+    /// release is called with data once the last view sharing the buffer
+    /// (including views created by Crop) is destroyed.
+    ImageView(uint8_t *data,
+              int width,
+              int height,
+              int num_of_channels,
+              int bytes_per_channel,
+              int stride,
+              ReleaseCallback release);
+
+public:
+    bool IsEmpty() const {
+        return data_ == nullptr || width_ <= 0 || height_ <= 0;
+    }
+
+    /// Returns the number of bytes per pixel.
+    int BytesPerPixel() const { return num_of_channels_ * bytes_per_channel_; }
+
+    /// Returns `true` if the rows are packed without padding.
+    bool IsContiguous() const { return stride_ == width_ * BytesPerPixel(); }
+
+    /// Returns `true` if the view owns its buffer through a release callback.
+    bool OwnsBuffer() const { return bool(buffer_); }
+
+    /// Function to access the first pixel of row v.
+    template <typename T>
+    const T *RowAt(int v) const {
+        return reinterpret_cast<const T *>(data_ + (size_t)v * stride_);
+    }
+
+    /// Function to access the first channel of pixel (u, v).
+    template <typename T>
+    const T *PointerAt(int u, int v) const {
+        return reinterpret_cast<const T *>(data_ + (size_t)v * stride_ +
+                                           (size_t)u * BytesPerPixel());
+    }
+
+    /// Function to access channel ch of pixel (u, v).
+    template <typename T>
+    const T *PointerAt(int u, int v, int ch) const {
+        return PointerAt<T>(u, v) + ch;
+    }
+
+    /// \brief Returns a view of the region of interest with top left corner
+    /// (u, v) and size width x height. The region must lie inside the view.
+    ImageView Crop(int u, int v, int width, int height) const;
+
+    /// Function to copy the viewed pixels into a packed image.
+    void CopyTo(Image &output) const;
+
+    /// \brief Gray scaled float image, see Image::CreateFloatImage.
+    void CreateFloatImage(Image &output,
+                          Image::ColorToIntensityConversionType type =
+                                  Image::ColorToIntensityConversionType::
+                                          Weighted) const;
+
+    /// \brief Metric float depth image, see Image::ConvertDepthToFloatImage.
+    void ConvertDepthToFloatImage(Image &output,
+                                  double depth_scale = 1000.0,
+                                  double depth_trunc = 3.0) const;
+
+    void Transpose(Image &output) const;
+    void FlipHorizontal(Image &output) const;
+    void FlipVertical(Image &output) const;
+
+    void Filter(Image &output, Image::FilterType type) const;
+    void Filter(Image &output,
+                const std::vector<double> &dx,
+                const std::vector<double> &dy) const;
+    void FilterSobel(Image &output_dx, Image &output_dy) const;
+    void Downsample(Image &output) const;
+    void FilterAndDownsample(Image &output, Image::FilterType type) const;
+
+    /// \brief Bilateral filter of a float depth image, see
+    /// Image::FilterBilateral.
+    void FilterBilateral(Image &output,
+                         int half_kernel_size,
+                         double sigma_space,
+                         double sigma_depth) const;
+    /// \brief Color guided bilateral filter of a float depth image, see
+    /// Image::FilterJointBilateral. guide must be a float image of the same
+    /// size.
+    void FilterJointBilateral(Image &output,
+                              const ImageView &guide,
+                              int half_kernel_size,
+                              double sigma_space,
+                              double sigma_color) const;
+    /// \brief Median filter of a float depth image, see Image::FilterMedian.
+    void FilterMedian(Image &output, int half_kernel_size) const;
+
+public:
+    /// Pointer to the first pixel.
+    const uint8_t *data_ = nullptr;
+    /// Width of the view.
+    int width_ = 0;
+    /// Height of the view.
+    int height_ = 0;
+    /// Number of chanels per pixel.
+    int num_of_channels_ = 0;
+    /// Number of bytes per channel.
+    int bytes_per_channel_ = 0;
+    /// Distance between rows in bytes.
+    int stride_ = 0;
+
+private:
+    /// Adopted external buffer, releases it through the callback.
+    std::shared_ptr<uint8_t> buffer_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -43,6 +43,7 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class ImageView;
 class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
@@ -321,6 +322,34 @@ public:
             int stride = 1,
             bool project_valid_depth_only = true);
 
+    /// \brief Factory function to create a pointcloud from a view of a depth
+    /// image, e.g. a region of interest or an external buffer.
+    ///
+    /// Same as CreateFromDepthImage, pixel coordinates are relative to the
+    /// first pixel of the view.
+    static std::shared_ptr<PointCloud> CreateFromDepthImage(
+            const ImageView &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_scale = 1000.0,
+            double depth_trunc = 1000.0,
+            int stride = 1,
+            bool project_valid_depth_only = true);
+
+    /// \brief Function to back-project a depth image into single precision
+    /// points.
+    ///
+    /// Same as CreateFromDepthImage, for consumers that do not need a
+    /// PointCloud with double precision points.
+    static std::vector<Eigen::Vector3f> CreateFloatPointsFromDepthImage(
+            const Image &depth,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic = Eigen::Matrix4d::Identity(),
+            double depth_scale = 1000.0,
+            double depth_trunc = 1000.0,
+            int stride = 1,
+            bool project_valid_depth_only = true);
+
     /// \brief Factory function to create a pointcloud from an RGB-D image and a
     /// camera model.
     ///
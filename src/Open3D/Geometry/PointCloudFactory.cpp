@@ -26,9 +26,11 @@
 
 #include <Eigen/Dense>
 #include <limits>
+#include <numeric>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/ImageView.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Geometry/VoxelGrid.h"
@@ -50,45 +52,119 @@ int CountValidDepthPixels(const Image &depth, int stride) {
     return num_valid_pixels;
 }
 
-std::shared_ptr<PointCloud> CreatePointCloudFromFloatDepthImage(
-        const Image &depth,
-        const camera::PinholeCameraIntrinsic &intrinsic,
-        const Eigen::Matrix4d &extrinsic,
-        int stride,
-        bool project_valid_depth_only) {
-    auto pointcloud = std::make_shared<PointCloud>();
-    Eigen::Matrix4d camera_pose = extrinsic.inverse();
+/// Metric depth of a pixel, uint16_t depth is converted like
+/// Image::ConvertDepthToFloatImage.
+inline float GetMetricDepth(float d, float depth_scale, double depth_trunc) {
+    return d;
+}
+
+inline float GetMetricDepth(uint16_t d, float depth_scale, double depth_trunc) {
+    float z = (float)d / depth_scale;
+    return z >= depth_trunc ? 0.0f : z;
+}
+
+/// Back-projects every stride-th pixel of a depth image with pixel type TD
+/// into points of scalar type TP. The camera ray of pixel (u, v) is
+/// ((u - cx) / fx, (v - cy) / fy, 1), its x and y components only depend on
+/// the column and the row respectively, so they are tabulated once per call.
+/// Valid pixels are counted per row and a prefix sum over the rows gives
+/// each row its output offset, which allows filling the points in parallel.
+template <typename TD, typename TP>
+void BackprojectDepthImage(const ImageView &depth,
+                           const camera::PinholeCameraIntrinsic &intrinsic,
+                           const Eigen::Matrix4d &extrinsic,
+                           double depth_scale,
+                           double depth_trunc,
+                           int stride,
+                           bool project_valid_depth_only,
+                           std::vector<Eigen::Matrix<TP, 3, 1>> &points) {
+    if (stride < 1) {
+        utility::LogError(
+                "[CreatePointCloudFromDepthImage] stride has to be positive.");
+    }
+    const Eigen::Matrix4d camera_pose = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = camera_pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = camera_pose.block<3, 1>(0, 3);
     auto focal_length = intrinsic.GetFocalLength();
     auto principal_point = intrinsic.GetPrincipalPoint();
-    int num_valid_pixels;
-    if (!project_valid_depth_only) {
-        num_valid_pixels =
-                int(depth.height_ / stride) * int(depth.width_ / stride);
+    const int num_rows = (depth.height_ + stride - 1) / stride;
+    const int num_cols = (depth.width_ + stride - 1) / stride;
+    const float scale = (float)depth_scale;
+
+    std::vector<double> ray_x(num_cols), ray_y(num_rows);
+    for (int c = 0; c < num_cols; c++) {
+        ray_x[c] = (c * stride - principal_point.first) / focal_length.first;
+    }
+    for (int r = 0; r < num_rows; r++) {
+        ray_y[r] = (r * stride - principal_point.second) / focal_length.second;
+    }
+
+    std::vector<int> row_offsets(num_rows + 1, 0);
+    if (project_valid_depth_only) {
+#pragma omp parallel for schedule(static)
+        for (int r = 0; r < num_rows; r++) {
+            const TD *row = depth.RowAt<TD>(r * stride);
+            int count = 0;
+            for (int c = 0; c < num_cols; c++) {
+                if (GetMetricDepth(row[c * stride], scale, depth_trunc) > 0) {
+                    count++;
+                }
+            }
+            row_offsets[r + 1] = count;
+        }
     } else {
-        num_valid_pixels = CountValidDepthPixels(depth, stride);
+        std::fill(row_offsets.begin() + 1, row_offsets.end(), num_cols);
     }
-    pointcloud->points_.resize(num_valid_pixels);
-    int cnt = 0;
-    for (int i = 0; i < depth.height_; i += stride) {
-        for (int j = 0; j < depth.width_; j += stride) {
-            const float *p = depth.PointerAt<float>(j, i);
-            if (*p > 0) {
-                double z = (double)(*p);
-                double x = (j - principal_point.first) * z / focal_length.first;
-                double y =
-                        (i - principal_point.second) * z / focal_length.second;
-                Eigen::Vector4d point =
-                        camera_pose * Eigen::Vector4d(x, y, z, 1.0);
-                pointcloud->points_[cnt++] = point.block<3, 1>(0, 0);
+    std::partial_sum(row_offsets.begin(), row_offsets.end(),
+                     row_offsets.begin());
+    points.resize(row_offsets.back());
+
+    const TP nan = std::numeric_limits<TP>::quiet_NaN();
+#pragma omp parallel for schedule(static)
+    for (int r = 0; r < num_rows; r++) {
+        const TD *row = depth.RowAt<TD>(r * stride);
+        // rotated ray of the row at u = cx, moves along the rotated x-axis
+        const Eigen::Vector3d row_ray =
+                rotation.col(2) + ray_y[r] * rotation.col(1);
+        int cnt = row_offsets[r];
+        for (int c = 0; c < num_cols; c++) {
+            double z = GetMetricDepth(row[c * stride], scale, depth_trunc);
+            if (z > 0) {
+                Eigen::Vector3d point =
+                        z * (row_ray + ray_x[c] * rotation.col(0)) +
+                        translation;
+                points[cnt++] = point.cast<TP>();
             } else if (!project_valid_depth_only) {
-                double z = std::numeric_limits<float>::quiet_NaN();
-                double x = std::numeric_limits<float>::quiet_NaN();
-                double y = std::numeric_limits<float>::quiet_NaN();
-                pointcloud->points_[cnt++] = Eigen::Vector3d(x, y, z);
+                points[cnt++] = Eigen::Matrix<TP, 3, 1>(nan, nan, nan);
             }
         }
     }
-    return pointcloud;
+}
+
+template <typename TP>
+void BackprojectDepthImage(const ImageView &depth,
+                           const camera::PinholeCameraIntrinsic &intrinsic,
+                           const Eigen::Matrix4d &extrinsic,
+                           double depth_scale,
+                           double depth_trunc,
+                           int stride,
+                           bool project_valid_depth_only,
+                           std::vector<Eigen::Matrix<TP, 3, 1>> &points) {
+    if (depth.num_of_channels_ == 1) {
+        if (depth.bytes_per_channel_ == 2) {
+            BackprojectDepthImage<uint16_t, TP>(
+                    depth, intrinsic, extrinsic, depth_scale, depth_trunc,
+                    stride, project_valid_depth_only, points);
+            return;
+        } else if (depth.bytes_per_channel_ == 4) {
+            BackprojectDepthImage<float, TP>(
+                    depth, intrinsic, extrinsic, depth_scale, depth_trunc,
+                    stride, project_valid_depth_only, points);
+            return;
+        }
+    }
+    utility::LogError(
+            "[CreatePointCloudFromDepthImage] Unsupported image format.");
 }
 
 template <typename TC, int NC>
@@ -154,22 +230,41 @@ std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
         double depth_trunc /* = 1000.0*/,
         int stride /* = 1*/,
         bool project_valid_depth_only) {
-    if (depth.num_of_channels_ == 1) {
-        if (depth.bytes_per_channel_ == 2) {
-            auto float_depth =
-                    depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
-            return CreatePointCloudFromFloatDepthImage(
-                    *float_depth, intrinsic, extrinsic, stride,
-                    project_valid_depth_only);
-        } else if (depth.bytes_per_channel_ == 4) {
-            return CreatePointCloudFromFloatDepthImage(
-                    depth, intrinsic, extrinsic, stride,
-                    project_valid_depth_only);
-        }
-    }
-    utility::LogError(
-            "[CreatePointCloudFromDepthImage] Unsupported image format.");
-    return std::make_shared<PointCloud>();
+    auto pointcloud = std::make_shared<PointCloud>();
+    BackprojectDepthImage(ImageView(depth), intrinsic, extrinsic, depth_scale,
+                          depth_trunc, stride, project_valid_depth_only,
+                          pointcloud->points_);
+    return pointcloud;
+}
+
+std::shared_ptr<PointCloud> PointCloud::CreateFromDepthImage(
+        const ImageView &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        int stride /* = 1*/,
+        bool project_valid_depth_only /* = true*/) {
+    auto pointcloud = std::make_shared<PointCloud>();
+    BackprojectDepthImage(depth, intrinsic, extrinsic, depth_scale,
+                          depth_trunc, stride, project_valid_depth_only,
+                          pointcloud->points_);
+    return pointcloud;
+}
+
+std::vector<Eigen::Vector3f> PointCloud::CreateFloatPointsFromDepthImage(
+        const Image &depth,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic /* = Eigen::Matrix4d::Identity()*/,
+        double depth_scale /* = 1000.0*/,
+        double depth_trunc /* = 1000.0*/,
+        int stride /* = 1*/,
+        bool project_valid_depth_only /* = true*/) {
+    std::vector<Eigen::Vector3f> points;
+    BackprojectDepthImage(ImageView(depth), intrinsic, extrinsic, depth_scale,
+                          depth_trunc, stride, project_valid_depth_only,
+                          points);
+    return points;
 }
 
 std::shared_ptr<PointCloud> PointCloud::CreateFromRGBDImage(
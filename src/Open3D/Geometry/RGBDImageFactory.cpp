@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Geometry/ImageView.h"
 #include "Open3D/Geometry/RGBDImage.h"
 
 namespace open3d {
@@ -41,10 +42,13 @@ std::shared_ptr<RGBDImage> RGBDImage::CreateFromColorAndDepth(
                 "[CreateFromColorAndDepth] Unsupported image "
                 "format.");
     }
-    rgbd_image->depth_ =
-            *depth.ConvertDepthToFloatImage(depth_scale, depth_trunc);
-    rgbd_image->color_ =
-            convert_rgb_to_intensity ? *color.CreateFloatImage() : color;
+    ImageView(depth).ConvertDepthToFloatImage(rgbd_image->depth_,
+                                              depth_scale, depth_trunc);
+    if (convert_rgb_to_intensity) {
+        ImageView(color).CreateFloatImage(rgbd_image->color_);
+    } else {
+        rgbd_image->color_ = color;
+    }
     return rgbd_image;
 }
 
@@ -27,11 +27,13 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/IntersectionTest.h"
-#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/Qhull.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -42,10 +44,541 @@
 #endif
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Compact copy of TriangleMesh::adjacency_list_ that can be traversed
+/// without hashing. The neighbours of vertex i are stored in
+/// neighbours_[offsets_[i]], ..., neighbours_[offsets_[i + 1] - 1].
+class CompactAdjacency {
+public:
+    explicit CompactAdjacency(
+            const std::vector<std::unordered_set<int>> &adjacency_list) {
+        offsets_.resize(adjacency_list.size() + 1);
+        offsets_[0] = 0;
+        for (size_t vidx = 0; vidx < adjacency_list.size(); ++vidx) {
+            offsets_[vidx + 1] = offsets_[vidx] + adjacency_list[vidx].size();
+        }
+        neighbours_.resize(offsets_.back());
+#pragma omp parallel for schedule(static)
+        for (int vidx = 0; vidx < int(adjacency_list.size()); ++vidx) {
+            std::copy(adjacency_list[vidx].begin(), adjacency_list[vidx].end(),
+                      neighbours_.begin() + offsets_[vidx]);
+        }
+    }
+
+public:
+    std::vector<size_t> offsets_;
+    std::vector<int> neighbours_;
+};
+
+/// The vertex filters are linear: the filtered value of vertex i is
+/// self_coeff * v_i + nb_coeff * \sum_{n \in N} w_n v_n. A kernel provides
+/// the neighbour weights w_n and, given their sum, the two coefficients.
+class SimpleKernel {
+public:
+    double NeighbourWeight(int pass,
+                           size_t vidx,
+                           int nbidx,
+                           const std::vector<Eigen::Vector3d> &vertices) const {
+        return 1;
+    }
+    void Coefficients(int pass,
+                      size_t nb_size,
+                      double total_weight,
+                      double &self_coeff,
+                      double &nb_coeff) const {
+        self_coeff = nb_coeff = 1. / (1 + nb_size);
+    }
+};
+
+class SharpenKernel {
+public:
+    explicit SharpenKernel(double strength) : strength_(strength) {}
+    double NeighbourWeight(int pass,
+                           size_t vidx,
+                           int nbidx,
+                           const std::vector<Eigen::Vector3d> &vertices) const {
+        return 1;
+    }
+    void Coefficients(int pass,
+                      size_t nb_size,
+                      double total_weight,
+                      double &self_coeff,
+                      double &nb_coeff) const {
+        self_coeff = 1 + strength_ * nb_size;
+        nb_coeff = -strength_;
+    }
+
+private:
+    double strength_;
+};
+
+/// Inverse distance weighted Laplacian. Even passes use lambda, odd passes
+/// use mu, which gives Taubin smoothing if they differ.
+class LaplacianKernel {
+public:
+    LaplacianKernel(double lambda, double mu) : lambda_(lambda), mu_(mu) {}
+    double NeighbourWeight(int pass,
+                           size_t vidx,
+                           int nbidx,
+                           const std::vector<Eigen::Vector3d> &vertices) const {
+        double dist = (vertices[vidx] - vertices[nbidx]).norm();
+        return 1. / (dist + 1e-12);
+    }
+    void Coefficients(int pass,
+                      size_t nb_size,
+                      double total_weight,
+                      double &self_coeff,
+                      double &nb_coeff) const {
+        if (nb_size == 0) {
+            self_coeff = 1;
+            nb_coeff = 0;
+            return;
+        }
+        double lambda = pass % 2 == 0 ? lambda_ : mu_;
+        self_coeff = 1 - lambda;
+        nb_coeff = lambda / total_weight;
+    }
+
+private:
+    double lambda_;
+    double mu_;
+};
+
+/// Applies number_of_passes Jacobi sweeps of the filter defined by kernel to
+/// the vertices in vertex_indices (all vertices if empty). Each pass reads
+/// the values of the previous pass, the vertices are processed in parallel
+/// and a single additional buffer per filtered attribute is reused for all
+/// passes. Vertices that are not selected keep their values.
+template <typename Kernel>
+void FilterVerticesJacobi(TriangleMesh &mesh,
+                          int number_of_passes,
+                          MeshBase::FilterScope scope,
+                          const std::vector<size_t> &vertex_indices,
+                          const Kernel &kernel) {
+    typedef MeshBase::FilterScope FilterScope;
+    bool filter_vertex =
+            scope == FilterScope::All || scope == FilterScope::Vertex;
+    bool filter_normal =
+            (scope == FilterScope::All || scope == FilterScope::Normal) &&
+            mesh.HasVertexNormals();
+    bool filter_color =
+            (scope == FilterScope::All || scope == FilterScope::Color) &&
+            mesh.HasVertexColors();
+    for (size_t vidx : vertex_indices) {
+        if (vidx >= mesh.vertices_.size()) {
+            utility::LogError("[FilterVerticesJacobi] invalid vertex index {}",
+                              vidx);
+        }
+    }
+    if (number_of_passes <= 0 ||
+        !(filter_vertex || filter_normal || filter_color)) {
+        return;
+    }
+    if (!mesh.HasAdjacencyList()) {
+        mesh.ComputeAdjacencyList();
+    }
+    const CompactAdjacency adjacency(mesh.adjacency_list_);
+
+    std::vector<Eigen::Vector3d> &vertices = mesh.vertices_;
+    std::vector<Eigen::Vector3d> &vertex_normals = mesh.vertex_normals_;
+    std::vector<Eigen::Vector3d> &vertex_colors = mesh.vertex_colors_;
+    std::vector<Eigen::Vector3d> next_vertices;
+    std::vector<Eigen::Vector3d> next_vertex_normals;
+    std::vector<Eigen::Vector3d> next_vertex_colors;
+    // Copies, such that unselected vertices are valid in both buffers.
+    if (filter_vertex) next_vertices = vertices;
+    if (filter_normal) next_vertex_normals = vertex_normals;
+    if (filter_color) next_vertex_colors = vertex_colors;
+
+    bool filter_all = vertex_indices.empty();
+    int n_filtered =
+            filter_all ? int(vertices.size()) : int(vertex_indices.size());
+    for (int pass = 0; pass < number_of_passes; ++pass) {
+#pragma omp parallel for schedule(static)
+        for (int k = 0; k < n_filtered; ++k) {
+            size_t vidx = filter_all ? size_t(k) : vertex_indices[k];
+            Eigen::Vector3d vertex_sum(0, 0, 0);
+            Eigen::Vector3d normal_sum(0, 0, 0);
+            Eigen::Vector3d color_sum(0, 0, 0);
+            double total_weight = 0;
+            for (size_t nb = adjacency.offsets_[vidx];
+                 nb < adjacency.offsets_[vidx + 1]; ++nb) {
+                int nbidx = adjacency.neighbours_[nb];
+                double weight =
+                        kernel.NeighbourWeight(pass, vidx, nbidx, vertices);
+                total_weight += weight;
+                if (filter_vertex) {
+                    vertex_sum += weight * vertices[nbidx];
+                }
+                if (filter_normal) {
+                    normal_sum += weight * vertex_normals[nbidx];
+                }
+                if (filter_color) {
+                    color_sum += weight * vertex_colors[nbidx];
+                }
+            }
+
+            size_t nb_size =
+                    adjacency.offsets_[vidx + 1] - adjacency.offsets_[vidx];
+            double self_coeff, nb_coeff;
+            kernel.Coefficients(pass, nb_size, total_weight, self_coeff,
+                                nb_coeff);
+            if (filter_vertex) {
+                next_vertices[vidx] =
+                        self_coeff * vertices[vidx] + nb_coeff * vertex_sum;
+            }
+            if (filter_normal) {
+                next_vertex_normals[vidx] = self_coeff * vertex_normals[vidx] +
+                                            nb_coeff * normal_sum;
+            }
+            if (filter_color) {
+                next_vertex_colors[vidx] = self_coeff * vertex_colors[vidx] +
+                                           nb_coeff * color_sum;
+            }
+        }
+        if (filter_vertex) vertices.swap(next_vertices);
+        if (filter_normal) vertex_normals.swap(next_vertex_normals);
+        if (filter_color) vertex_colors.swap(next_vertex_colors);
+    }
+}
+
+/// Returns for every vertex the smallest index of a vertex with identical
+/// coordinates. Vertices with NaN coordinates are never duplicates.
+std::vector<int> ComputeVertexRepresentatives(
+        const std::vector<Eigen::Vector3d> &vertices) {
+    struct VertexKey {
+        double x, y, z;
+        int index;
+        bool operator<(const VertexKey &other) const {
+            return std::tie(x, y, z, index) <
+                   std::tie(other.x, other.y, other.z, other.index);
+        }
+        bool SameCoordinates(const VertexKey &other) const {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+    std::vector<int> representatives(vertices.size());
+    std::vector<VertexKey> keys(vertices.size());
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx < int(vertices.size()); ++vidx) {
+        const Eigen::Vector3d &vertex = vertices[vidx];
+        keys[vidx] = {vertex(0), vertex(1), vertex(2), vidx};
+        representatives[vidx] = vidx;
+    }
+    keys.erase(std::remove_if(keys.begin(), keys.end(),
+                              [](const VertexKey &key) {
+                                  return std::isnan(key.x) ||
+                                         std::isnan(key.y) ||
+                                         std::isnan(key.z);
+                              }),
+               keys.end());
+    utility::ParallelSort(keys.begin(), keys.end());
+    // The first key of each run of equal coordinates has the smallest index.
+    size_t first = 0;
+    for (size_t i = 1; i < keys.size(); ++i) {
+        if (keys[i].SameCoordinates(keys[first])) {
+            representatives[keys[i].index] = keys[first].index;
+        } else {
+            first = i;
+        }
+    }
+    return representatives;
+}
+
+/// Sets keep_triangle[tidx] to 0 for every kept triangle that is a duplicate
+/// of a kept triangle with smaller index. Triangles (0-1-2), (1-2-0) and
+/// (2-0-1) are considered identical.
+void MarkDuplicatedTriangles(const std::vector<Eigen::Vector3i> &triangles,
+                             std::vector<uint8_t> &keep_triangle) {
+    struct TriangleKey {
+        int v0, v1, v2;
+        int index;
+        bool operator<(const TriangleKey &other) const {
+            return std::tie(v0, v1, v2, index) <
+                   std::tie(other.v0, other.v1, other.v2, other.index);
+        }
+        bool SameVertices(const TriangleKey &other) const {
+            return v0 == other.v0 && v1 == other.v1 && v2 == other.v2;
+        }
+    };
+    std::vector<TriangleKey> keys(triangles.size());
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        // Rotate the smallest index to the front, the orientation is kept.
+        const Eigen::Vector3i &t = triangles[tidx];
+        if (!keep_triangle[tidx]) {
+            keys[tidx] = {-1, -1, -1, tidx};
+        } else if (t(0) <= t(1) && t(0) <= t(2)) {
+            keys[tidx] = {t(0), t(1), t(2), tidx};
+        } else if (t(1) <= t(2)) {
+            keys[tidx] = {t(1), t(2), t(0), tidx};
+        } else {
+            keys[tidx] = {t(2), t(0), t(1), tidx};
+        }
+    }
+    keys.erase(std::remove_if(
+                       keys.begin(), keys.end(),
+                       [](const TriangleKey &key) { return key.v0 < 0; }),
+               keys.end());
+    utility::ParallelSort(keys.begin(), keys.end());
+#pragma omp parallel for schedule(static)
+    for (int i = 1; i < int(keys.size()); ++i) {
+        if (keys[i].SameVertices(keys[i - 1])) {
+            keep_triangle[keys[i].index] = 0;
+        }
+    }
+}
+
+/// Converts a keep mask into target indices that preserve the order of the
+/// kept elements; removed elements get target -1. Returns the number of kept
+/// elements.
+int MaskToTargets(const std::vector<uint8_t> &keep, std::vector<int> &targets) {
+    targets.resize(keep.size());
+    int k = 0;
+    for (size_t i = 0; i < keep.size(); ++i) {
+        targets[i] = keep[i] ? k++ : -1;
+    }
+    return k;
+}
+
+/// Moves every element data[i] with targets[i] >= 0 to position targets[i] of
+/// a vector of size n_targets that replaces data.
+template <typename T, typename A>
+void CompactVector(std::vector<T, A> &data,
+                   const std::vector<int> &targets,
+                   int n_targets) {
+    std::vector<T, A> compacted(n_targets);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(targets.size()); ++i) {
+        if (targets[i] >= 0) {
+            compacted[targets[i]] = data[i];
+        }
+    }
+    data.swap(compacted);
+}
+
+/// Replaces every vertex index of the triangles by index_map[index].
+void RemapTriangles(std::vector<Eigen::Vector3i> &triangles,
+                    const std::vector<int> &index_map) {
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        Eigen::Vector3i &triangle = triangles[tidx];
+        triangle(0) = index_map[triangle(0)];
+        triangle(1) = index_map[triangle(1)];
+        triangle(2) = index_map[triangle(2)];
+    }
+}
+
+/// Uniform grid over a set of vertices that stores, for every occupied cell,
+/// the vertex indices in ascending order. The memory is linear in the number
+/// of vertices; occupied cells are sorted and located by binary search.
+/// Vertices with non-finite coordinates, e.g. the invalid points of organized
+/// point clouds, get a cell of their own that is not adjacent to any other
+/// cell, so they never have neighbours.
+class VertexGrid {
+public:
+    struct Cell {
+        int64_t x, y, z;
+        bool operator<(const Cell &other) const {
+            return std::tie(x, y, z) < std::tie(other.x, other.y, other.z);
+        }
+        bool operator==(const Cell &other) const {
+            return x == other.x && y == other.y && z == other.z;
+        }
+    };
+
+    /// Vertex indices of a cell, can be used in range-based for loops.
+    class CellVertices {
+    public:
+        CellVertices(const int *begin, const int *end)
+            : begin_(begin), end_(end) {}
+        const int *begin() const { return begin_; }
+        const int *end() const { return end_; }
+
+    private:
+        const int *begin_;
+        const int *end_;
+    };
+
+    VertexGrid(const std::vector<Eigen::Vector3d> &vertices, double cell_size) {
+        struct CellKey {
+            Cell cell;
+            int index;
+            bool operator<(const CellKey &other) const {
+                if (cell == other.cell) return index < other.index;
+                return cell < other.cell;
+            }
+        };
+        // Finite vertices have cell coordinates in [0, kMaxCoordinate], far
+        // coordinates are clamped, which only adds candidates. The isolated
+        // cells of non-finite vertices lie beyond and are 3 cells apart.
+        const double kMaxCoordinate = double(int64_t(1) << 61);
+        const int64_t kIsolatedCellBase = int64_t(1) << 62;
+        Eigen::Vector3d origin = ComputeMinBound(vertices);
+        std::vector<CellKey> keys(vertices.size());
+#pragma omp parallel for schedule(static)
+        for (int vidx = 0; vidx < int(vertices.size()); ++vidx) {
+            keys[vidx].index = vidx;
+            if (!vertices[vidx].allFinite()) {
+                keys[vidx].cell = {kIsolatedCellBase + 3 * int64_t(vidx), 0,
+                                   0};
+                continue;
+            }
+            Eigen::Vector3d ref_coord = (vertices[vidx] - origin) / cell_size;
+            int64_t coords[3];
+            for (int i = 0; i < 3; ++i) {
+                coords[i] = int64_t(std::floor(std::min(
+                        std::max(ref_coord(i), 0.0), kMaxCoordinate)));
+            }
+            keys[vidx].cell = {coords[0], coords[1], coords[2]};
+        }
+        utility::ParallelSort(keys.begin(), keys.end());
+
+        vertex_cells_.resize(vertices.size());
+        cell_vertices_.resize(vertices.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (i == 0 || !(keys[i].cell == keys[i - 1].cell)) {
+                cells_.push_back(keys[i].cell);
+                cell_offsets_.push_back(i);
+            }
+            cell_vertices_[i] = keys[i].index;
+            vertex_cells_[keys[i].index] = int(cells_.size()) - 1;
+        }
+        cell_offsets_.push_back(keys.size());
+    }
+
+    const Cell &GetVertexCell(int vidx) const {
+        return cells_[vertex_cells_[vidx]];
+    }
+
+    int GetVertexCellIndex(int vidx) const { return vertex_cells_[vidx]; }
+
+    int GetNumCells() const { return int(cells_.size()); }
+
+    const Cell &GetCell(int cell_idx) const { return cells_[cell_idx]; }
+
+    /// Returns the index of the cell at the given offset from cell, or -1 if
+    /// that cell contains no vertices.
+    int FindCell(const Cell &cell, int dx, int dy, int dz) const {
+        Cell query = {cell.x + dx, cell.y + dy, cell.z + dz};
+        auto it = std::lower_bound(cells_.begin(), cells_.end(), query);
+        if (it == cells_.end() || !(*it == query)) {
+            return -1;
+        }
+        return int(it - cells_.begin());
+    }
+
+    CellVertices GetCellVertices(int cell_idx) const {
+        const int *data = cell_vertices_.data();
+        return CellVertices(data + cell_offsets_[cell_idx],
+                            data + cell_offsets_[cell_idx + 1]);
+    }
+
+private:
+    static Eigen::Vector3d ComputeMinBound(
+            const std::vector<Eigen::Vector3d> &vertices) {
+        Eigen::Vector3d min_bound = Eigen::Vector3d::Zero();
+        bool is_first = true;
+        for (const Eigen::Vector3d &vertex : vertices) {
+            if (!vertex.allFinite()) {
+                continue;
+            }
+            min_bound = is_first ? vertex
+                                 : min_bound.array().min(vertex.array()).matrix();
+            is_first = false;
+        }
+        return min_bound;
+    }
+
+private:
+    std::vector<Cell> cells_;
+    std::vector<size_t> cell_offsets_;
+    std::vector<int> cell_vertices_;
+    std::vector<int> vertex_cells_;
+};
+
+/// Counter-based random number generator (SplitMix64). A generator is keyed by
+/// a seed and a stream index, e.g. the triangle index, such that the drawn
+/// numbers do not depend on the order in which streams are processed.
+class StreamRandom {
+public:
+    StreamRandom(uint64_t seed, uint64_t stream)
+        : state_(Mix(seed ^ Mix(stream + kGolden))) {}
+
+    /// Returns a uniformly distributed number in [0, 1).
+    double Uniform() {
+        state_ += kGolden;
+        return double(Mix(state_) >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+private:
+    static uint64_t Mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    static const uint64_t kGolden = 0x9e3779b97f4a7c15ULL;
+    uint64_t state_;
+};
+
+/// Disjoint-set forest that supports concurrent unions. A root is always
+/// linked below the smaller root, hence the representative of a set is its
+/// smallest element once all unions have finished.
+class ConcurrentDisjointSet {
+public:
+    explicit ConcurrentDisjointSet(int size) : parents_(size) {
+#pragma omp parallel for schedule(static)
+        for (int idx = 0; idx < size; ++idx) {
+            parents_[idx].store(idx, std::memory_order_relaxed);
+        }
+    }
+
+    int Find(int idx) {
+        while (true) {
+            int parent = parents_[idx].load(std::memory_order_relaxed);
+            if (parent == idx) {
+                return idx;
+            }
+            int grandparent = parents_[parent].load(std::memory_order_relaxed);
+            // path halving, failing is harmless as parents only move upwards
+            parents_[idx].compare_exchange_weak(parent, grandparent,
+                                                std::memory_order_relaxed);
+            idx = grandparent;
+        }
+    }
+
+    void Union(int idx0, int idx1) {
+        while (true) {
+            idx0 = Find(idx0);
+            idx1 = Find(idx1);
+            if (idx0 == idx1) {
+                return;
+            }
+            if (idx0 > idx1) {
+                std::swap(idx0, idx1);
+            }
+            int expected = idx1;
+            if (parents_[idx1].compare_exchange_strong(
+                        expected, idx0, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+}  // unnamed namespace
+
 TriangleMesh &TriangleMesh::Clear() {
     MeshBase::Clear();
     triangles_.clear();
@@ -154,227 +687,22 @@ TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
         int number_of_iterations, double strength, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        prev_vertices[vidx] +
-                        strength * (prev_vertices[vidx] * nb_size - vertex_sum);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        prev_vertex_normals[vidx] +
-                        strength * (prev_vertex_normals[vidx] * nb_size -
-                                    normal_sum);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        prev_vertex_colors[vidx] +
-                        strength * (prev_vertex_colors[vidx] * nb_size -
-                                    color_sum);
-            }
-        }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
-
+    auto mesh = CreateFilterOutputMesh();
+    mesh->FilterSharpenInPlace(number_of_iterations, strength, scope);
     return mesh;
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
         int number_of_iterations, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        (prev_vertex_normals[vidx] + normal_sum) /
-                        (1 + nb_size);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        (prev_vertex_colors[vidx] + color_sum) / (1 + nb_size);
-            }
-        }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
+    auto mesh = CreateFilterOutputMesh();
+    mesh->FilterSmoothSimpleInPlace(number_of_iterations, scope);
     return mesh;
 }
 
-void TriangleMesh::FilterSmoothLaplacianHelper(
-        std::shared_ptr<TriangleMesh> &mesh,
-        const std::vector<Eigen::Vector3d> &prev_vertices,
-        const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-        const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
-        double lambda,
-        bool filter_vertex,
-        bool filter_normal,
-        bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-        Eigen::Vector3d vertex_sum(0, 0, 0);
-        Eigen::Vector3d normal_sum(0, 0, 0);
-        Eigen::Vector3d color_sum(0, 0, 0);
-        double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
-            total_weight += weight;
-
-            if (filter_vertex) {
-                vertex_sum += weight * prev_vertices[nbidx];
-            }
-            if (filter_normal) {
-                normal_sum += weight * prev_vertex_normals[nbidx];
-            }
-            if (filter_color) {
-                color_sum += weight * prev_vertex_colors[nbidx];
-            }
-        }
-
-        if (filter_vertex) {
-            mesh->vertices_[vidx] =
-                    prev_vertices[vidx] +
-                    lambda * (vertex_sum / total_weight - prev_vertices[vidx]);
-        }
-        if (filter_normal) {
-            mesh->vertex_normals_[vidx] = prev_vertex_normals[vidx] +
-                                          lambda * (normal_sum / total_weight -
-                                                    prev_vertex_normals[vidx]);
-        }
-        if (filter_color) {
-            mesh->vertex_colors_[vidx] = prev_vertex_colors[vidx] +
-                                         lambda * (color_sum / total_weight -
-                                                   prev_vertex_colors[vidx]);
-        }
-    }
-}
-
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
         int number_of_iterations, double lambda, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
+    auto mesh = CreateFilterOutputMesh();
+    mesh->FilterSmoothLaplacianInPlace(number_of_iterations, lambda, scope);
     return mesh;
 }
 
@@ -383,46 +711,59 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
         double lambda,
         double mu,
         FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
+    auto mesh = CreateFilterOutputMesh();
+    mesh->FilterSmoothTaubinInPlace(number_of_iterations, lambda, mu, scope);
+    return mesh;
+}
+
+TriangleMesh &TriangleMesh::FilterSharpenInPlace(
+        int number_of_iterations,
+        double strength,
+        FilterScope scope /* = FilterScope::All */,
+        const std::vector<size_t> &vertex_indices /* = {} */) {
+    FilterVerticesJacobi(*this, number_of_iterations, scope, vertex_indices,
+                         SharpenKernel(strength));
+    return *this;
+}
 
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
+TriangleMesh &TriangleMesh::FilterSmoothSimpleInPlace(
+        int number_of_iterations,
+        FilterScope scope /* = FilterScope::All */,
+        const std::vector<size_t> &vertex_indices /* = {} */) {
+    FilterVerticesJacobi(*this, number_of_iterations, scope, vertex_indices,
+                         SimpleKernel());
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::FilterSmoothLaplacianInPlace(
+        int number_of_iterations,
+        double lambda,
+        FilterScope scope /* = FilterScope::All */,
+        const std::vector<size_t> &vertex_indices /* = {} */) {
+    FilterVerticesJacobi(*this, number_of_iterations, scope, vertex_indices,
+                         LaplacianKernel(lambda, lambda));
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::FilterSmoothTaubinInPlace(
+        int number_of_iterations,
+        double lambda,
+        double mu,
+        FilterScope scope /* = FilterScope::All */,
+        const std::vector<size_t> &vertex_indices /* = {} */) {
+    // Every iteration consists of a lambda and a mu pass.
+    FilterVerticesJacobi(*this, 2 * number_of_iterations, scope,
+                         vertex_indices, LaplacianKernel(lambda, mu));
+    return *this;
+}
 
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFilterOutputMesh() const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
-        std::swap(mesh->vertices_, prev_vertices);
-        std::swap(mesh->vertex_normals_, prev_vertex_normals);
-        std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
-    }
     return mesh;
 }
 
@@ -430,20 +771,20 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
         size_t number_of_points,
         std::vector<double> &triangle_areas,
         double surface_area,
-        bool use_triangle_normal) {
+        bool use_triangle_normal,
+        int seed) {
     // triangle areas to cdf
     triangle_areas[0] /= surface_area;
     for (size_t tidx = 1; tidx < triangles_.size(); ++tidx) {
         triangle_areas[tidx] =
                 triangle_areas[tidx] / surface_area + triangle_areas[tidx - 1];
     }
+    triangle_areas.back() = 1;
 
     // sample point cloud
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    std::random_device rd;
-    std::mt19937 mt(rd());
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    uint64_t stream_seed = seed < 0 ? std::random_device()() : uint64_t(seed);
     auto pcd = std::make_shared<PointCloud>();
     pcd->points_.resize(number_of_points);
     if (has_vert_normal || use_triangle_normal) {
@@ -455,17 +796,30 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
     if (has_vert_color) {
         pcd->colors_.resize(number_of_points);
     }
-    size_t point_idx = 0;
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        size_t n = size_t(std::round(triangle_areas[tidx] * number_of_points));
-        while (point_idx < n) {
-            double r1 = dist(mt);
-            double r2 = dist(mt);
+    // The samples of triangle tidx are stored at
+    // [round(cdf[tidx - 1] * n), round(cdf[tidx] * n)), each triangle draws
+    // from its own random stream.
+    auto SampleOffset = [&](int tidx) {
+        if (tidx < 0) {
+            return size_t(0);
+        }
+        size_t offset =
+                size_t(std::round(triangle_areas[tidx] * number_of_points));
+        return std::min(offset, number_of_points);
+    };
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        size_t begin = SampleOffset(tidx - 1);
+        size_t end = SampleOffset(tidx);
+        StreamRandom random(stream_seed, uint64_t(tidx));
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        for (size_t point_idx = begin; point_idx < end; ++point_idx) {
+            double r1 = random.Uniform();
+            double r2 = random.Uniform();
             double a = (1 - std::sqrt(r1));
             double b = std::sqrt(r1) * (1 - r2);
             double c = std::sqrt(r1) * r2;
 
-            const Eigen::Vector3i &triangle = triangles_[tidx];
             pcd->points_[point_idx] = a * vertices_[triangle(0)] +
                                       b * vertices_[triangle(1)] +
                                       c * vertices_[triangle(2)];
@@ -482,8 +836,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
                                           b * vertex_colors_[triangle(1)] +
                                           c * vertex_colors_[triangle(2)];
             }
-
-            point_idx++;
         }
     }
 
@@ -491,7 +843,9 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
 }
 
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformly(
-        size_t number_of_points, bool use_triangle_normal /* = false */) {
+        size_t number_of_points,
+        bool use_triangle_normal /* = false */,
+        int seed /* = -1 */) {
     if (number_of_points <= 0) {
         utility::LogError("[SamplePointsUniformly] number_of_points <= 0");
     }
@@ -505,14 +859,15 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformly(
     double surface_area = GetSurfaceArea(triangle_areas);
 
     return SamplePointsUniformlyImpl(number_of_points, triangle_areas,
-                                     surface_area, use_triangle_normal);
+                                     surface_area, use_triangle_normal, seed);
 }
 
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         size_t number_of_points,
         double init_factor /* = 5 */,
         const std::shared_ptr<PointCloud> pcl_init /* = nullptr */,
-        bool use_triangle_normal /* = false */) {
+        bool use_triangle_normal /* = false */,
+        int seed /* = -1 */) {
     if (number_of_points <= 0) {
         utility::LogError("[SamplePointsPoissonDisk] number_of_points <= 0");
     }
@@ -534,13 +889,17 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     // Compute area of each triangle and sum surface area
     std::vector<double> triangle_areas;
     double surface_area = GetSurfaceArea(triangle_areas);
+    if (!(surface_area > 0)) {
+        utility::LogError(
+                "[SamplePointsPoissonDisk] input mesh has no surface area");
+    }
 
     // Compute init points using uniform sampling
     std::shared_ptr<PointCloud> pcl;
     if (pcl_init == nullptr) {
         pcl = SamplePointsUniformlyImpl(size_t(init_factor * number_of_points),
                                         triangle_areas, surface_area,
-                                        use_triangle_normal);
+                                        use_triangle_normal, seed);
     } else {
         pcl = std::make_shared<PointCloud>();
         pcl->points_ = pcl_init->points_;
@@ -556,10 +915,7 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     double r_max = 2 * std::sqrt((surface_area / number_of_points) /
                                  (2 * std::sqrt(3.)));
     double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
-
-    std::vector<double> weights(pcl->points_.size());
-    std::vector<bool> deleted(pcl->points_.size(), false);
-    KDTreeFlann kdtree(*pcl);
+    double r_max2 = r_max * r_max;
 
     auto WeightFcn = [&](double d2) {
         double d = std::sqrt(d2);
@@ -569,61 +925,121 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         return std::pow(1 - d / r_max, alpha);
     };
 
-    auto ComputePointWeight = [&](int pidx0) {
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
+    // Points only interact within r_max, i.e., with points of the 27 cells
+    // around their own cell in a grid with cell size r_max.
+    const std::vector<Eigen::Vector3d> &points = pcl->points_;
+    int num_points = int(points.size());
+    VertexGrid grid(points, r_max);
+    int num_cells = grid.GetNumCells();
+    std::vector<int> cell_neighbours(27 * num_cells);
+#pragma omp parallel for schedule(static)
+    for (int cidx = 0; cidx < num_cells; ++cidx) {
+        const VertexGrid::Cell &cell = grid.GetCell(cidx);
+        int *nb_cells = &cell_neighbours[27 * cidx];
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    *nb_cells++ = grid.FindCell(cell, dx, dy, dz);
+                }
+            }
+        }
+    }
+
+    std::vector<double> weights(num_points, 0);
+    std::vector<uint8_t> deleted(num_points, 0);
+#pragma omp parallel for schedule(static)
+    for (int pidx0 = 0; pidx0 < num_points; ++pidx0) {
+        const int *nb_cells =
+                &cell_neighbours[27 * grid.GetVertexCellIndex(pidx0)];
         double weight = 0;
-        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
+        for (int nb = 0; nb < 27; ++nb) {
+            if (nb_cells[nb] < 0) {
                 continue;
             }
-            weight += WeightFcn(dists2[nbidx]);
+            for (int pidx1 : grid.GetCellVertices(nb_cells[nb])) {
+                double d2 = (points[pidx0] - points[pidx1]).squaredNorm();
+                if (pidx0 != pidx1 && d2 < r_max2) {
+                    weight += WeightFcn(d2);
+                }
+            }
         }
-
         weights[pidx0] = weight;
-    };
+    }
 
-    // init weights and priority queue
-    typedef std::tuple<int, double> QueueEntry;
-    auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
-        return std::get<1>(a) < std::get<1>(b);
-    };
-    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
-                        decltype(WeightCmp)>
-            queue(WeightCmp);
-    for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
-        queue.push(QueueEntry(int(pidx0), weights[pidx0]));
+    // Deletes a sample and removes its contribution from the weights of its
+    // neighbours, only touches points in the 27 cells around the sample.
+    auto EliminatePoint = [&](int pidx0) {
+        deleted[pidx0] = 1;
+        const int *nb_cells =
+                &cell_neighbours[27 * grid.GetVertexCellIndex(pidx0)];
+        for (int nb = 0; nb < 27; ++nb) {
+            if (nb_cells[nb] < 0) {
+                continue;
+            }
+            for (int pidx1 : grid.GetCellVertices(nb_cells[nb])) {
+                double d2 = (points[pidx0] - points[pidx1]).squaredNorm();
+                if (!deleted[pidx1] && d2 < r_max2) {
+                    weights[pidx1] -= WeightFcn(d2);
+                }
+            }
+        }
     };
 
-    // sample elimination
-    size_t current_number_of_points = pcl->points_.size();
-    while (current_number_of_points > number_of_points) {
-        int pidx;
-        double weight;
-        std::tie(pidx, weight) = queue.top();
-        queue.pop();
-
-        // test if the entry is up to date (because of reinsert)
-        if (deleted[pidx] || weight != weights[pidx]) {
-            continue;
+    // Cells whose coordinates are congruent modulo 3 form a phase group.
+    // The neighbourhoods of the cells in a group are disjoint, hence a group
+    // can eliminate points in parallel without races and the result does not
+    // depend on the number of threads.
+    std::vector<std::vector<int>> phase_groups(27);
+    for (int cidx = 0; cidx < num_cells; ++cidx) {
+        const VertexGrid::Cell &cell = grid.GetCell(cidx);
+        phase_groups[(cell.x % 3) * 9 + (cell.y % 3) * 3 + cell.z % 3]
+                .push_back(cidx);
+    }
+
+    // Every round eliminates half of the remaining surplus. The eliminations
+    // are assigned to the cells holding the currently highest weighted
+    // samples, within a cell the highest weighted sample is removed first.
+    auto HeavierPoint = [&](int pidx0, int pidx1) {
+        if (weights[pidx0] != weights[pidx1]) {
+            return weights[pidx0] > weights[pidx1];
+        }
+        return pidx0 < pidx1;
+    };
+    std::vector<int> candidates(num_points);
+    std::iota(candidates.begin(), candidates.end(), 0);
+    std::vector<int> cell_budgets(num_cells);
+    size_t surplus = points.size() - number_of_points;
+    while (surplus > 0) {
+        size_t round_size = (surplus + 1) / 2;
+        candidates.erase(
+                std::remove_if(candidates.begin(), candidates.end(),
+                               [&](int pidx) { return deleted[pidx] != 0; }),
+                candidates.end());
+        std::nth_element(candidates.begin(),
+                         candidates.begin() + (round_size - 1),
+                         candidates.end(), HeavierPoint);
+        std::fill(cell_budgets.begin(), cell_budgets.end(), 0);
+        for (size_t idx = 0; idx < round_size; ++idx) {
+            cell_budgets[grid.GetVertexCellIndex(candidates[idx])]++;
         }
 
-        // delete current sample
-        deleted[pidx] = true;
-        current_number_of_points--;
-
-        // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
-            queue.push(QueueEntry(nb, weights[nb]));
+        for (const std::vector<int> &phase_group : phase_groups) {
+#pragma omp parallel for schedule(dynamic)
+            for (int gidx = 0; gidx < int(phase_group.size()); ++gidx) {
+                int cidx = phase_group[gidx];
+                for (int count = 0; count < cell_budgets[cidx]; ++count) {
+                    int heaviest = -1;
+                    for (int pidx : grid.GetCellVertices(cidx)) {
+                        if (!deleted[pidx] &&
+                            (heaviest < 0 || HeavierPoint(pidx, heaviest))) {
+                            heaviest = pidx;
+                        }
+                    }
+                    EliminatePoint(heaviest);
+                }
+            }
         }
+        surplus -= round_size;
     }
 
     // update pcl
@@ -654,38 +1070,32 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
 }
 
 TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t,
-                       utility::hash_tuple::hash<Coordinate3>>
-            point_to_old_index;
-    std::vector<int> index_old_to_new(vertices_.size());
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
     size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
+    std::vector<int> representatives = ComputeVertexRepresentatives(vertices_);
+    // New indices follow the order of the first occurrences, duplicates get
+    // the new index of their representative.
+    std::vector<int> index_old_to_new(old_vertex_num);
+    std::vector<int> vertex_targets(old_vertex_num, -1);
+    int k = 0;
+    for (size_t i = 0; i < old_vertex_num; i++) {
+        if (representatives[i] == int(i)) {
+            vertex_targets[i] = k;
+            index_old_to_new[i] = k++;
         } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
+            index_old_to_new[i] = index_old_to_new[representatives[i]];
         }
     }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
-    if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
-            triangle(0) = index_old_to_new[triangle(0)];
-            triangle(1) = index_old_to_new[triangle(1)];
-            triangle(2) = index_old_to_new[triangle(2)];
+    if (size_t(k) < old_vertex_num) {
+        CompactVector(vertices_, vertex_targets, k);
+        if (has_vert_normal) {
+            CompactVector(vertex_normals_, vertex_targets, k);
+        }
+        if (has_vert_color) {
+            CompactVector(vertex_colors_, vertex_targets, k);
         }
+        RemapTriangles(triangles_, index_old_to_new);
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -703,45 +1113,21 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
                 "[RemoveDuplicatedTriangles] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
-    typedef std::tuple<int, int, int> Index3;
-    std::unordered_map<Index3, size_t, utility::hash_tuple::hash<Index3>>
-            triangle_to_old_index;
     bool has_tri_normal = HasTriangleNormals();
     size_t old_triangle_num = triangles_.size();
-    size_t k = 0;
-    for (size_t i = 0; i < old_triangle_num; i++) {
-        Index3 index;
-        // We first need to find the minimum index. Because triangle (0-1-2)
-        // and triangle (2-0-1) are the same.
-        if (triangles_[i](0) <= triangles_[i](1)) {
-            if (triangles_[i](0) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](0), triangles_[i](1),
-                                        triangles_[i](2));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
-        } else {
-            if (triangles_[i](1) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](1), triangles_[i](2),
-                                        triangles_[i](0));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
+    std::vector<uint8_t> keep_triangle(old_triangle_num, 1);
+    MarkDuplicatedTriangles(triangles_, keep_triangle);
+    std::vector<int> triangle_targets;
+    int k = MaskToTargets(keep_triangle, triangle_targets);
+    if (size_t(k) < old_triangle_num) {
+        CompactVector(triangles_, triangle_targets, k);
+        if (has_tri_normal) {
+            CompactVector(triangle_normals_, triangle_targets, k);
         }
-        if (triangle_to_old_index.find(index) == triangle_to_old_index.end()) {
-            triangle_to_old_index[index] = i;
-            triangles_[k] = triangles_[i];
-            if (has_tri_normal) triangle_normals_[k] = triangle_normals_[i];
-            k++;
+        if (HasAdjacencyList()) {
+            ComputeAdjacencyList();
         }
     }
-    triangles_.resize(k);
-    if (has_tri_normal) triangle_normals_.resize(k);
-    if (k < old_triangle_num && HasAdjacencyList()) {
-        ComputeAdjacencyList();
-    }
     utility::LogDebug(
             "[RemoveDuplicatedTriangles] {:d} triangles have been removed.",
             (int)(old_triangle_num - k));
@@ -822,6 +1208,85 @@ TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
     return *this;
 }
 
+TriangleMesh &TriangleMesh::CleanMesh() {
+    size_t old_vertex_num = vertices_.size();
+    size_t old_triangle_num = triangles_.size();
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    bool has_tri_normal = HasTriangleNormals();
+    bool has_tri_uvs = HasTriangleUvs();
+    bool has_tri_material_ids = HasTriangleMaterialIds();
+
+    // Point all triangles to the representatives of duplicated vertices and
+    // drop degenerate and duplicated triangles. Nothing is compacted yet.
+    std::vector<int> representatives = ComputeVertexRepresentatives(vertices_);
+    std::vector<Eigen::Vector3i> triangles = triangles_;
+    RemapTriangles(triangles, representatives);
+    std::vector<uint8_t> keep_triangle(old_triangle_num);
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < int(old_triangle_num); ++tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        keep_triangle[tidx] = triangle(0) != triangle(1) &&
+                              triangle(1) != triangle(2) &&
+                              triangle(2) != triangle(0);
+    }
+    MarkDuplicatedTriangles(triangles, keep_triangle);
+
+    // Only representatives can be referenced by the remaining triangles.
+    std::vector<uint8_t> keep_vertex(old_vertex_num, 0);
+    for (size_t tidx = 0; tidx < old_triangle_num; ++tidx) {
+        if (keep_triangle[tidx]) {
+            keep_vertex[triangles[tidx](0)] = 1;
+            keep_vertex[triangles[tidx](1)] = 1;
+            keep_vertex[triangles[tidx](2)] = 1;
+        }
+    }
+
+    // Single final remap of vertices and triangles.
+    std::vector<int> vertex_targets;
+    std::vector<int> triangle_targets;
+    int n_vertices = MaskToTargets(keep_vertex, vertex_targets);
+    int n_triangles = MaskToTargets(keep_triangle, triangle_targets);
+    CompactVector(vertices_, vertex_targets, n_vertices);
+    if (has_vert_normal) {
+        CompactVector(vertex_normals_, vertex_targets, n_vertices);
+    }
+    if (has_vert_color) {
+        CompactVector(vertex_colors_, vertex_targets, n_vertices);
+    }
+    if (has_tri_normal) {
+        CompactVector(triangle_normals_, triangle_targets, n_triangles);
+    }
+    if (has_tri_material_ids) {
+        CompactVector(triangle_material_ids_, triangle_targets, n_triangles);
+    }
+    if (has_tri_uvs) {
+        std::vector<Eigen::Vector2d> triangle_uvs(3 * n_triangles);
+#pragma omp parallel for schedule(static)
+        for (int tidx = 0; tidx < int(old_triangle_num); ++tidx) {
+            int target = triangle_targets[tidx];
+            if (target >= 0) {
+                for (int i = 0; i < 3; ++i) {
+                    triangle_uvs[3 * target + i] = triangle_uvs_[3 * tidx + i];
+                }
+            }
+        }
+        triangle_uvs_.swap(triangle_uvs);
+    }
+    CompactVector(triangles, triangle_targets, n_triangles);
+    RemapTriangles(triangles, vertex_targets);
+    triangles_.swap(triangles);
+    if (HasAdjacencyList()) {
+        ComputeAdjacencyList();
+    }
+    utility::LogDebug(
+            "[CleanMesh] {:d} vertices and {:d} triangles have been removed.",
+            (int)(old_vertex_num - n_vertices),
+            (int)(old_triangle_num - n_triangles));
+
+    return *this;
+}
+
 TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
     if (HasTriangleUvs()) {
         utility::LogWarning(
@@ -903,27 +1368,28 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
 }
 
 TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
-    KDTreeFlann kdtree(*this);
-    // precompute all neighbours
-    utility::LogDebug("Precompute Neighbours");
-    std::vector<std::vector<int>> nbs(vertices_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int idx = 0; idx < int(vertices_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(vertices_[idx], eps, nbs[idx], dists2);
+    if (eps <= 0 || !HasVertices()) {
+        return *this;
     }
-    utility::LogDebug("Done Precompute Neighbours");
-
     bool has_vertex_normals = HasVertexNormals();
     bool has_vertex_colors = HasVertexColors();
+    bool has_adjacency_list = HasAdjacencyList();
+
+    // Bin the vertices into a uniform grid with cell size eps, all vertices
+    // closer than eps to a vertex are in the 27 surrounding cells.
+    utility::LogDebug("Compute vertex grid");
+    VertexGrid grid(vertices_, eps);
+    utility::LogDebug("Done compute vertex grid");
+
+    // The first unmerged vertex absorbs all unmerged vertices closer than
+    // eps, neighbours are enumerated from the grid instead of being stored.
+    double eps2 = eps * eps;
     std::vector<Eigen::Vector3d> new_vertices;
     std::vector<Eigen::Vector3d> new_vertex_normals;
     std::vector<Eigen::Vector3d> new_vertex_colors;
-    std::unordered_map<int, int> new_vert_mapping;
+    std::vector<int> new_vert_mapping(vertices_.size(), -1);
     for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        if (new_vert_mapping.count(vidx) > 0) {
+        if (new_vert_mapping[vidx] >= 0) {
             continue;
         }
 
@@ -940,19 +1406,32 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
             color = vertex_colors_[vidx];
         }
         int n = 1;
-        for (int nb : nbs[vidx]) {
-            if (vidx == nb || new_vert_mapping.count(nb) > 0) {
-                continue;
-            }
-            vertex += vertices_[nb];
-            if (has_vertex_normals) {
-                normal += vertex_normals_[nb];
-            }
-            if (has_vertex_colors) {
-                color += vertex_colors_[nb];
+        const VertexGrid::Cell &cell = grid.GetVertexCell(vidx);
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    int nb_cell = grid.FindCell(cell, dx, dy, dz);
+                    if (nb_cell < 0) {
+                        continue;
+                    }
+                    for (int nb : grid.GetCellVertices(nb_cell)) {
+                        if (new_vert_mapping[nb] >= 0 ||
+                            (vertices_[nb] - vertices_[vidx]).squaredNorm() >=
+                                    eps2) {
+                            continue;
+                        }
+                        vertex += vertices_[nb];
+                        if (has_vertex_normals) {
+                            normal += vertex_normals_[nb];
+                        }
+                        if (has_vertex_colors) {
+                            color += vertex_colors_[nb];
+                        }
+                        new_vert_mapping[nb] = new_vidx;
+                        n += 1;
+                    }
+                }
             }
-            new_vert_mapping[nb] = new_vidx;
-            n += 1;
         }
         new_vertices.push_back(vertex / n);
         if (has_vertex_normals) {
@@ -969,15 +1448,14 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     std::swap(vertex_normals_, new_vertex_normals);
     std::swap(vertex_colors_, new_vertex_colors);
 
-    for (auto &triangle : triangles_) {
-        triangle(0) = new_vert_mapping[triangle(0)];
-        triangle(1) = new_vert_mapping[triangle(1)];
-        triangle(2) = new_vert_mapping[triangle(2)];
-    }
+    RemapTriangles(triangles_, new_vert_mapping);
 
     if (HasTriangleNormals()) {
         ComputeTriangleNormals();
     }
+    if (has_adjacency_list) {
+        ComputeAdjacencyList();
+    }
 
     return *this;
 }
@@ -1375,59 +1853,65 @@ TriangleMesh::ClusterConnectedTriangles() const {
     std::vector<double> areas;
 
     utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
+    // Sorting all triangle edges makes triangles that share an edge adjacent
+    // in the edge list.
+    struct EdgeKey {
+        int v0, v1, tidx;
+        bool operator<(const EdgeKey &other) const {
+            return std::tie(v0, v1, tidx) <
+                   std::tie(other.v0, other.v1, other.tidx);
         }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
+    };
+    int num_triangles_total = int(triangles_.size());
+    std::vector<EdgeKey> edges(3 * triangles_.size());
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < num_triangles_total; ++tidx) {
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        for (int i = 0; i < 3; ++i) {
+            int v0 = triangle(i);
+            int v1 = triangle((i + 1) % 3);
+            edges[3 * tidx + i] = {std::min(v0, v1), std::max(v0, v1), tidx};
         }
     }
+    utility::ParallelSort(edges.begin(), edges.end());
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done computing triangle adjacency");
 
-    int cluster_idx = 0;
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        if (triangle_clusters[tidx] != -1) {
-            continue;
+    ConcurrentDisjointSet disjoint_set(num_triangles_total);
+#pragma omp parallel for schedule(static)
+    for (int eidx = 1; eidx < int(edges.size()); ++eidx) {
+        const EdgeKey &edge = edges[eidx];
+        const EdgeKey &prev_edge = edges[eidx - 1];
+        if (edge.v0 == prev_edge.v0 && edge.v1 == prev_edge.v1) {
+            disjoint_set.Union(prev_edge.tidx, edge.tidx);
         }
+    }
 
-        std::queue<int> triangle_queue;
-        int cluster_n_triangles = 0;
-        double cluster_area = 0;
-
-        triangle_queue.push(tidx);
-        triangle_clusters[tidx] = cluster_idx;
-        while (!triangle_queue.empty()) {
-            tidx = triangle_queue.front();
-            triangle_queue.pop();
-
-            cluster_n_triangles++;
-            cluster_area += GetTriangleArea(tidx);
-
-            for (auto tnb : adjacency_list[tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
-                }
-            }
+    // The representative of a cluster is its smallest triangle index, numbering
+    // the representatives in ascending order yields the cluster indices.
+    std::vector<int> roots(triangles_.size());
+    std::vector<double> triangle_areas(triangles_.size());
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < num_triangles_total; ++tidx) {
+        roots[tidx] = disjoint_set.Find(tidx);
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    }
+    int cluster_idx = 0;
+    for (int tidx = 0; tidx < num_triangles_total; ++tidx) {
+        if (roots[tidx] == tidx) {
+            triangle_clusters[tidx] = cluster_idx++;
         }
+    }
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < num_triangles_total; ++tidx) {
+        triangle_clusters[tidx] = triangle_clusters[roots[tidx]];
+    }
 
-        num_triangles.push_back(cluster_n_triangles);
-        areas.push_back(cluster_area);
-        cluster_idx++;
+    num_triangles.resize(cluster_idx, 0);
+    areas.resize(cluster_idx, 0);
+    for (int tidx = 0; tidx < num_triangles_total; ++tidx) {
+        num_triangles[triangle_clusters[tidx]]++;
+        areas[triangle_clusters[tidx]] += triangle_areas[tidx];
     }
 
     utility::LogDebug(
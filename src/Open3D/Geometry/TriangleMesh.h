@@ -152,6 +152,16 @@ public:
     /// They are usually the product of removing duplicated vertices.
     TriangleMesh &RemoveDegenerateTriangles();
 
+    /// \brief Function that combines RemoveDuplicatedVertices,
+    /// RemoveDegenerateTriangles, RemoveDuplicatedTriangles and
+    /// RemoveUnreferencedVertices (applied in this order).
+    ///
+    /// In contrast to calling the four functions in sequence, the vertices
+    /// and triangles are compacted only once and the adjacency list is
+    /// recomputed at most once. Triangle uvs and material ids are kept in
+    /// sync with the remaining triangles.
+    TriangleMesh &CleanMesh();
+
     /// \brief Function that removes all non-manifold edges, by successively
     /// deleting triangles with the smallest surface area adjacent to the
     /// non-manifold edge until the number of adjacent triangles to the edge is
@@ -162,6 +172,11 @@ public:
     /// The vertex position, normal and color will be the average of the
     /// vertices.
     ///
+    /// Vertices are visited in index order and every vertex that is not yet
+    /// merged absorbs all not yet merged vertices closer than eps. The
+    /// neighbours are found with a uniform grid of cell size eps, hence the
+    /// memory is linear in the number of vertices.
+    ///
     /// \param eps defines the maximum distance of close by vertices.
     /// This function might help to close triangle soups.
     TriangleMesh &MergeCloseVertices(double eps);
@@ -223,6 +238,46 @@ public:
             double mu = -0.53,
             FilterScope scope = FilterScope::All) const;
 
+    /// \brief In-place version of FilterSharpen.
+    ///
+    /// \param vertex_indices If not empty, only the listed vertices are
+    /// filtered, all other vertices keep their values.
+    TriangleMesh &FilterSharpenInPlace(
+            int number_of_iterations,
+            double strength,
+            FilterScope scope = FilterScope::All,
+            const std::vector<size_t> &vertex_indices = std::vector<size_t>());
+
+    /// \brief In-place version of FilterSmoothSimple.
+    ///
+    /// \param vertex_indices If not empty, only the listed vertices are
+    /// filtered, all other vertices keep their values.
+    TriangleMesh &FilterSmoothSimpleInPlace(
+            int number_of_iterations,
+            FilterScope scope = FilterScope::All,
+            const std::vector<size_t> &vertex_indices = std::vector<size_t>());
+
+    /// \brief In-place version of FilterSmoothLaplacian.
+    ///
+    /// \param vertex_indices If not empty, only the listed vertices are
+    /// filtered, all other vertices keep their values.
+    TriangleMesh &FilterSmoothLaplacianInPlace(
+            int number_of_iterations,
+            double lambda,
+            FilterScope scope = FilterScope::All,
+            const std::vector<size_t> &vertex_indices = std::vector<size_t>());
+
+    /// \brief In-place version of FilterSmoothTaubin.
+    ///
+    /// \param vertex_indices If not empty, only the listed vertices are
+    /// filtered, all other vertices keep their values.
+    TriangleMesh &FilterSmoothTaubinInPlace(
+            int number_of_iterations,
+            double lambda = 0.5,
+            double mu = -0.53,
+            FilterScope scope = FilterScope::All,
+            const std::vector<size_t> &vertex_indices = std::vector<size_t>());
+
     /// Function that computes the Euler-Poincaré characteristic, i.e.,
     /// V + F - E, where V is the number of vertices, F is the number
     /// of triangles, and E is the number of edges.
@@ -344,20 +399,27 @@ public:
     }
 
     /// Function to sample \param number_of_points points uniformly from the
-    /// mesh.
+    /// mesh. The triangles are sampled in parallel, each one from its own
+    /// random stream derived from \param seed, a negative seed draws a
+    /// random one.
     std::shared_ptr<PointCloud> SamplePointsUniformlyImpl(
             size_t number_of_points,
             std::vector<double> &triangle_areas,
             double surface_area,
-            bool use_triangle_normal);
+            bool use_triangle_normal,
+            int seed);
 
     /// Function to sample \param number_of_points points uniformly from the
     /// mesh. \param use_triangle_normal Set to true to assign the triangle
     /// normals to the returned points instead of the interpolated vertex
     /// normals. The triangle normals will be computed and added to the mesh
-    /// if necessary.
+    /// if necessary. \param seed Seed of the random number generator, the
+    /// samples are reproducible for a given non-negative seed independent of
+    /// the number of threads. A negative seed draws a random one.
     std::shared_ptr<PointCloud> SamplePointsUniformly(
-            size_t number_of_points, bool use_triangle_normal = false);
+            size_t number_of_points,
+            bool use_triangle_normal = false,
+            int seed = -1);
 
     /// Function to sample \param number_of_points points (blue noise).
     /// Based on the method presented in Yuksel, "Sample Elimination for
@@ -368,12 +430,16 @@ public:
     /// \param use_triangle_normal Set to true to assign the triangle
     /// normals to the returned points instead of the interpolated vertex
     /// normals. The triangle normals will be computed and added to the mesh
-    /// if necessary.
+    /// if necessary. \param seed Seed for the initial uniform sampling, a
+    /// negative seed draws a random one.
+    /// The elimination hashes the samples into a grid and removes samples of
+    /// non-adjacent cells in parallel, its result is deterministic.
     std::shared_ptr<PointCloud> SamplePointsPoissonDisk(
             size_t number_of_points,
             double init_factor = 5,
             const std::shared_ptr<PointCloud> pcl_init = nullptr,
-            bool use_triangle_normal = false);
+            bool use_triangle_normal = false,
+            int seed = -1);
 
     /// Function to subdivide triangle mesh using the simple midpoint algorithm.
     /// Each triangle is subdivided into four triangles per iteration and the
@@ -687,16 +753,9 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
-    void FilterSmoothLaplacianHelper(
-            std::shared_ptr<TriangleMesh> &mesh,
-            const std::vector<Eigen::Vector3d> &prev_vertices,
-            const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-            const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
-            double lambda,
-            bool filter_vertex,
-            bool filter_normal,
-            bool filter_color) const;
+    /// Returns a mesh with the vertices, vertex attributes, triangles and
+    /// adjacency list of this mesh, used as output of the Filter* functions.
+    std::shared_ptr<TriangleMesh> CreateFilterOutputMesh() const;
 
     /// \brief Function that computes for each edge in the triangle mesh and
     /// passed as parameter edges_to_vertices the cot weight.
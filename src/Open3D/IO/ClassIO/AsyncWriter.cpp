@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/AsyncWriter.h"
+
+#include <algorithm>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+
+namespace open3d {
+namespace io {
+
+AsyncWriter::AsyncWriter(int num_threads /* = 1*/,
+                         size_t max_queue_size /* = 4*/)
+    : queue_(std::max(num_threads, 1), max_queue_size) {}
+
+AsyncWriter::~AsyncWriter() {}
+
+std::future<bool> AsyncWriter::WritePointCloud(
+        const std::string &filename,
+        const geometry::PointCloud &pointcloud,
+        bool write_ascii /* = false*/,
+        bool compressed /* = false*/) {
+    return WritePointCloud(filename,
+                           std::make_shared<geometry::PointCloud>(pointcloud),
+                           write_ascii, compressed);
+}
+
+std::future<bool> AsyncWriter::WritePointCloud(
+        const std::string &filename,
+        std::shared_ptr<const geometry::PointCloud> pointcloud,
+        bool write_ascii /* = false*/,
+        bool compressed /* = false*/) {
+    return queue_.Push([filename, pointcloud, write_ascii, compressed] {
+        return io::WritePointCloud(filename, *pointcloud, write_ascii,
+                                   compressed);
+    });
+}
+
+std::future<bool> AsyncWriter::WriteTriangleMesh(
+        const std::string &filename,
+        const geometry::TriangleMesh &mesh,
+        bool write_ascii /* = false*/,
+        bool compressed /* = false*/,
+        bool write_vertex_normals /* = true*/,
+        bool write_vertex_colors /* = true*/,
+        bool write_triangle_uvs /* = true*/) {
+    return WriteTriangleMesh(filename,
+                             std::make_shared<geometry::TriangleMesh>(mesh),
+                             write_ascii, compressed, write_vertex_normals,
+                             write_vertex_colors, write_triangle_uvs);
+}
+
+std::future<bool> AsyncWriter::WriteTriangleMesh(
+        const std::string &filename,
+        std::shared_ptr<const geometry::TriangleMesh> mesh,
+        bool write_ascii /* = false*/,
+        bool compressed /* = false*/,
+        bool write_vertex_normals /* = true*/,
+        bool write_vertex_colors /* = true*/,
+        bool write_triangle_uvs /* = true*/) {
+    return queue_.Push([filename, mesh, write_ascii, compressed,
+                        write_vertex_normals, write_vertex_colors,
+                        write_triangle_uvs] {
+        return io::WriteTriangleMesh(filename, *mesh, write_ascii, compressed,
+                                     write_vertex_normals, write_vertex_colors,
+                                     write_triangle_uvs);
+    });
+}
+
+std::future<bool> AsyncWriter::WriteImage(const std::string &filename,
+                                          const geometry::Image &image,
+                                          int quality /* = 90*/) {
+    return WriteImage(filename, std::make_shared<geometry::Image>(image),
+                      quality);
+}
+
+std::future<bool> AsyncWriter::WriteImage(
+        const std::string &filename,
+        std::shared_ptr<const geometry::Image> image,
+        int quality /* = 90*/) {
+    return queue_.Push([filename, image, quality] {
+        return io::WriteImage(filename, *image, quality);
+    });
+}
+
+}  // namespace io
+}  // namespace open3d
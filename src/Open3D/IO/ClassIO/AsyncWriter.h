@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <string>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+/// \class AsyncWriter
+///
+/// \brief Writes geometries to files on background I/O threads.
+///
+/// Each write returns a future that holds the result of the corresponding
+/// blocking write function, or the exception it threw. Geometries passed by
+/// reference are copied before the call returns; geometries passed as
+/// shared pointers are written without a copy and must not be modified
+/// until the write has finished. If \p max_queue_size writes are waiting to
+/// be started, further writes block the caller until one of them starts.
+/// Destroying the writer waits for all pending writes.
+class AsyncWriter {
+public:
+    /// \param num_threads Number of I/O threads.
+    /// \param max_queue_size Maximum number of writes waiting to be started.
+    AsyncWriter(int num_threads = 1, size_t max_queue_size = 4);
+    ~AsyncWriter();
+    AsyncWriter(const AsyncWriter &) = delete;
+    AsyncWriter &operator=(const AsyncWriter &) = delete;
+
+public:
+    /// Asynchronous version of WritePointCloud, see PointCloudIO.h.
+    std::future<bool> WritePointCloud(const std::string &filename,
+                                      const geometry::PointCloud &pointcloud,
+                                      bool write_ascii = false,
+                                      bool compressed = false);
+    std::future<bool> WritePointCloud(
+            const std::string &filename,
+            std::shared_ptr<const geometry::PointCloud> pointcloud,
+            bool write_ascii = false,
+            bool compressed = false);
+
+    /// Asynchronous version of WriteTriangleMesh, see TriangleMeshIO.h.
+    std::future<bool> WriteTriangleMesh(const std::string &filename,
+                                        const geometry::TriangleMesh &mesh,
+                                        bool write_ascii = false,
+                                        bool compressed = false,
+                                        bool write_vertex_normals = true,
+                                        bool write_vertex_colors = true,
+                                        bool write_triangle_uvs = true);
+    std::future<bool> WriteTriangleMesh(
+            const std::string &filename,
+            std::shared_ptr<const geometry::TriangleMesh> mesh,
+            bool write_ascii = false,
+            bool compressed = false,
+            bool write_vertex_normals = true,
+            bool write_vertex_colors = true,
+            bool write_triangle_uvs = true);
+
+    /// Asynchronous version of WriteImage, see ImageIO.h.
+    std::future<bool> WriteImage(const std::string &filename,
+                                 const geometry::Image &image,
+                                 int quality = 90);
+    std::future<bool> WriteImage(const std::string &filename,
+                                 std::shared_ptr<const geometry::Image> image,
+                                 int quality = 90);
+
+    /// Blocks until all pending writes are finished.
+    void Wait() { queue_.Wait(); }
+    /// Number of writes that are waiting or running.
+    size_t GetNumPending() { return queue_.GetNumPending(); }
+
+private:
+    utility::TaskQueue queue_;
+};
+
+}  // namespace io
+}  // namespace open3d
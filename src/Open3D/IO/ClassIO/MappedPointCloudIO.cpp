@@ -0,0 +1,373 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/MappedPointCloudIO.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &, MappedPointCloudLayout &)>>
+        file_extension_to_mapped_layout_read_function{
+                {"ply", ReadMappedPointCloudLayoutFromPLY},
+                {"pcd", ReadMappedPointCloudLayoutFromPCD},
+        };
+
+size_t GetScalarSize(MappedPointCloudLayout::ScalarType type) {
+    switch (type) {
+        case MappedPointCloudLayout::ScalarType::Int8:
+        case MappedPointCloudLayout::ScalarType::UInt8:
+            return 1;
+        case MappedPointCloudLayout::ScalarType::Int16:
+        case MappedPointCloudLayout::ScalarType::UInt16:
+            return 2;
+        case MappedPointCloudLayout::ScalarType::Int32:
+        case MappedPointCloudLayout::ScalarType::UInt32:
+        case MappedPointCloudLayout::ScalarType::Float32:
+            return 4;
+        default:
+            return 8;
+    }
+}
+
+/// Checks that the last scalar of \p field lies within the file.
+bool IsFieldInFile(const MappedPointCloudLayout::Field &field,
+                   size_t num_points,
+                   uint64_t file_size) {
+    if (num_points == 0) {
+        return true;
+    }
+    const uint64_t scalar_size = GetScalarSize(field.type);
+    if (field.offset > file_size || scalar_size > file_size - field.offset) {
+        return false;
+    }
+    return field.stride == 0 ||
+           uint64_t(num_points - 1) <=
+                   (file_size - field.offset - scalar_size) / field.stride;
+}
+
+template <typename T>
+void ConvertField(const uint8_t *data,
+                  uint64_t stride,
+                  int64_t count,
+                  double divisor,
+                  Eigen::Vector3d *values,
+                  int dim) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < count; i++) {
+        T value;
+        memcpy(&value, data + i * stride, sizeof(T));
+        values[i](dim) = double(value) / divisor;
+    }
+}
+
+void ConvertField(const uint8_t *file_data,
+                  const MappedPointCloudLayout::Field &field,
+                  size_t first,
+                  size_t count,
+                  double divisor,
+                  std::vector<Eigen::Vector3d> &values,
+                  int dim) {
+    typedef MappedPointCloudLayout::ScalarType ScalarType;
+    const uint8_t *data = file_data + field.offset + first * field.stride;
+    switch (field.type) {
+        case ScalarType::Int8:
+            ConvertField<int8_t>(data, field.stride, int64_t(count), divisor,
+                                 values.data(), dim);
+            break;
+        case ScalarType::UInt8:
+            ConvertField<uint8_t>(data, field.stride, int64_t(count), divisor,
+                                  values.data(), dim);
+            break;
+        case ScalarType::Int16:
+            ConvertField<int16_t>(data, field.stride, int64_t(count), divisor,
+                                  values.data(), dim);
+            break;
+        case ScalarType::UInt16:
+            ConvertField<uint16_t>(data, field.stride, int64_t(count),
+                                   divisor, values.data(), dim);
+            break;
+        case ScalarType::Int32:
+            ConvertField<int32_t>(data, field.stride, int64_t(count), divisor,
+                                  values.data(), dim);
+            break;
+        case ScalarType::UInt32:
+            ConvertField<uint32_t>(data, field.stride, int64_t(count),
+                                   divisor, values.data(), dim);
+            break;
+        case ScalarType::Float32:
+            ConvertField<float>(data, field.stride, int64_t(count), divisor,
+                                values.data(), dim);
+            break;
+        case ScalarType::Float64:
+            ConvertField<double>(data, field.stride, int64_t(count), divisor,
+                                 values.data(), dim);
+            break;
+    }
+}
+
+/// Running sums of the points in a voxel, as in PointCloud::VoxelDownSample.
+class AccumulatedPoint {
+public:
+    AccumulatedPoint()
+        : num_of_points_(0),
+          point_(0.0, 0.0, 0.0),
+          normal_(0.0, 0.0, 0.0),
+          color_(0.0, 0.0, 0.0) {}
+
+public:
+    void AddPoint(const geometry::PointCloud &cloud, size_t index) {
+        point_ += cloud.points_[index];
+        if (cloud.HasNormals()) {
+            if (!std::isnan(cloud.normals_[index](0)) &&
+                !std::isnan(cloud.normals_[index](1)) &&
+                !std::isnan(cloud.normals_[index](2))) {
+                normal_ += cloud.normals_[index];
+            }
+        }
+        if (cloud.HasColors()) {
+            color_ += cloud.colors_[index];
+        }
+        num_of_points_++;
+    }
+
+public:
+    int num_of_points_;
+    Eigen::Vector3d point_;
+    Eigen::Vector3d normal_;
+    Eigen::Vector3d color_;
+};
+
+}  // unnamed namespace
+
+namespace io {
+
+MappedPointCloud::MappedPointCloud(size_t chunk_size /* = 1 << 20*/)
+    : chunk_size_(std::max(chunk_size, size_t(1))), data_(nullptr) {
+    layout_.num_points = 0;
+    layout_.has_normals = false;
+    layout_.has_colors = false;
+}
+
+MappedPointCloud::~MappedPointCloud() {}
+
+bool MappedPointCloud::Open(const std::string &filename) {
+    Close();
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr = file_extension_to_mapped_layout_read_function.find(
+            filename_ext);
+    if (map_itr == file_extension_to_mapped_layout_read_function.end()) {
+        utility::LogWarning(
+                "Map point cloud failed: unsupported file extension {}.",
+                filename_ext);
+        return false;
+    }
+    MappedPointCloudLayout layout;
+    if (!map_itr->second(filename, layout)) {
+        utility::LogWarning(
+                "Map point cloud failed: {} is not an uncompressed binary "
+                "file.",
+                filename);
+        return false;
+    }
+    if (!file_.Map(filename)) {
+        utility::LogWarning("Map point cloud failed: unable to map file: {}",
+                            filename);
+        return false;
+    }
+    for (int i = 0; i < 3; i++) {
+        if (!IsFieldInFile(layout.points[i], layout.num_points,
+                           file_.GetSize()) ||
+            (layout.has_normals &&
+             !IsFieldInFile(layout.normals[i], layout.num_points,
+                            file_.GetSize())) ||
+            (layout.has_colors &&
+             !IsFieldInFile(layout.colors[i], layout.num_points,
+                            file_.GetSize()))) {
+            utility::LogWarning("Map point cloud failed: {} is truncated.",
+                                filename);
+            file_.Unmap();
+            return false;
+        }
+    }
+    data_ = reinterpret_cast<const uint8_t *>(file_.GetData());
+    layout_ = layout;
+    return true;
+}
+
+void MappedPointCloud::Close() {
+    file_.Unmap();
+    data_ = nullptr;
+    layout_.num_points = 0;
+    layout_.has_normals = false;
+    layout_.has_colors = false;
+}
+
+bool MappedPointCloud::ReadChunk(size_t first,
+                                 size_t count,
+                                 geometry::PointCloud &chunk) const {
+    if (first >= GetNumPoints()) {
+        utility::LogWarning("Point {} exceeds the number of points {}.", first,
+                            GetNumPoints());
+        return false;
+    }
+    ConvertChunk(first, std::min(count, GetNumPoints() - first), true, chunk);
+    return true;
+}
+
+void MappedPointCloud::ConvertChunk(size_t first,
+                                    size_t count,
+                                    bool with_attributes,
+                                    geometry::PointCloud &chunk) const {
+    chunk.points_.resize(count);
+    chunk.normals_.resize(with_attributes && HasNormals() ? count : 0);
+    chunk.colors_.resize(with_attributes && HasColors() ? count : 0);
+    for (int i = 0; i < 3; i++) {
+        ConvertField(data_, layout_.points[i], first, count, 1.0,
+                     chunk.points_, i);
+        if (chunk.HasNormals()) {
+            ConvertField(data_, layout_.normals[i], first, count, 1.0,
+                         chunk.normals_, i);
+        }
+        if (chunk.HasColors()) {
+            ConvertField(data_, layout_.colors[i], first, count, 255.0,
+                         chunk.colors_, i);
+        }
+    }
+}
+
+geometry::AxisAlignedBoundingBox MappedPointCloud::GetAxisAlignedBoundingBox()
+        const {
+    if (GetNumPoints() == 0) {
+        return geometry::AxisAlignedBoundingBox();
+    }
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound = -min_bound;
+    geometry::PointCloud chunk;
+    for (size_t first = 0; first < GetNumPoints(); first += chunk_size_) {
+        ConvertChunk(first, std::min(chunk_size_, GetNumPoints() - first),
+                     false, chunk);
+        min_bound = min_bound.array().min(chunk.GetMinBound().array());
+        max_bound = max_bound.array().max(chunk.GetMaxBound().array());
+    }
+    return geometry::AxisAlignedBoundingBox(min_bound, max_bound);
+}
+
+std::shared_ptr<geometry::PointCloud> MappedPointCloud::Crop(
+        const geometry::AxisAlignedBoundingBox &bbox) const {
+    if (bbox.IsEmpty()) {
+        utility::LogError(
+                "[CropPointCloud] AxisAlignedBoundingBox either has zeros "
+                "size, or has wrong bounds.");
+    }
+    auto output = std::make_shared<geometry::PointCloud>();
+    geometry::PointCloud chunk;
+    for (size_t first = 0; first < GetNumPoints(); first += chunk_size_) {
+        ConvertChunk(first, std::min(chunk_size_, GetNumPoints() - first),
+                     true, chunk);
+        for (size_t i : bbox.GetPointIndicesWithinBoundingBox(chunk.points_)) {
+            output->points_.push_back(chunk.points_[i]);
+            if (chunk.HasNormals()) {
+                output->normals_.push_back(chunk.normals_[i]);
+            }
+            if (chunk.HasColors()) {
+                output->colors_.push_back(chunk.colors_[i]);
+            }
+        }
+    }
+    return output;
+}
+
+std::shared_ptr<geometry::PointCloud> MappedPointCloud::VoxelDownSample(
+        double voxel_size) const {
+    auto output = std::make_shared<geometry::PointCloud>();
+    if (voxel_size <= 0.0) {
+        utility::LogError("[VoxelDownSample] voxel_size <= 0.");
+    }
+    // the first pass finds the bounds the voxels are anchored at
+    const geometry::AxisAlignedBoundingBox bbox = GetAxisAlignedBoundingBox();
+    Eigen::Vector3d voxel_size3 =
+            Eigen::Vector3d(voxel_size, voxel_size, voxel_size);
+    Eigen::Vector3d voxel_min_bound = bbox.min_bound_ - voxel_size3 * 0.5;
+    Eigen::Vector3d voxel_max_bound = bbox.max_bound_ + voxel_size3 * 0.5;
+    if (voxel_size * std::numeric_limits<int>::max() <
+        (voxel_max_bound - voxel_min_bound).maxCoeff()) {
+        utility::LogError("[VoxelDownSample] voxel_size is too small.");
+    }
+    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            voxelindex_to_accpoint;
+    geometry::PointCloud chunk;
+    Eigen::Vector3d ref_coord;
+    Eigen::Vector3i voxel_index;
+    for (size_t first = 0; first < GetNumPoints(); first += chunk_size_) {
+        ConvertChunk(first, std::min(chunk_size_, GetNumPoints() - first),
+                     true, chunk);
+        for (size_t i = 0; i < chunk.points_.size(); i++) {
+            ref_coord = (chunk.points_[i] - voxel_min_bound) / voxel_size;
+            voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
+                    int(floor(ref_coord(2)));
+            voxelindex_to_accpoint[voxel_index].AddPoint(chunk, i);
+        }
+    }
+    for (const auto &accpoint : voxelindex_to_accpoint) {
+        const AccumulatedPoint &point = accpoint.second;
+        output->points_.push_back(point.point_ /
+                                  double(point.num_of_points_));
+        if (HasNormals()) {
+            output->normals_.push_back(point.normal_.normalized());
+        }
+        if (HasColors()) {
+            output->colors_.push_back(point.color_ /
+                                      double(point.num_of_points_));
+        }
+    }
+    utility::LogDebug(
+            "Pointcloud down sampled from {:d} points to {:d} points.",
+            GetNumPoints(), output->points_.size());
+    return output;
+}
+
+}  // namespace io
+}  // namespace open3d
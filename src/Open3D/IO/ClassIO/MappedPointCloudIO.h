@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+/// \struct MappedPointCloudLayout
+///
+/// \brief Location of the point attributes in an uncompressed binary file.
+///
+/// Component d of an attribute of point i is a scalar of type fields[d].type
+/// at byte fields[d].offset + i * fields[d].stride of the file, so that both
+/// interleaved and columnar files can be described. Colors are divided by
+/// 255.
+struct MappedPointCloudLayout {
+    enum class ScalarType {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float32,
+        Float64,
+    };
+
+    struct Field {
+        ScalarType type;
+        uint64_t offset;
+        uint64_t stride;
+    };
+
+    size_t num_points;
+    Field points[3];
+    bool has_normals;
+    Field normals[3];
+    bool has_colors;
+    Field colors[3];
+};
+
+/// \class MappedPointCloud
+///
+/// \brief Point cloud stored in a memory mapped file.
+///
+/// Points are converted lazily, one chunk at a time, so that files larger
+/// than the memory can be processed in a single streaming pass. Binary
+/// little endian PLY files and binary (uncompressed) PCD files can be
+/// mapped.
+class MappedPointCloud {
+public:
+    /// \param chunk_size Number of points converted at once by the streaming
+    /// operations.
+    explicit MappedPointCloud(size_t chunk_size = 1 << 20);
+    virtual ~MappedPointCloud();
+    MappedPointCloud(const MappedPointCloud &) = delete;
+    MappedPointCloud &operator=(const MappedPointCloud &) = delete;
+
+public:
+    /// Map a point cloud file, the format is deduced from the extension.
+    bool Open(const std::string &filename);
+    void Close();
+    bool IsOpened() const { return data_ != nullptr; }
+    size_t GetNumPoints() const { return layout_.num_points; }
+    size_t GetChunkSize() const { return chunk_size_; }
+    bool HasNormals() const { return IsOpened() && layout_.has_normals; }
+    bool HasColors() const { return IsOpened() && layout_.has_colors; }
+    /// \brief Convert the points [first, first + count) into \p chunk.
+    ///
+    /// \p count is clipped to the number of points.
+    /// \return false if \p first is out of range.
+    bool ReadChunk(size_t first,
+                   size_t count,
+                   geometry::PointCloud &chunk) const;
+
+    /// Streaming version of geometry::PointCloud::GetAxisAlignedBoundingBox.
+    geometry::AxisAlignedBoundingBox GetAxisAlignedBoundingBox() const;
+    /// Streaming version of geometry::PointCloud::Crop, only the points in
+    /// the bounding box are kept in memory.
+    std::shared_ptr<geometry::PointCloud> Crop(
+            const geometry::AxisAlignedBoundingBox &bbox) const;
+    /// Streaming version of geometry::PointCloud::VoxelDownSample, only the
+    /// occupied voxels are kept in memory.
+    std::shared_ptr<geometry::PointCloud> VoxelDownSample(
+            double voxel_size) const;
+
+private:
+    void ConvertChunk(size_t first,
+                      size_t count,
+                      bool with_attributes,
+                      geometry::PointCloud &chunk) const;
+
+private:
+    size_t chunk_size_;
+    utility::filesystem::MappedFile file_;
+    const uint8_t *data_;
+    MappedPointCloudLayout layout_;
+};
+
+/// \brief Function to locate the vertices of a binary little endian PLY file.
+/// \return return false if the file is not a binary little endian PLY file
+/// with vertex coordinates.
+bool ReadMappedPointCloudLayoutFromPLY(const std::string &filename,
+                                       MappedPointCloudLayout &layout);
+
+/// \brief Function to locate the points of a binary PCD file.
+/// \return return false if the file is not an uncompressed binary PCD file.
+bool ReadMappedPointCloudLayoutFromPCD(const std::string &filename,
+                                       MappedPointCloudLayout &layout);
+
+}  // namespace io
+}  // namespace open3d
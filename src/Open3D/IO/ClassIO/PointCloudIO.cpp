@@ -25,12 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
 #include <unordered_map>
 
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
 
 namespace open3d {
 
@@ -47,6 +50,7 @@ static const std::unordered_map<
                 {"ply", ReadPointCloudFromPLY},
                 {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
+                {"o3dpc", ReadPointCloudFromO3DPC},
         };
 
 static const std::unordered_map<std::string,
@@ -62,7 +66,24 @@ static const std::unordered_map<std::string,
                 {"ply", WritePointCloudToPLY},
                 {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
+                {"o3dpc", WritePointCloudToO3DPC},
         };
+
+// Text is split into chunks of about this many bytes for parsing.
+const size_t kASCIIReadChunkSize = 1 << 20;
+// Points are formatted in chunks of this size.
+const size_t kASCIIWriteChunkSize = 1 << 16;
+
+// Returns the number of lines in [begin, end), an unterminated final line
+// counts if it is not empty.
+size_t CountLines(const char *begin, const char *end) {
+    size_t num_lines = size_t(std::count(begin, end, '\n'));
+    if (begin != end && *(end - 1) != '\n') {
+        num_lines++;
+    }
+    return num_lines;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -141,5 +162,186 @@ bool WritePointCloud(const std::string &filename,
     return success;
 }
 
+bool ReadPointCloudFromASCIIFile(
+        const std::string &filename,
+        const std::string &format_name,
+        geometry::PointCloud &pointcloud,
+        const std::function<void(const char *line_begin,
+                                 const char *line_end,
+                                 geometry::PointCloud &chunk)> &parse_line,
+        size_t first_line /* = 0*/,
+        size_t max_lines /* = size_t(-1)*/,
+        bool print_progress /* = false*/) {
+    utility::filesystem::MappedFile file;
+    if (!file.Map(filename)) {
+        utility::LogWarning("Read {} failed: unable to open file: {}",
+                            format_name, filename);
+        return false;
+    }
+    const char *data = file.GetData();
+    const size_t size = size_t(file.GetSize());
+
+    // chunks end after a line break so that no line is split
+    std::vector<size_t> chunk_begins(1, 0);
+    while (chunk_begins.back() < size) {
+        size_t chunk_end = chunk_begins.back() + kASCIIReadChunkSize;
+        if (chunk_end >= size) {
+            chunk_end = size;
+        } else {
+            const void *line_break = std::memchr(data + chunk_end - 1, '\n',
+                                                 size - chunk_end + 1);
+            chunk_end = line_break == nullptr
+                                ? size
+                                : size_t(static_cast<const char *>(
+                                                 line_break) -
+                                         data) + 1;
+        }
+        chunk_begins.push_back(chunk_end);
+    }
+    const int num_chunks = int(chunk_begins.size()) - 1;
+
+    // the line number of the first line of every chunk
+    std::vector<size_t> chunk_first_lines(num_chunks + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        chunk_first_lines[c + 1] = CountLines(data + chunk_begins[c],
+                                              data + chunk_begins[c + 1]);
+    }
+    for (int c = 0; c < num_chunks; c++) {
+        chunk_first_lines[c + 1] += chunk_first_lines[c];
+    }
+    const size_t last_line =
+            first_line + std::min(max_lines, chunk_first_lines.back());
+
+    std::vector<geometry::PointCloud> chunks(num_chunks);
+    utility::ConsoleProgressBar progress_bar(
+            size, "Reading " + format_name + " file: ", print_progress);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        if (chunk_first_lines[c + 1] > first_line &&
+            chunk_first_lines[c] < last_line) {
+            const char *line_begin = data + chunk_begins[c];
+            const char *chunk_end = data + chunk_begins[c + 1];
+            size_t line = chunk_first_lines[c];
+            while (line_begin != chunk_end && line < last_line) {
+                const char *line_end = static_cast<const char *>(std::memchr(
+                        line_begin, '\n', size_t(chunk_end - line_begin)));
+                if (line_end == nullptr) {
+                    line_end = chunk_end;
+                }
+                if (line >= first_line) {
+                    parse_line(line_begin, line_end, chunks[c]);
+                }
+                line_begin = line_end == chunk_end ? chunk_end : line_end + 1;
+                line++;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        { progress_bar += chunk_begins[c + 1] - chunk_begins[c]; }
+    }
+
+    // concatenate the chunks with a single allocation per attribute
+    std::vector<size_t> chunk_offsets(num_chunks + 1, 0);
+    bool has_normals = true;
+    bool has_colors = true;
+    bool is_empty = true;
+    for (int c = 0; c < num_chunks; c++) {
+        chunk_offsets[c + 1] = chunk_offsets[c] + chunks[c].points_.size();
+        if (!chunks[c].IsEmpty()) {
+            has_normals = has_normals && chunks[c].HasNormals();
+            has_colors = has_colors && chunks[c].HasColors();
+            is_empty = false;
+        }
+    }
+    pointcloud.Clear();
+    pointcloud.points_.resize(chunk_offsets.back());
+    if (!is_empty && has_normals) {
+        pointcloud.normals_.resize(chunk_offsets.back());
+    }
+    if (!is_empty && has_colors) {
+        pointcloud.colors_.resize(chunk_offsets.back());
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        const geometry::PointCloud &chunk = chunks[c];
+        std::copy(chunk.points_.begin(), chunk.points_.end(),
+                  pointcloud.points_.begin() + chunk_offsets[c]);
+        if (pointcloud.HasNormals()) {
+            std::copy(chunk.normals_.begin(), chunk.normals_.end(),
+                      pointcloud.normals_.begin() + chunk_offsets[c]);
+        }
+        if (pointcloud.HasColors()) {
+            std::copy(chunk.colors_.begin(), chunk.colors_.end(),
+                      pointcloud.colors_.begin() + chunk_offsets[c]);
+        }
+    }
+    return true;
+}
+
+bool WritePointCloudToASCIIFile(
+        const std::string &filename,
+        const std::string &format_name,
+        const std::string &header,
+        size_t num_points,
+        const std::function<void(size_t index, std::string &buffer)>
+                &format_point,
+        bool print_progress /* = false*/) {
+    FILE *file = utility::filesystem::FOpen(filename, "w");
+    if (file == NULL) {
+        utility::LogWarning("Write {} failed: unable to open file: {}",
+                            format_name, filename);
+        return false;
+    }
+    bool success = fwrite(header.data(), 1, header.size(), file) ==
+                   header.size();
+
+    // a few chunks per thread are formatted before they are written, which
+    // bounds the memory used for the text
+    const int num_chunks = (int)((num_points + kASCIIWriteChunkSize - 1) /
+                                 kASCIIWriteChunkSize);
+    const int num_chunks_per_batch = 4 * utility::GetMaxThreads();
+    std::vector<std::string> buffers(num_chunks_per_batch);
+    utility::ConsoleProgressBar progress_bar(
+            num_points, "Writing " + format_name + " file: ", print_progress);
+    for (int batch_begin = 0; batch_begin < num_chunks && success;
+         batch_begin += num_chunks_per_batch) {
+        const int batch_end =
+                std::min(batch_begin + num_chunks_per_batch, num_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int c = batch_begin; c < batch_end; c++) {
+            std::string &buffer = buffers[c - batch_begin];
+            buffer.clear();
+            const size_t end = std::min((c + 1) * kASCIIWriteChunkSize,
+                                        num_points);
+            for (size_t i = c * kASCIIWriteChunkSize; i < end; i++) {
+                format_point(i, buffer);
+            }
+        }
+        for (int c = batch_begin; c < batch_end && success; c++) {
+            const std::string &buffer = buffers[c - batch_begin];
+            success = fwrite(buffer.data(), 1, buffer.size(), file) ==
+                      buffer.size();
+        }
+        progress_bar += std::min(batch_end * kASCIIWriteChunkSize, num_points) -
+                        batch_begin * kASCIIWriteChunkSize;
+    }
+    if (!success) {
+        utility::LogWarning("Write {} failed: unable to write file: {}",
+                            format_name, filename);
+    }
+    fclose(file);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
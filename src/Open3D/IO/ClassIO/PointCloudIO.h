@@ -26,8 +26,10 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
+#include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
 
 namespace open3d {
@@ -121,5 +123,79 @@ bool WritePointCloudToPTS(const std::string &filename,
                           bool compressed = false,
                           bool print_progress = false);
 
+bool ReadPointCloudFromO3DPC(const std::string &filename,
+                             geometry::PointCloud &pointcloud,
+                             bool print_progress = false);
+
+/// \brief Function to write the native columnar point cloud format (.o3dpc).
+///
+/// Points are stored in chunks of 65536, with every attribute in a separate
+/// column and chunks encoded in parallel. Without \p compressed the columns
+/// are lossless. With \p compressed, positions are quantized with a maximum
+/// error of 2^-21 of the largest extent of the point cloud and bit packed,
+/// normals are stored as 16 bit octahedral coordinates and colors with 8 bits
+/// per channel.
+bool WritePointCloudToO3DPC(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            bool write_ascii = false,
+                            bool compressed = false,
+                            bool print_progress = false);
+
+/// \brief Function to write a compressed o3dpc file with a given position
+/// precision.
+///
+/// \param position_precision Maximum error of the stored positions. Normals
+/// and colors are compressed as by WritePointCloudToO3DPC. If the precision
+/// is not positive, all columns are stored losslessly.
+bool WriteQuantizedPointCloudToO3DPC(const std::string &filename,
+                                     const geometry::PointCloud &pointcloud,
+                                     double position_precision,
+                                     bool print_progress = false);
+
+/// \brief Function to read the points of an o3dpc file inside \p bbox.
+///
+/// Chunks whose bounds do not overlap the bounding box are not decoded.
+/// \return return true if the read function is successful, false otherwise.
+bool CropPointCloudFromO3DPC(const std::string &filename,
+                             const geometry::AxisAlignedBoundingBox &bbox,
+                             geometry::PointCloud &pointcloud,
+                             bool print_progress = false);
+
+/// \brief Function to read a line based ASCII point cloud file in parallel.
+///
+/// The file is memory mapped and split into chunks at line breaks, which are
+/// parsed concurrently. \p parse_line is called for the lines
+/// [first_line, first_line + max_lines) with the line break stripped, and
+/// appends the parsed point to the point cloud of its chunk. The chunks are
+/// concatenated in file order.
+/// \param format_name Name of the format used in warnings, e.g. "XYZ".
+/// \return return false if the file could not be mapped.
+bool ReadPointCloudFromASCIIFile(
+        const std::string &filename,
+        const std::string &format_name,
+        geometry::PointCloud &pointcloud,
+        const std::function<void(const char *line_begin,
+                                 const char *line_end,
+                                 geometry::PointCloud &chunk)> &parse_line,
+        size_t first_line = 0,
+        size_t max_lines = size_t(-1),
+        bool print_progress = false);
+
+/// \brief Function to write a line based ASCII point cloud file in parallel.
+///
+/// \p format_point appends the text of a point to the buffer of its chunk,
+/// the chunks are formatted concurrently and written in order after
+/// \p header.
+/// \param format_name Name of the format used in warnings, e.g. "XYZ".
+/// \return return true if the write function is successful, false otherwise.
+bool WritePointCloudToASCIIFile(
+        const std::string &filename,
+        const std::string &format_name,
+        const std::string &header,
+        size_t num_points,
+        const std::function<void(size_t index, std::string &buffer)>
+                &format_point,
+        bool print_progress = false);
+
 }  // namespace io
 }  // namespace open3d
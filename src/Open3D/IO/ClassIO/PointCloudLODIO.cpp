@@ -0,0 +1,868 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/PointCloudLODIO.h"
+
+#include <json/json.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+const char *kLODIndexFileName = "lod.json";
+// Depth of the grid that counts the points to split the cube into chunks.
+const int kLODCountingGridDepth = 7;
+// Points are read from the input in chunks of this size.
+const size_t kLODReadChunkSize = 1 << 20;
+
+typedef std::function<bool(size_t, size_t, geometry::PointCloud &)>
+        ReadChunkFunction;
+
+std::string GetNodeName(int depth, uint64_t code) {
+    std::string name(depth + 1, 'r');
+    for (int d = depth; d > 0; d--) {
+        name[d] = char('0' + (code & 7));
+        code >>= 3;
+    }
+    return name;
+}
+
+void GetNodeCube(const std::string &name,
+                 const Eigen::Vector3d &origin,
+                 double size,
+                 Eigen::Vector3d &node_origin,
+                 double &node_size) {
+    node_origin = origin;
+    node_size = size;
+    for (size_t i = 1; i < name.size(); i++) {
+        const int child_index = name[i] - '0';
+        node_size *= 0.5;
+        for (int j = 0; j < 3; j++) {
+            if ((child_index >> j) & 1) {
+                node_origin(j) += node_size;
+            }
+        }
+    }
+}
+
+/// Returns the cell of \p point in a grid with 2^depth cells along each side
+/// of the cube. The cells are numbered in Morton order, so that the cells of
+/// an octree node are consecutive.
+uint64_t GetMortonCode(const Eigen::Vector3d &point,
+                       const Eigen::Vector3d &origin,
+                       double size,
+                       int depth) {
+    const double resolution = double(int64_t(1) << depth);
+    uint64_t index[3];
+    for (int i = 0; i < 3; i++) {
+        double cell = std::floor((point(i) - origin(i)) / size * resolution);
+        index[i] = uint64_t(std::min(std::max(cell, 0.0), resolution - 1.0));
+    }
+    uint64_t code = 0;
+    for (int b = depth - 1; b >= 0; b--) {
+        code = (code << 3) | ((index[0] >> b) & 1) |
+               (((index[1] >> b) & 1) << 1) | (((index[2] >> b) & 1) << 2);
+    }
+    return code;
+}
+
+/// Temporary files hold records of a point count followed by the points,
+/// normals and colors as doubles, so that no precision is lost before the
+/// node files are written.
+bool WriteRawPoints(const std::string &filename,
+                    const geometry::PointCloud &pointcloud,
+                    bool append) {
+    FILE *file = utility::filesystem::FOpen(filename, append ? "ab" : "wb");
+    if (file == NULL) {
+        return false;
+    }
+    const uint64_t num_points = pointcloud.points_.size();
+    bool success = fwrite(&num_points, sizeof(uint64_t), 1, file) == 1 &&
+                   fwrite(pointcloud.points_.data(), sizeof(Eigen::Vector3d),
+                          num_points, file) == num_points;
+    if (pointcloud.HasNormals()) {
+        success = success && fwrite(pointcloud.normals_.data(),
+                                    sizeof(Eigen::Vector3d), num_points,
+                                    file) == num_points;
+    }
+    if (pointcloud.HasColors()) {
+        success = success && fwrite(pointcloud.colors_.data(),
+                                    sizeof(Eigen::Vector3d), num_points,
+                                    file) == num_points;
+    }
+    return fclose(file) == 0 && success;
+}
+
+bool ReadRawPoints(const std::string &filename,
+                   bool has_normals,
+                   bool has_colors,
+                   geometry::PointCloud &pointcloud) {
+    pointcloud.Clear();
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    bool success = true;
+    uint64_t num_points;
+    while (success && fread(&num_points, sizeof(uint64_t), 1, file) == 1) {
+        const size_t offset = pointcloud.points_.size();
+        pointcloud.points_.resize(offset + num_points);
+        success = fread(pointcloud.points_.data() + offset,
+                        sizeof(Eigen::Vector3d), num_points,
+                        file) == num_points;
+        if (has_normals) {
+            pointcloud.normals_.resize(offset + num_points);
+            success = success && fread(pointcloud.normals_.data() + offset,
+                                       sizeof(Eigen::Vector3d), num_points,
+                                       file) == num_points;
+        }
+        if (has_colors) {
+            pointcloud.colors_.resize(offset + num_points);
+            success = success && fread(pointcloud.colors_.data() + offset,
+                                       sizeof(Eigen::Vector3d), num_points,
+                                       file) == num_points;
+        }
+    }
+    fclose(file);
+    return success;
+}
+
+/// Returns the points closest to the centers of the occupied sampling cells
+/// of a node, in increasing order.
+std::vector<size_t> SamplePoints(const std::vector<Eigen::Vector3d> &points,
+                                 const std::vector<size_t> &indices,
+                                 const Eigen::Vector3d &node_origin,
+                                 double node_size,
+                                 int resolution) {
+    const double cell_size = node_size / resolution;
+    std::unordered_map<uint64_t, std::pair<size_t, double>> cells;
+    for (size_t i : indices) {
+        const Eigen::Vector3d cell = (points[i] - node_origin) / cell_size;
+        uint64_t key = 0;
+        double distance2 = 0.0;
+        for (int j = 0; j < 3; j++) {
+            double cell_index = std::min(std::max(std::floor(cell(j)), 0.0),
+                                         double(resolution - 1));
+            key = key * resolution + uint64_t(cell_index);
+            double offset = cell(j) - cell_index - 0.5;
+            distance2 += offset * offset;
+        }
+        auto it = cells.find(key);
+        if (it == cells.end()) {
+            cells.emplace(key, std::make_pair(i, distance2));
+        } else if (distance2 < it->second.second) {
+            it->second = std::make_pair(i, distance2);
+        }
+    }
+    std::vector<size_t> samples;
+    samples.reserve(cells.size());
+    for (const auto &cell : cells) {
+        samples.push_back(cell.second.first);
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples;
+}
+
+/// Builds the octree out of core: the points are counted in a grid, split
+/// into chunks of at most max_chunk_points_ points on disk, and the subtree
+/// of every chunk is built in memory by one thread. The nodes above the
+/// chunks are sampled from their children level by level.
+class PointCloudLODWriter {
+public:
+    PointCloudLODWriter(const std::string &directory,
+                        const PointCloudLODOption &option,
+                        const geometry::AxisAlignedBoundingBox &bbox,
+                        bool has_normals,
+                        bool has_colors)
+        : directory_(utility::filesystem::GetRegularizedDirectoryName(
+                  directory)),
+          tmp_directory_(directory_ + "tmp/"),
+          option_(option),
+          has_normals_(has_normals),
+          has_colors_(has_colors) {
+        origin_ = bbox.min_bound_;
+        size_ = bbox.GetMaxExtent();
+        if (!(size_ > 0.0)) {
+            size_ = 1.0;
+        }
+    }
+
+    bool Write(size_t num_points,
+               const ReadChunkFunction &read_chunk,
+               bool print_progress) {
+        if (!utility::filesystem::MakeDirectoryHierarchy(tmp_directory_)) {
+            utility::LogWarning("Write LOD failed: unable to create {}.",
+                                tmp_directory_);
+            return false;
+        }
+        utility::ConsoleProgressBar progress_bar(2 * num_points + 1,
+                                                 "Writing LOD: ",
+                                                 print_progress);
+        std::vector<std::pair<int, uint64_t>> chunks;
+        std::vector<int> cell_chunks;
+        std::vector<size_t> node_points;
+        bool success = SplitChunks(num_points, read_chunk, chunks,
+                                   cell_chunks, progress_bar) &&
+                       DistributePoints(num_points, read_chunk, chunks,
+                                        cell_chunks, progress_bar) &&
+                       BuildChunks(chunks) && BuildUpperNodes() &&
+                       WritePendingNodes();
+        RemoveTmpDirectory();
+        if (!success) {
+            return false;
+        }
+
+        PointCloudLODIndex index;
+        index.origin_ = origin_;
+        index.size_ = size_;
+        index.sampling_resolution_ = option_.sampling_resolution_;
+        index.format_ = option_.format_;
+        index.num_points_ = num_points;
+        index.has_normals_ = has_normals_;
+        index.has_colors_ = has_colors_;
+        // nodes without points are only kept as parents
+        std::unordered_set<std::string> parents;
+        for (const auto &node : nodes_) {
+            if (node.second > 0) {
+                for (size_t i = 1; i <= node.first.size(); i++) {
+                    parents.insert(node.first.substr(0, i));
+                }
+            }
+        }
+        for (const auto &node : nodes_) {
+            if (parents.count(node.first) > 0) {
+                index.nodes_.push_back(
+                        PointCloudLODNode(node.first, node.second));
+            }
+        }
+        std::stable_sort(index.nodes_.begin(), index.nodes_.end(),
+                         [](const PointCloudLODNode &a,
+                            const PointCloudLODNode &b) {
+                             return a.name_.size() < b.name_.size();
+                         });
+        if (!WriteIJsonConvertibleToJSON(directory_ + kLODIndexFileName,
+                                         index)) {
+            utility::LogWarning("Write LOD failed: unable to write index.");
+            return false;
+        }
+        ++progress_bar;
+        return true;
+    }
+
+private:
+    std::string GetTmpFileName(const std::string &name) const {
+        return tmp_directory_ + name + ".bin";
+    }
+
+    std::string GetNodeFileName(const std::string &name) const {
+        return directory_ + name + "." + option_.format_;
+    }
+
+    /// Removes the temporary directory together with the temporary files
+    /// left behind by a failed build.
+    void RemoveTmpDirectory() const {
+        std::vector<std::string> filenames;
+        utility::filesystem::ListFilesInDirectoryWithExtension(
+                tmp_directory_, "bin", filenames);
+        for (const auto &filename : filenames) {
+            utility::filesystem::RemoveFile(filename);
+        }
+        utility::filesystem::DeleteDirectory(tmp_directory_);
+    }
+
+    void ComputeMortonCodes(const geometry::PointCloud &chunk,
+                            std::vector<uint64_t> &codes) const {
+        codes.resize(chunk.points_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < (int)chunk.points_.size(); i++) {
+            codes[i] = GetMortonCode(chunk.points_[i], origin_, size_,
+                                     grid_depth_);
+        }
+    }
+
+    /// Counts the points in the grid and splits the cube into the largest
+    /// nodes with at most max_chunk_points_ points.
+    bool SplitChunks(size_t num_points,
+                     const ReadChunkFunction &read_chunk,
+                     std::vector<std::pair<int, uint64_t>> &chunks,
+                     std::vector<int> &cell_chunks,
+                     utility::ConsoleProgressBar &progress_bar) {
+        grid_depth_ = std::min(kLODCountingGridDepth, option_.max_depth_);
+        const uint64_t num_cells = uint64_t(1) << (3 * grid_depth_);
+        std::vector<uint64_t> counts(num_cells + 1, 0);
+        geometry::PointCloud chunk;
+        std::vector<uint64_t> codes;
+        for (size_t first = 0; first < num_points;
+             first += kLODReadChunkSize) {
+            if (!read_chunk(first, kLODReadChunkSize, chunk)) {
+                utility::LogWarning("Write LOD failed: unable to read points.");
+                return false;
+            }
+            ComputeMortonCodes(chunk, codes);
+            for (uint64_t code : codes) {
+                counts[code + 1]++;
+            }
+            progress_bar += chunk.points_.size();
+        }
+        for (uint64_t i = 0; i < num_cells; i++) {
+            counts[i + 1] += counts[i];
+        }
+
+        std::function<void(int, uint64_t)> split = [&](int depth,
+                                                       uint64_t code) {
+            const int shift = 3 * (grid_depth_ - depth);
+            const uint64_t begin = code << shift;
+            const uint64_t end = (code + 1) << shift;
+            const uint64_t count = counts[end] - counts[begin];
+            if (count == 0) {
+                return;
+            }
+            if (count <= option_.max_chunk_points_ || depth == grid_depth_) {
+                std::fill(cell_chunks.begin() + begin,
+                          cell_chunks.begin() + end, int(chunks.size()));
+                chunks.push_back(std::make_pair(depth, code));
+                return;
+            }
+            for (uint64_t i = 0; i < 8; i++) {
+                split(depth + 1, code * 8 + i);
+            }
+        };
+        cell_chunks.assign(num_cells, -1);
+        split(0, 0);
+        return true;
+    }
+
+    /// Appends the points of every chunk to its temporary file, at most
+    /// max_chunk_points_ points are buffered.
+    bool DistributePoints(size_t num_points,
+                          const ReadChunkFunction &read_chunk,
+                          const std::vector<std::pair<int, uint64_t>> &chunks,
+                          const std::vector<int> &cell_chunks,
+                          utility::ConsoleProgressBar &progress_bar) {
+        std::vector<std::string> filenames(chunks.size());
+        for (size_t i = 0; i < chunks.size(); i++) {
+            filenames[i] = GetTmpFileName(
+                    GetNodeName(chunks[i].first, chunks[i].second));
+            utility::filesystem::RemoveFile(filenames[i]);
+        }
+        std::vector<geometry::PointCloud> buffers(chunks.size());
+        auto flush_buffers = [&]() {
+            bool success = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int i = 0; i < (int)buffers.size(); i++) {
+                if (buffers[i].IsEmpty()) {
+                    continue;
+                }
+                if (!WriteRawPoints(filenames[i], buffers[i], true)) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                    { success = false; }
+                }
+                buffers[i] = geometry::PointCloud();
+            }
+            if (!success) {
+                utility::LogWarning(
+                        "Write LOD failed: unable to write temporary files.");
+            }
+            return success;
+        };
+
+        geometry::PointCloud chunk;
+        std::vector<uint64_t> codes;
+        size_t num_buffered = 0;
+        for (size_t first = 0; first < num_points;
+             first += kLODReadChunkSize) {
+            if (!read_chunk(first, kLODReadChunkSize, chunk)) {
+                utility::LogWarning("Write LOD failed: unable to read points.");
+                return false;
+            }
+            ComputeMortonCodes(chunk, codes);
+            for (size_t i = 0; i < codes.size(); i++) {
+                geometry::PointCloud &buffer = buffers[cell_chunks[codes[i]]];
+                buffer.points_.push_back(chunk.points_[i]);
+                if (has_normals_) {
+                    buffer.normals_.push_back(chunk.normals_[i]);
+                }
+                if (has_colors_) {
+                    buffer.colors_.push_back(chunk.colors_[i]);
+                }
+            }
+            num_buffered += codes.size();
+            if (num_buffered >= option_.max_chunk_points_) {
+                if (!flush_buffers()) {
+                    return false;
+                }
+                num_buffered = 0;
+            }
+            progress_bar += chunk.points_.size();
+        }
+        return flush_buffers();
+    }
+
+    /// Builds the subtree below \p name from the points \p indices. The
+    /// points of the chunk root are kept in a temporary file since its
+    /// parents take their samples from it.
+    bool BuildSubtree(const geometry::PointCloud &pointcloud,
+                      const std::vector<size_t> &indices,
+                      const std::string &name,
+                      bool is_chunk_root,
+                      std::vector<std::pair<std::string, size_t>> &nodes) {
+        Eigen::Vector3d node_origin;
+        double node_size;
+        GetNodeCube(name, origin_, size_, node_origin, node_size);
+        const int depth = PointCloudLODIndex::GetNodeDepth(name);
+        std::vector<size_t> samples;
+        std::vector<size_t> child_indices[8];
+        if (indices.size() <= option_.max_node_points_ ||
+            depth >= option_.max_depth_) {
+            samples = indices;
+        } else {
+            samples = SamplePoints(pointcloud.points_, indices, node_origin,
+                                   node_size, option_.sampling_resolution_);
+            const Eigen::Vector3d center =
+                    node_origin + Eigen::Vector3d::Constant(node_size * 0.5);
+            size_t next_sample = 0;
+            for (size_t i : indices) {
+                if (next_sample < samples.size() &&
+                    samples[next_sample] == i) {
+                    next_sample++;
+                    continue;
+                }
+                const Eigen::Vector3d &point = pointcloud.points_[i];
+                int child_index = (point(0) < center(0) ? 0 : 1) +
+                                  (point(1) < center(1) ? 0 : 2) +
+                                  (point(2) < center(2) ? 0 : 4);
+                child_indices[child_index].push_back(i);
+            }
+        }
+
+        auto node = pointcloud.SelectByIndex(samples);
+        if (is_chunk_root) {
+            if (!WriteRawPoints(GetTmpFileName(name), *node, false)) {
+                return false;
+            }
+        } else if (!WritePointCloud(GetNodeFileName(name), *node)) {
+            return false;
+        }
+        nodes.push_back(std::make_pair(name, samples.size()));
+        node.reset();
+        samples.clear();
+        for (int i = 0; i < 8; i++) {
+            if (child_indices[i].empty()) {
+                continue;
+            }
+            if (!BuildSubtree(pointcloud, child_indices[i],
+                              name + char('0' + i), false, nodes)) {
+                return false;
+            }
+            std::vector<size_t>().swap(child_indices[i]);
+        }
+        return true;
+    }
+
+    bool BuildChunks(const std::vector<std::pair<int, uint64_t>> &chunks) {
+        bool success = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < (int)chunks.size(); i++) {
+            const std::string name =
+                    GetNodeName(chunks[i].first, chunks[i].second);
+            geometry::PointCloud pointcloud;
+            std::vector<std::pair<std::string, size_t>> nodes;
+            bool chunk_success = ReadRawPoints(GetTmpFileName(name),
+                                               has_normals_, has_colors_,
+                                               pointcloud);
+            if (chunk_success) {
+                std::vector<size_t> indices(pointcloud.points_.size());
+                for (size_t j = 0; j < indices.size(); j++) {
+                    indices[j] = j;
+                }
+                chunk_success =
+                        BuildSubtree(pointcloud, indices, name, true, nodes);
+            }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            {
+                success = success && chunk_success;
+                nodes_.insert(nodes.begin(), nodes.end());
+                pending_nodes_.push_back(name);
+            }
+        }
+        if (!success) {
+            utility::LogWarning("Write LOD failed: unable to write nodes.");
+        }
+        return success;
+    }
+
+    /// Samples the nodes above the chunks from the points of their
+    /// children, one level at a time.
+    bool BuildUpperNodes() {
+        int max_depth = 0;
+        for (const auto &name : pending_nodes_) {
+            max_depth = std::max(max_depth,
+                                 PointCloudLODIndex::GetNodeDepth(name));
+        }
+        for (int depth = max_depth - 1; depth >= 0; depth--) {
+            std::map<std::string, std::vector<std::string>> children;
+            for (const auto &name : pending_nodes_) {
+                if (PointCloudLODIndex::GetNodeDepth(name) == depth + 1) {
+                    children[name.substr(0, name.size() - 1)].push_back(name);
+                }
+            }
+            std::vector<std::string> parents;
+            for (const auto &parent : children) {
+                parents.push_back(parent.first);
+            }
+            bool success = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int i = 0; i < (int)parents.size(); i++) {
+                std::vector<std::pair<std::string, size_t>> nodes;
+                bool parent_success = BuildUpperNode(
+                        parents[i], children.at(parents[i]), nodes);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                {
+                    success = success && parent_success;
+                    for (const auto &node : nodes) {
+                        nodes_[node.first] = node.second;
+                    }
+                }
+            }
+            if (!success) {
+                utility::LogWarning("Write LOD failed: unable to write nodes.");
+                return false;
+            }
+            pending_nodes_.insert(pending_nodes_.end(), parents.begin(),
+                                  parents.end());
+        }
+        return true;
+    }
+
+    /// Samples \p name from the points of its children, which are all loaded
+    /// at once. An internal child holds at most sampling_resolution_^3
+    /// samples and a leaf child at most max_node_points_ points, unless it is
+    /// cut off by max_depth_, so this needs memory for about
+    /// 8 * sampling_resolution_^3 points independently of max_chunk_points_.
+    bool BuildUpperNode(const std::string &name,
+                        const std::vector<std::string> &children,
+                        std::vector<std::pair<std::string, size_t>> &nodes) {
+        std::vector<geometry::PointCloud> child_pointclouds(children.size());
+        geometry::PointCloud pointcloud;
+        for (size_t i = 0; i < children.size(); i++) {
+            if (!ReadRawPoints(GetTmpFileName(children[i]), has_normals_,
+                               has_colors_, child_pointclouds[i])) {
+                return false;
+            }
+            pointcloud += child_pointclouds[i];
+        }
+        Eigen::Vector3d node_origin;
+        double node_size;
+        GetNodeCube(name, origin_, size_, node_origin, node_size);
+        std::vector<size_t> indices(pointcloud.points_.size());
+        for (size_t i = 0; i < indices.size(); i++) {
+            indices[i] = i;
+        }
+        std::vector<size_t> samples =
+                SamplePoints(pointcloud.points_, indices, node_origin,
+                             node_size, option_.sampling_resolution_);
+        if (!WriteRawPoints(GetTmpFileName(name),
+                            *pointcloud.SelectByIndex(samples), false)) {
+            return false;
+        }
+        nodes.push_back(std::make_pair(name, samples.size()));
+
+        // the samples are removed from the children
+        size_t offset = 0;
+        size_t next_sample = 0;
+        for (size_t i = 0; i < children.size(); i++) {
+            const size_t num_points = child_pointclouds[i].points_.size();
+            std::vector<size_t> child_samples;
+            while (next_sample < samples.size() &&
+                   samples[next_sample] < offset + num_points) {
+                child_samples.push_back(samples[next_sample++] - offset);
+            }
+            offset += num_points;
+            if (child_samples.empty()) {
+                continue;
+            }
+            if (!WriteRawPoints(GetTmpFileName(children[i]),
+                                *child_pointclouds[i].SelectByIndex(
+                                        child_samples, true),
+                                false)) {
+                return false;
+            }
+            nodes.push_back(std::make_pair(children[i],
+                                           num_points - child_samples.size()));
+        }
+        return true;
+    }
+
+    /// Converts the temporary files of the chunk roots and of the nodes
+    /// above them to node files.
+    bool WritePendingNodes() {
+        bool success = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < (int)pending_nodes_.size(); i++) {
+            const std::string &name = pending_nodes_[i];
+            geometry::PointCloud pointcloud;
+            bool node_success = ReadRawPoints(GetTmpFileName(name),
+                                              has_normals_, has_colors_,
+                                              pointcloud);
+            if (node_success && !pointcloud.IsEmpty()) {
+                node_success =
+                        WritePointCloud(GetNodeFileName(name), pointcloud);
+            }
+            utility::filesystem::RemoveFile(GetTmpFileName(name));
+            if (!node_success) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                { success = false; }
+            }
+        }
+        if (!success) {
+            utility::LogWarning("Write LOD failed: unable to write nodes.");
+        }
+        return success;
+    }
+
+private:
+    std::string directory_;
+    std::string tmp_directory_;
+    PointCloudLODOption option_;
+    bool has_normals_;
+    bool has_colors_;
+    Eigen::Vector3d origin_;
+    double size_;
+    int grid_depth_ = 0;
+    /// Number of points of every node.
+    std::map<std::string, size_t> nodes_;
+    /// Nodes whose points are still in temporary files.
+    std::vector<std::string> pending_nodes_;
+};
+
+bool WritePointCloudLODFromChunks(const std::string &directory,
+                                  size_t num_points,
+                                  bool has_normals,
+                                  bool has_colors,
+                                  const geometry::AxisAlignedBoundingBox &bbox,
+                                  const ReadChunkFunction &read_chunk,
+                                  const PointCloudLODOption &option,
+                                  bool print_progress) {
+    if (num_points == 0) {
+        utility::LogWarning("Write LOD failed: point cloud has 0 points.");
+        return false;
+    }
+    PointCloudLODWriter writer(directory, option, bbox, has_normals,
+                               has_colors);
+    return writer.Write(num_points, read_chunk, print_progress);
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool PointCloudLODIndex::ConvertToJsonValue(Json::Value &value) const {
+    value["class_name"] = "PointCloudLODIndex";
+    value["version_major"] = 1;
+    value["version_minor"] = 0;
+    Json::Value origin;
+    EigenVector3dToJsonArray(origin_, origin);
+    value["origin"] = origin;
+    value["size"] = size_;
+    value["sampling_resolution"] = sampling_resolution_;
+    value["format"] = format_;
+    value["num_points"] = Json::UInt64(num_points_);
+    value["has_normals"] = has_normals_;
+    value["has_colors"] = has_colors_;
+    Json::Value node_array(Json::arrayValue);
+    for (const auto &node : nodes_) {
+        Json::Value node_value;
+        node_value["name"] = node.name_;
+        node_value["num_points"] = Json::UInt64(node.num_points_);
+        node_array.append(node_value);
+    }
+    value["nodes"] = node_array;
+    return true;
+}
+
+bool PointCloudLODIndex::ConvertFromJsonValue(const Json::Value &value) {
+    if (value.isObject() == false ||
+        value.get("class_name", "").asString() != "PointCloudLODIndex" ||
+        value.get("version_major", 1).asInt() != 1 ||
+        value.get("version_minor", 0).asInt() != 0) {
+        utility::LogWarning(
+                "PointCloudLODIndex read JSON failed: unsupported json "
+                "format.");
+        return false;
+    }
+    if (EigenVector3dFromJsonArray(origin_, value["origin"]) == false) {
+        utility::LogWarning(
+                "PointCloudLODIndex read JSON failed: wrong format.");
+        return false;
+    }
+    size_ = value.get("size", 1.0).asDouble();
+    sampling_resolution_ = value.get("sampling_resolution", 128).asInt();
+    format_ = value.get("format", "ply").asString();
+    num_points_ = value.get("num_points", 0).asUInt64();
+    has_normals_ = value.get("has_normals", false).asBool();
+    has_colors_ = value.get("has_colors", false).asBool();
+    const Json::Value &node_array = value["nodes"];
+    nodes_.resize(node_array.size());
+    for (size_t i = 0; i < nodes_.size(); i++) {
+        const Json::Value &node_value = node_array[int(i)];
+        nodes_[i].name_ = node_value.get("name", "").asString();
+        nodes_[i].num_points_ = node_value.get("num_points", 0).asUInt64();
+        if (nodes_[i].name_.empty() || nodes_[i].name_[0] != 'r' ||
+            nodes_[i].name_.find_first_not_of("01234567", 1) !=
+                    std::string::npos) {
+            utility::LogWarning(
+                    "PointCloudLODIndex read JSON failed: invalid node name.");
+            return false;
+        }
+    }
+    return true;
+}
+
+geometry::AxisAlignedBoundingBox PointCloudLODIndex::GetNodeBoundingBox(
+        const std::string &name) const {
+    Eigen::Vector3d node_origin;
+    double node_size;
+    GetNodeCube(name, origin_, size_, node_origin, node_size);
+    return geometry::AxisAlignedBoundingBox(
+            node_origin, node_origin + Eigen::Vector3d::Constant(node_size));
+}
+
+bool WritePointCloudLOD(const std::string &directory,
+                        const geometry::PointCloud &pointcloud,
+                        const PointCloudLODOption &option,
+                        bool print_progress) {
+    auto read_chunk = [&pointcloud](size_t first, size_t count,
+                                    geometry::PointCloud &chunk) {
+        const size_t last = std::min(first + count, pointcloud.points_.size());
+        chunk.Clear();
+        chunk.points_.assign(pointcloud.points_.begin() + first,
+                             pointcloud.points_.begin() + last);
+        if (pointcloud.HasNormals()) {
+            chunk.normals_.assign(pointcloud.normals_.begin() + first,
+                                  pointcloud.normals_.begin() + last);
+        }
+        if (pointcloud.HasColors()) {
+            chunk.colors_.assign(pointcloud.colors_.begin() + first,
+                                 pointcloud.colors_.begin() + last);
+        }
+        return true;
+    };
+    return WritePointCloudLODFromChunks(
+            directory, pointcloud.points_.size(), pointcloud.HasNormals(),
+            pointcloud.HasColors(), pointcloud.GetAxisAlignedBoundingBox(),
+            read_chunk, option, print_progress);
+}
+
+bool WritePointCloudLOD(const std::string &directory,
+                        const MappedPointCloud &pointcloud,
+                        const PointCloudLODOption &option,
+                        bool print_progress) {
+    if (!pointcloud.IsOpened()) {
+        utility::LogWarning("Write LOD failed: no file is mapped.");
+        return false;
+    }
+    auto read_chunk = [&pointcloud](size_t first, size_t count,
+                                    geometry::PointCloud &chunk) {
+        return pointcloud.ReadChunk(first, count, chunk);
+    };
+    return WritePointCloudLODFromChunks(
+            directory, pointcloud.GetNumPoints(), pointcloud.HasNormals(),
+            pointcloud.HasColors(), pointcloud.GetAxisAlignedBoundingBox(),
+            read_chunk, option, print_progress);
+}
+
+bool ReadPointCloudLODIndex(const std::string &directory,
+                            PointCloudLODIndex &index) {
+    return ReadIJsonConvertibleFromJSON(
+            utility::filesystem::GetRegularizedDirectoryName(directory) +
+                    kLODIndexFileName,
+            index);
+}
+
+bool ReadPointCloudLOD(const std::string &directory,
+                       geometry::PointCloud &pointcloud,
+                       int max_depth /* = -1*/) {
+    pointcloud.Clear();
+    PointCloudLODIndex index;
+    if (!ReadPointCloudLODIndex(directory, index)) {
+        return false;
+    }
+    const std::string prefix =
+            utility::filesystem::GetRegularizedDirectoryName(directory);
+    for (const auto &node : index.nodes_) {
+        if (max_depth >= 0 &&
+            PointCloudLODIndex::GetNodeDepth(node.name_) > max_depth) {
+            break;
+        }
+        if (node.num_points_ == 0) {
+            continue;
+        }
+        geometry::PointCloud node_pointcloud;
+        if (!ReadPointCloud(prefix + index.GetNodeFileName(node.name_),
+                            node_pointcloud, "auto", false, false) ||
+            node_pointcloud.points_.size() != node.num_points_) {
+            utility::LogWarning("Read LOD failed: unable to read node {}.",
+                                node.name_);
+            return false;
+        }
+        pointcloud += node_pointcloud;
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,200 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/MappedPointCloudIO.h"
+#include "Open3D/Utility/IJsonConvertible.h"
+
+namespace open3d {
+namespace io {
+
+/// \class PointCloudLODOption
+///
+/// \brief Option for WritePointCloudLOD.
+class PointCloudLODOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_node_points A node with at most this many points is a leaf.
+    /// \param sampling_resolution Number of sampling cells along each side of
+    /// an internal node.
+    /// \param max_depth Nodes at this depth are leaves.
+    /// \param max_chunk_points Maximum number of points held in memory by one
+    /// thread while building the subtrees, see max_chunk_points_.
+    /// \param format Extension of the node files.
+    PointCloudLODOption(size_t max_node_points = 20000,
+                        int sampling_resolution = 128,
+                        int max_depth = 16,
+                        size_t max_chunk_points = 1 << 22,
+                        const std::string &format = "ply")
+        : max_node_points_(max_node_points),
+          sampling_resolution_(sampling_resolution),
+          max_depth_(max_depth),
+          max_chunk_points_(max_chunk_points),
+          format_(format) {
+        max_node_points_ = max_node_points == 0 ? 20000 : max_node_points;
+        sampling_resolution_ =
+                sampling_resolution < 1 || sampling_resolution > (1 << 20)
+                        ? 128
+                        : sampling_resolution;
+        max_depth_ = max_depth < 0 || max_depth > 20 ? 16 : max_depth;
+        max_chunk_points_ =
+                max_chunk_points < max_node_points_ ? max_node_points_
+                                                    : max_chunk_points;
+    }
+    ~PointCloudLODOption() {}
+
+public:
+    /// A node with at most this many points is a leaf and keeps all of them.
+    size_t max_node_points_;
+    /// \brief Number of sampling cells along each side of an internal node.
+    ///
+    /// An internal node keeps the point closest to the center of each
+    /// occupied cell and passes the other points on to its children, so the
+    /// point spacing halves with every level.
+    int sampling_resolution_;
+    /// Nodes at this depth are leaves regardless of their number of points.
+    int max_depth_;
+    /// \brief Maximum number of points held in memory by one thread.
+    ///
+    /// The subtrees of the regions holding at most this many points are built
+    /// independently. A region is never smaller than 1/128 of the bounding
+    /// cube along each side, so very dense regions may exceed the limit.
+    /// The nodes above these regions are sampled from the points of all
+    /// their children at once, which takes about
+    /// 8 * sampling_resolution_^3 points per thread regardless of this limit.
+    size_t max_chunk_points_;
+    /// Extension of the node files, any writable point cloud format.
+    std::string format_;
+};
+
+/// \class PointCloudLODNode
+///
+/// \brief Node of a level of detail octree.
+class PointCloudLODNode {
+public:
+    PointCloudLODNode(const std::string &name = "", size_t num_points = 0)
+        : name_(name), num_points_(num_points) {}
+    ~PointCloudLODNode() {}
+
+public:
+    /// \brief Path from the root to the node.
+    ///
+    /// The root is "r" and every level appends the index of the child,
+    /// x_index + 2 * y_index + 4 * z_index, as in geometry::Octree.
+    std::string name_;
+    /// Number of points stored in the node file. Nodes without points have
+    /// no file.
+    size_t num_points_;
+};
+
+/// \class PointCloudLODIndex
+///
+/// \brief Hierarchy of a point cloud written as a level of detail octree.
+///
+/// Every point is stored in exactly one node, so a point cloud is refined by
+/// adding the points of the children of the loaded nodes.
+class PointCloudLODIndex : public utility::IJsonConvertible {
+public:
+    PointCloudLODIndex() {}
+    ~PointCloudLODIndex() override {}
+
+public:
+    bool ConvertToJsonValue(Json::Value &value) const override;
+    bool ConvertFromJsonValue(const Json::Value &value) override;
+
+    /// Returns the depth of a node, 0 for the root.
+    static int GetNodeDepth(const std::string &name) {
+        return int(name.size()) - 1;
+    }
+    /// Returns the cube of a node.
+    geometry::AxisAlignedBoundingBox GetNodeBoundingBox(
+            const std::string &name) const;
+    /// Returns the sampling cell size of a node.
+    double GetNodeSpacing(const std::string &name) const {
+        return size_ / double(1 << GetNodeDepth(name)) / sampling_resolution_;
+    }
+    /// Returns the file name of a node, relative to the index.
+    std::string GetNodeFileName(const std::string &name) const {
+        return name + "." + format_;
+    }
+
+public:
+    /// Minimum corner of the root cube.
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    /// Side length of the root cube.
+    double size_ = 1.0;
+    int sampling_resolution_ = 128;
+    std::string format_ = "ply";
+    size_t num_points_ = 0;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+    /// Nodes in breadth first order, parents come before their children.
+    std::vector<PointCloudLODNode> nodes_;
+};
+
+/// \brief Function to write a point cloud as a level of detail octree.
+///
+/// The node files and the index file lod.json are written to \p directory,
+/// temporary files are written to its subdirectory tmp.
+/// \return return true if the write function is successful, false otherwise.
+bool WritePointCloudLOD(const std::string &directory,
+                        const geometry::PointCloud &pointcloud,
+                        const PointCloudLODOption &option =
+                                PointCloudLODOption(),
+                        bool print_progress = false);
+
+/// \brief Function to write a memory mapped point cloud as a level of detail
+/// octree.
+///
+/// The file is read three times, the memory use is bounded by
+/// PointCloudLODOption::max_chunk_points_ and the number of threads.
+bool WritePointCloudLOD(const std::string &directory,
+                        const MappedPointCloud &pointcloud,
+                        const PointCloudLODOption &option =
+                                PointCloudLODOption(),
+                        bool print_progress = false);
+
+/// Function to read the index of a level of detail octree.
+bool ReadPointCloudLODIndex(const std::string &directory,
+                            PointCloudLODIndex &index);
+
+/// \brief Function to read the nodes of a level of detail octree.
+///
+/// \param max_depth Only the nodes up to this depth are read, -1 reads all.
+bool ReadPointCloudLOD(const std::string &directory,
+                       geometry::PointCloud &pointcloud,
+                       int max_depth = -1);
+
+}  // namespace io
+}  // namespace open3d
@@ -51,5 +51,15 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const registration::PoseGraph &pose_graph);
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph);
+
+/// \brief Function to write a PoseGraph to a binary file.
+///
+/// The matrices are stored as packed doubles, the information matrices as
+/// their upper triangle if all of them are symmetric.
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDImageIO.h"
+
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+
+namespace {
+
+bool IsAbsolutePath(const std::string &path) {
+    return (!path.empty() && (path[0] == '/' || path[0] == '\\')) ||
+           (path.size() > 1 && path[1] == ':');
+}
+
+std::shared_ptr<geometry::RGBDImage> LoadRGBDImage(
+        const std::string &color_path,
+        const std::string &depth_path,
+        double depth_scale,
+        double depth_trunc,
+        bool convert_rgb_to_intensity) {
+    geometry::Image depth;
+    if (!io::ReadImage(depth_path, depth)) {
+        return nullptr;
+    }
+    if (color_path.empty()) {
+        auto rgbd = std::make_shared<geometry::RGBDImage>();
+        rgbd->depth_ = *depth.ConvertDepthToFloatImage(depth_scale,
+                                                       depth_trunc);
+        return rgbd;
+    }
+    geometry::Image color;
+    if (!io::ReadImage(color_path, color)) {
+        return nullptr;
+    }
+    return geometry::RGBDImage::CreateFromColorAndDepth(
+            color, depth, depth_scale, depth_trunc, convert_rgb_to_intensity);
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadRGBDAssociationFile(const std::string &filename,
+                             std::vector<std::string> &color_paths,
+                             std::vector<std::string> &depth_paths) {
+    FILE *file = utility::filesystem::FOpen(filename, "r");
+    if (file == NULL) {
+        utility::LogWarning("Read RGBD association failed: unable to open {}",
+                            filename);
+        return false;
+    }
+    const std::string directory =
+            utility::filesystem::GetFileParentDirectory(filename);
+    auto resolve = [&directory](const std::string &path) {
+        return IsAbsolutePath(path) ? path : directory + path;
+    };
+    color_paths.clear();
+    depth_paths.clear();
+    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    std::vector<std::string> tokens;
+    bool success = true;
+    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        tokens.clear();
+        utility::SplitString(tokens, line_buffer, " \t\r\n");
+        if (tokens.empty() || tokens[0][0] == '#') {
+            continue;
+        }
+        if (tokens.size() == 4) {
+            color_paths.push_back(resolve(tokens[1]));
+            depth_paths.push_back(resolve(tokens[3]));
+        } else if (tokens.size() == 2) {
+            color_paths.push_back(resolve(tokens[0]));
+            depth_paths.push_back(resolve(tokens[1]));
+        } else {
+            utility::LogWarning(
+                    "Read RGBD association failed: unrecognized line {} in "
+                    "{}",
+                    line_buffer, filename);
+            success = false;
+            break;
+        }
+    }
+    fclose(file);
+    return success;
+}
+
+RGBDImageLoader::RGBDImageLoader(const std::vector<std::string> &color_paths,
+                                 const std::vector<std::string> &depth_paths,
+                                 double depth_scale /* = 1000.0*/,
+                                 double depth_trunc /* = 3.0*/,
+                                 bool convert_rgb_to_intensity /* = true*/,
+                                 int num_threads /* = -1*/,
+                                 size_t readahead /* = 8*/)
+    : color_paths_(color_paths),
+      depth_paths_(depth_paths),
+      depth_scale_(depth_scale),
+      depth_trunc_(depth_trunc),
+      convert_rgb_to_intensity_(convert_rgb_to_intensity),
+      num_threads_(num_threads),
+      readahead_(readahead) {
+    if (!color_paths_.empty() && color_paths_.size() != depth_paths_.size()) {
+        utility::LogError(
+                "[RGBDImageLoader] {} color images do not match {} depth "
+                "images.",
+                color_paths_.size(), depth_paths_.size());
+    }
+    StartPrefetching(0);
+}
+
+bool RGBDImageLoader::SeekFrame(size_t index) {
+    if (index >= GetNumFrames()) {
+        utility::LogWarning("Frame {} exceeds the number of frames {}.", index,
+                            GetNumFrames());
+        return false;
+    }
+    StartPrefetching(index);
+    return true;
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDImageLoader::NextFrame() {
+    if (IsEOF()) {
+        return nullptr;
+    }
+    return prefetch_queue_->Pop();
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDImageLoader::ReadFrame(
+        size_t index) const {
+    if (index >= GetNumFrames()) {
+        utility::LogWarning("Frame {} exceeds the number of frames {}.", index,
+                            GetNumFrames());
+        return nullptr;
+    }
+    return LoadRGBDImage(color_paths_.empty() ? "" : color_paths_[index],
+                         depth_paths_[index], depth_scale_, depth_trunc_,
+                         convert_rgb_to_intensity_);
+}
+
+void RGBDImageLoader::StartPrefetching(size_t first) {
+    // the previous queue is stopped before the new one starts reading
+    prefetch_queue_.reset();
+    prefetch_queue_.reset(
+            new utility::PrefetchQueue<std::shared_ptr<geometry::RGBDImage>>(
+                    first, GetNumFrames(),
+                    [this](size_t index) { return ReadFrame(index); },
+                    num_threads_, readahead_));
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+/// \brief Function to read the color and depth image paths of an RGBD
+/// dataset from an association file.
+///
+/// Lines starting with # are comments. Every other line holds either a TUM
+/// association (timestamp color timestamp depth), as written by the
+/// associate.py tool of the TUM RGB-D benchmark, or a color and a depth path.
+/// Relative paths are resolved against the directory of the file.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadRGBDAssociationFile(const std::string &filename,
+                             std::vector<std::string> &color_paths,
+                             std::vector<std::string> &depth_paths);
+
+/// \class RGBDImageLoader
+///
+/// \brief Loads the frames of an RGBD dataset stored as color and depth image
+/// files.
+///
+/// NextFrame() yields the frames in order. The images of the next frames are
+/// read and decoded concurrently on a pool of worker threads, up to a
+/// readahead window ahead of the consumer. Every frame is created as by
+/// geometry::RGBDImage::CreateFromColorAndDepth.
+class RGBDImageLoader {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param color_paths Paths of the color images, may be empty for depth
+    /// only datasets, in which case the frames have no color.
+    /// \param depth_paths Paths of the depth images.
+    /// \param depth_scale Ratio to scale depth values, 1000 for Redwood and
+    /// 5000 for TUM.
+    /// \param depth_trunc Depth values larger than this are set to 0.
+    /// \param convert_rgb_to_intensity Whether to convert the color to a float
+    /// intensity image.
+    /// \param num_threads Number of decoding threads, the number of hardware
+    /// threads if not positive.
+    /// \param readahead Maximum number of decoded frames waiting to be taken.
+    RGBDImageLoader(const std::vector<std::string> &color_paths,
+                    const std::vector<std::string> &depth_paths,
+                    double depth_scale = 1000.0,
+                    double depth_trunc = 3.0,
+                    bool convert_rgb_to_intensity = true,
+                    int num_threads = -1,
+                    size_t readahead = 8);
+    virtual ~RGBDImageLoader() {}
+
+public:
+    /// Number of frames in the dataset.
+    size_t GetNumFrames() const { return depth_paths_.size(); }
+    /// Check if all frames have been loaded.
+    bool IsEOF() const { return prefetch_queue_->IsEmpty(); }
+    /// Move the loading position to frame \p index.
+    bool SeekFrame(size_t index);
+    /// Get the frame at the loading position and advance it, returns nullptr
+    /// at the end of the dataset or if the images cannot be read.
+    std::shared_ptr<geometry::RGBDImage> NextFrame();
+    /// Load frame \p index on the calling thread, independently of the
+    /// loading position.
+    std::shared_ptr<geometry::RGBDImage> ReadFrame(size_t index) const;
+
+private:
+    void StartPrefetching(size_t first);
+
+private:
+    std::vector<std::string> color_paths_;
+    std::vector<std::string> depth_paths_;
+    double depth_scale_;
+    double depth_trunc_;
+    bool convert_rgb_to_intensity_;
+    int num_threads_;
+    size_t readahead_;
+    std::unique_ptr<
+            utility::PrefetchQueue<std::shared_ptr<geometry::RGBDImage>>>
+            prefetch_queue_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,480 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDSequenceIO.h"
+
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+
+const char kFileMagic[8] = {'O', '3', 'D', 'R', 'G', 'B', 'D', 'S'};
+const char kIndexMagic[8] = {'O', '3', 'D', 'R', 'G', 'B', 'D', 'I'};
+const uint32_t kFileVersion = 1;
+const uint64_t kFileHeaderSize = 16;
+/// Number of frames, offset of the index and the index magic.
+const uint64_t kFileTrailerSize = 24;
+
+const uint32_t kEncodingLZF = 1;
+const uint32_t kEncodingDelta16 = 2;
+
+struct ImageRecordHeader {
+    int32_t width;
+    int32_t height;
+    int32_t num_of_channels;
+    int32_t bytes_per_channel;
+    uint32_t encoding;
+    uint32_t reserved;
+    uint64_t stored_size;
+};
+
+int Seek(FILE *file, uint64_t offset, int origin = SEEK_SET) {
+#ifdef _WIN32
+    return _fseeki64(file, (__int64)offset, origin);
+#else
+    return fseeko(file, (off_t)offset, origin);
+#endif
+}
+
+uint64_t Tell(FILE *file) {
+#ifdef _WIN32
+    return (uint64_t)_ftelli64(file);
+#else
+    return (uint64_t)ftello(file);
+#endif
+}
+
+void EncodeImage(const geometry::Image &image, std::vector<uint8_t> &record) {
+    ImageRecordHeader header;
+    header.width = image.width_;
+    header.height = image.height_;
+    header.num_of_channels = image.num_of_channels_;
+    header.bytes_per_channel = image.bytes_per_channel_;
+    header.encoding = 0;
+    header.reserved = 0;
+    header.stored_size = image.data_.size();
+
+    // depth changes smoothly along rows, so the differences of neighboring
+    // pixels compress much better than the raw values
+    std::vector<uint8_t> delta;
+    const uint8_t *data = image.data_.data();
+    if (image.num_of_channels_ == 1 && image.bytes_per_channel_ == 2 &&
+        !image.data_.empty()) {
+        delta.resize(image.data_.size());
+        for (int v = 0; v < image.height_; v++) {
+            const uint16_t *src = image.PointerAt<uint16_t>(0, v);
+            uint16_t *dst = reinterpret_cast<uint16_t *>(delta.data()) +
+                            size_t(v) * image.width_;
+            uint16_t prev = 0;
+            for (int u = 0; u < image.width_; u++) {
+                dst[u] = uint16_t(src[u] - prev);
+                prev = src[u];
+            }
+        }
+        data = delta.data();
+        header.encoding |= kEncodingDelta16;
+    }
+
+    size_t offset = record.size();
+    record.resize(offset + sizeof(header) + image.data_.size());
+    uint8_t *payload = record.data() + offset + sizeof(header);
+    unsigned int compressed_size = 0;
+    if (!image.data_.empty()) {
+        compressed_size =
+                lzf_compress(data, (unsigned int)image.data_.size(), payload,
+                             (unsigned int)image.data_.size() - 1);
+    }
+    if (compressed_size > 0) {
+        header.encoding |= kEncodingLZF;
+        header.stored_size = compressed_size;
+    } else if (!image.data_.empty()) {
+        memcpy(payload, data, image.data_.size());
+    }
+    memcpy(record.data() + offset, &header, sizeof(header));
+    record.resize(offset + sizeof(header) + header.stored_size);
+}
+
+bool DecodeImage(const uint8_t *&ptr,
+                 const uint8_t *end,
+                 geometry::Image &image) {
+    ImageRecordHeader header;
+    if (end - ptr < (ptrdiff_t)sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, ptr, sizeof(header));
+    ptr += sizeof(header);
+    if (header.width < 0 || header.height < 0 ||
+        header.num_of_channels < 0 ||
+        (uint64_t)(end - ptr) < header.stored_size) {
+        return false;
+    }
+    // an empty Image has 0 bytes per channel
+    if (header.bytes_per_channel != 0 && header.bytes_per_channel != 1 &&
+        header.bytes_per_channel != 2 && header.bytes_per_channel != 4) {
+        return false;
+    }
+    // the sizes of a line and of the image must fit in an int, see
+    // Image::BytesPerLine, and be plausible for the stored size, a back
+    // reference of LZF expands 3 bytes to at most 264 bytes
+    const uint64_t max_num_bytes = uint64_t(std::numeric_limits<int>::max());
+    uint64_t num_bytes =
+            uint64_t(header.width) * uint64_t(header.num_of_channels);
+    if (num_bytes > max_num_bytes) {
+        return false;
+    }
+    num_bytes *= uint64_t(header.bytes_per_channel);
+    if (num_bytes > max_num_bytes) {
+        return false;
+    }
+    num_bytes *= uint64_t(header.height);
+    if (num_bytes > max_num_bytes) {
+        return false;
+    }
+    if ((header.encoding & kEncodingLZF) ? num_bytes > header.stored_size * 88
+                                         : num_bytes != header.stored_size) {
+        return false;
+    }
+    image.Prepare(header.width, header.height, header.num_of_channels,
+                  header.bytes_per_channel);
+    if (header.encoding & kEncodingLZF) {
+        if (lzf_decompress(ptr, (unsigned int)header.stored_size,
+                           image.data_.data(),
+                           (unsigned int)image.data_.size()) !=
+            image.data_.size()) {
+            return false;
+        }
+    } else {
+        if (header.stored_size != image.data_.size()) {
+            return false;
+        }
+        memcpy(image.data_.data(), ptr, image.data_.size());
+    }
+    ptr += header.stored_size;
+    if (header.encoding & kEncodingDelta16) {
+        if (image.bytes_per_channel_ != 2 || image.num_of_channels_ != 1) {
+            return false;
+        }
+        for (int v = 0; v < image.height_; v++) {
+            uint16_t *row = image.PointerAt<uint16_t>(0, v);
+            for (int u = 1; u < image.width_; u++) {
+                row[u] = uint16_t(row[u] + row[u - 1]);
+            }
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<geometry::RGBDImage> DecodeFrame(
+        const std::vector<uint8_t> &record) {
+    auto rgbd = std::make_shared<geometry::RGBDImage>();
+    const uint8_t *ptr = record.data();
+    const uint8_t *end = record.data() + record.size();
+    if (!DecodeImage(ptr, end, rgbd->depth_) ||
+        !DecodeImage(ptr, end, rgbd->color_)) {
+        return nullptr;
+    }
+    return rgbd;
+}
+
+/// Recovers the frame offsets of a recording whose index was never written
+/// by walking the records, a truncated last record is dropped.
+void ScanFrameOffsets(FILE *file,
+                      uint64_t file_size,
+                      std::vector<uint64_t> &frame_offsets) {
+    frame_offsets.clear();
+    uint64_t offset = kFileHeaderSize;
+    while (true) {
+        uint64_t frame_end = offset;
+        bool is_complete = true;
+        for (int i = 0; i < 2 && is_complete; i++) {
+            ImageRecordHeader header;
+            is_complete = Seek(file, frame_end) == 0 &&
+                          fread(&header, sizeof(header), 1, file) == 1;
+            frame_end += sizeof(header);
+            is_complete = is_complete && frame_end <= file_size &&
+                          header.stored_size <= file_size - frame_end;
+            frame_end += is_complete ? header.stored_size : 0;
+        }
+        if (!is_complete) {
+            break;
+        }
+        frame_offsets.push_back(offset);
+        offset = frame_end;
+    }
+    frame_offsets.push_back(offset);
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+RGBDSequenceWriter::RGBDSequenceWriter() : file_(nullptr), file_size_(0) {}
+
+RGBDSequenceWriter::~RGBDSequenceWriter() { Close(); }
+
+bool RGBDSequenceWriter::Open(const std::string &filename) {
+    if (IsOpened()) {
+        Close();
+    }
+    file_ = utility::filesystem::FOpen(filename, "wb");
+    if (file_ == nullptr) {
+        utility::LogWarning("Unable to open file {}", filename);
+        return false;
+    }
+    uint32_t version_and_reserved[2] = {kFileVersion, 0};
+    if (fwrite(kFileMagic, 1, 8, file_) != 8 ||
+        fwrite(version_and_reserved, 4, 2, file_) != 2) {
+        utility::LogWarning("Unable to write file {}", filename);
+        fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    filename_ = filename;
+    frame_offsets_.clear();
+    file_size_ = kFileHeaderSize;
+    return true;
+}
+
+bool RGBDSequenceWriter::WriteFrame(const geometry::RGBDImage &rgbd) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    std::vector<uint8_t> record[2];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < 2; i++) {
+        EncodeImage(i == 0 ? rgbd.depth_ : rgbd.color_, record[i]);
+    }
+    if (fwrite(record[0].data(), 1, record[0].size(), file_) !=
+                record[0].size() ||
+        fwrite(record[1].data(), 1, record[1].size(), file_) !=
+                record[1].size()) {
+        utility::LogWarning("Unable to write frame to file {}", filename_);
+        return false;
+    }
+    frame_offsets_.push_back(file_size_);
+    file_size_ += record[0].size() + record[1].size();
+    return true;
+}
+
+bool RGBDSequenceWriter::Close() {
+    if (!IsOpened()) {
+        return false;
+    }
+    uint64_t num_frames = frame_offsets_.size();
+    uint64_t index_offset = file_size_;
+    bool success =
+            fwrite(frame_offsets_.data(), 8, frame_offsets_.size(), file_) ==
+                    frame_offsets_.size() &&
+            fwrite(&num_frames, 8, 1, file_) == 1 &&
+            fwrite(&index_offset, 8, 1, file_) == 1 &&
+            fwrite(kIndexMagic, 1, 8, file_) == 8;
+    success = fclose(file_) == 0 && success;
+    file_ = nullptr;
+    if (!success) {
+        utility::LogWarning("Unable to write frame index to file {}",
+                            filename_);
+    }
+    return success;
+}
+
+RGBDSequenceReader::RGBDSequenceReader(int num_threads /* = -1*/,
+                                       size_t max_prefetched_frames /* = 8*/)
+    : num_threads_(num_threads),
+      max_prefetched_frames_(max_prefetched_frames),
+      file_(nullptr) {}
+
+RGBDSequenceReader::~RGBDSequenceReader() { Close(); }
+
+bool RGBDSequenceReader::Open(const std::string &filename) {
+    if (IsOpened()) {
+        Close();
+    }
+    file_ = utility::filesystem::FOpen(filename, "rb");
+    if (file_ == nullptr) {
+        utility::LogWarning("Unable to open file {}", filename);
+        return false;
+    }
+    char magic[8];
+    uint32_t version_and_reserved[2];
+    if (fread(magic, 1, 8, file_) != 8 ||
+        fread(version_and_reserved, 4, 2, file_) != 2 ||
+        memcmp(magic, kFileMagic, 8) != 0 ||
+        version_and_reserved[0] != kFileVersion) {
+        utility::LogWarning("{} is not a recorded RGBD sequence.", filename);
+        fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+
+    Seek(file_, 0, SEEK_END);
+    uint64_t file_size = Tell(file_);
+    uint64_t num_frames = 0, index_offset = 0;
+    bool has_index = false;
+    if (file_size >= kFileHeaderSize + kFileTrailerSize &&
+        Seek(file_, file_size - kFileTrailerSize) == 0 &&
+        fread(&num_frames, 8, 1, file_) == 1 &&
+        fread(&index_offset, 8, 1, file_) == 1 &&
+        fread(magic, 1, 8, file_) == 8 &&
+        memcmp(magic, kIndexMagic, 8) == 0 &&
+        index_offset >= kFileHeaderSize &&
+        index_offset <= file_size - kFileTrailerSize &&
+        num_frames <= (file_size - kFileTrailerSize - index_offset) / 8 &&
+        index_offset + num_frames * 8 + kFileTrailerSize == file_size) {
+        frame_offsets_.resize(num_frames + 1);
+        has_index = Seek(file_, index_offset) == 0 &&
+                    fread(frame_offsets_.data(), 8, num_frames, file_) ==
+                            num_frames;
+        frame_offsets_[num_frames] = index_offset;
+        // the records follow each other between the header and the index
+        uint64_t min_offset = kFileHeaderSize;
+        for (uint64_t i = 0; i < num_frames && has_index; i++) {
+            has_index = frame_offsets_[i] >= min_offset &&
+                        frame_offsets_[i] < index_offset;
+            min_offset = frame_offsets_[i] + 1;
+        }
+    }
+    if (!has_index) {
+        utility::LogWarning(
+                "{} has no frame index, the recording may have been "
+                "interrupted. Scanning the frames.",
+                filename);
+        ScanFrameOffsets(file_, file_size, frame_offsets_);
+    }
+
+    StartPrefetching(0);
+    return true;
+}
+
+void RGBDSequenceReader::Close() {
+    if (!IsOpened()) {
+        return;
+    }
+    prefetch_queue_.reset();
+    fclose(file_);
+    file_ = nullptr;
+    frame_offsets_.clear();
+}
+
+size_t RGBDSequenceReader::GetNumFrames() const {
+    return frame_offsets_.empty() ? 0 : frame_offsets_.size() - 1;
+}
+
+bool RGBDSequenceReader::IsEOF() const {
+    return !prefetch_queue_ || prefetch_queue_->IsEmpty();
+}
+
+bool RGBDSequenceReader::SeekFrame(size_t index) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    if (index >= GetNumFrames()) {
+        utility::LogWarning("Frame {} exceeds the number of frames {}.", index,
+                            GetNumFrames());
+        return false;
+    }
+    StartPrefetching(index);
+    return true;
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDSequenceReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (IsEOF()) {
+        return nullptr;
+    }
+    size_t index = prefetch_queue_->GetNextIndex();
+    auto frame = prefetch_queue_->Pop();
+    if (!frame) {
+        utility::LogWarning("Unable to decode frame {}.", index);
+    }
+    return frame;
+}
+
+std::shared_ptr<geometry::RGBDImage> RGBDSequenceReader::ReadFrame(
+        size_t index) {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (index >= GetNumFrames()) {
+        utility::LogWarning("Frame {} exceeds the number of frames {}.", index,
+                            GetNumFrames());
+        return nullptr;
+    }
+    std::vector<uint8_t> record;
+    std::shared_ptr<geometry::RGBDImage> frame;
+    if (ReadFrameRecord(index, record)) {
+        frame = DecodeFrame(record);
+    }
+    if (!frame) {
+        utility::LogWarning("Unable to decode frame {}.", index);
+    }
+    return frame;
+}
+
+void RGBDSequenceReader::StartPrefetching(size_t first) {
+    // the previous queue is stopped before the new one starts reading
+    prefetch_queue_.reset();
+    prefetch_queue_.reset(
+            new utility::PrefetchQueue<std::shared_ptr<geometry::RGBDImage>>(
+                    first, GetNumFrames(),
+                    [this](size_t index) {
+                        std::vector<uint8_t> record;
+                        std::shared_ptr<geometry::RGBDImage> frame;
+                        if (ReadFrameRecord(index, record)) {
+                            frame = DecodeFrame(record);
+                        }
+                        return frame;
+                    },
+                    num_threads_, max_prefetched_frames_));
+}
+
+bool RGBDSequenceReader::ReadFrameRecord(size_t index,
+                                         std::vector<uint8_t> &record) {
+    uint64_t begin = frame_offsets_[index];
+    uint64_t end = frame_offsets_[index + 1];
+    if (end < begin) {
+        return false;
+    }
+    record.resize(end - begin);
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    return Seek(file_, begin) == 0 &&
+           fread(record.data(), 1, record.size(), file_) == record.size();
+}
+
+}  // namespace io
+}  // namespace open3d
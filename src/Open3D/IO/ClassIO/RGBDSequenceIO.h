@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+/// \class RGBDSequenceWriter
+///
+/// \brief Writer of recorded RGBD sequences (.o3drgbd), a sensor agnostic
+/// container of compressed depth and color frames.
+///
+/// Every frame is stored as an independently LZF compressed record, 16 bit
+/// depth is delta encoded along rows first. A frame index is appended when
+/// the file is closed, so that readers can seek and decode frames in
+/// parallel. Recordings that were not closed are still readable.
+class RGBDSequenceWriter {
+public:
+    RGBDSequenceWriter();
+    virtual ~RGBDSequenceWriter();
+
+public:
+    /// Create a recording file, closing the previous one if any.
+    bool Open(const std::string &filename);
+    /// Check if a recording file is opened.
+    bool IsOpened() const { return file_ != nullptr; }
+    /// Compress and append one frame. The color image may be empty.
+    bool WriteFrame(const geometry::RGBDImage &rgbd);
+    /// Write the frame index and close the file.
+    bool Close();
+    /// Number of frames written to the opened file.
+    size_t GetNumFrames() const { return frame_offsets_.size(); }
+
+private:
+    FILE *file_;
+    std::string filename_;
+    std::vector<uint64_t> frame_offsets_;
+    uint64_t file_size_;
+};
+
+/// \class RGBDSequenceReader
+///
+/// \brief Reader of recorded RGBD sequences written by RGBDSequenceWriter.
+///
+/// NextFrame() plays the sequence back in order. Frames ahead of the
+/// playback position are read and decoded on a pool of background threads
+/// into a bounded queue, so that replaying is not bound by decoding.
+class RGBDSequenceReader {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param num_threads Number of decoding threads, the number of hardware
+    /// threads if not positive.
+    /// \param max_prefetched_frames Maximum number of decoded frames waiting
+    /// in the queue.
+    RGBDSequenceReader(int num_threads = -1, size_t max_prefetched_frames = 8);
+    virtual ~RGBDSequenceReader();
+
+public:
+    /// Open a recording and start prefetching from its first frame.
+    bool Open(const std::string &filename);
+    /// Check if a recording is opened.
+    bool IsOpened() const { return file_ != nullptr; }
+    /// Stop prefetching and close the recording.
+    void Close();
+    /// Number of frames in the recording.
+    size_t GetNumFrames() const;
+    /// Check if all frames have been played back.
+    bool IsEOF() const;
+    /// Move the playback position to frame \p index.
+    bool SeekFrame(size_t index);
+    /// Get the frame at the playback position and advance it, returns nullptr
+    /// at the end of the recording or if the frame cannot be decoded.
+    std::shared_ptr<geometry::RGBDImage> NextFrame();
+    /// Read and decode frame \p index on the calling thread, independently of
+    /// the playback position.
+    std::shared_ptr<geometry::RGBDImage> ReadFrame(size_t index);
+
+private:
+    void StartPrefetching(size_t first);
+    bool ReadFrameRecord(size_t index, std::vector<uint8_t> &record);
+
+private:
+    int num_threads_;
+    size_t max_prefetched_frames_;
+
+    FILE *file_;
+    std::mutex file_mutex_;
+    /// Offsets of the frame records, the last entry is where the records end.
+    std::vector<uint64_t> frame_offsets_;
+
+    std::unique_ptr<
+            utility::PrefetchQueue<std::shared_ptr<geometry::RGBDImage>>>
+            prefetch_queue_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -87,6 +87,16 @@ bool WriteTriangleMeshToSTL(const std::string &filename,
                             bool write_triangle_uvs,
                             bool print_progress);
 
+/// \brief Function to read a binary STL file as an indexed mesh.
+///
+/// STL files store three vertices per facet. Vertices with identical
+/// coordinates are merged with a parallel sort, see
+/// TriangleMesh::RemoveDuplicatedVertices.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadIndexedTriangleMeshFromSTL(const std::string &filename,
+                                    geometry::TriangleMesh &mesh,
+                                    bool print_progress = false);
+
 bool ReadTriangleMeshFromOBJ(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
@@ -24,10 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 
@@ -72,6 +78,254 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+// Pose graphs and trajectories start with this header, followed by records
+// of fixed size that hold packed doubles.
+struct BINHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t num_records[2];
+};
+
+const char kPoseGraphBINMagic[8] = {'O', '3', 'D', 'P', 'G', 'B', 'I', 'N'};
+const char kTrajectoryBINMagic[8] = {'O', '3', 'D', 'C', 'T', 'B', 'I', 'N'};
+const uint32_t kBINVersion = 1;
+// The information matrices are symmetric and only their upper triangle is
+// stored.
+const uint32_t kBINUpperTriangleFlag = 1;
+// Records are encoded and decoded in batches of this size.
+const size_t kBINBatchSize = 4096;
+
+struct PoseGraphEdgeBINRecord {
+    int32_t source_node_id;
+    int32_t target_node_id;
+    int32_t uncertain;
+    int32_t reserved;
+    double confidence;
+};
+
+struct PinholeCameraParametersBINRecord {
+    int32_t width;
+    int32_t height;
+};
+
+const size_t kPoseGraphNodeBINSize = 16 * sizeof(double);
+const size_t kTrajectoryBINSize =
+        sizeof(PinholeCameraParametersBINRecord) + 25 * sizeof(double);
+
+size_t GetPoseGraphEdgeBINSize(uint32_t flags) {
+    return sizeof(PoseGraphEdgeBINRecord) + 16 * sizeof(double) +
+           ((flags & kBINUpperTriangleFlag) ? 21 : 36) * sizeof(double);
+}
+
+bool ReadBINHeader(FILE *file, const char *magic, BINHeader &header) {
+    if (fread(&header, sizeof(BINHeader), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    if (memcmp(header.magic, magic, sizeof(header.magic)) != 0 ||
+        header.version != kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported file.");
+        return false;
+    }
+    return true;
+}
+
+bool WriteBINHeader(FILE *file,
+                    const char *magic,
+                    uint32_t flags,
+                    uint64_t num_records0,
+                    uint64_t num_records1) {
+    BINHeader header;
+    memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = kBINVersion;
+    header.flags = flags;
+    header.num_records[0] = num_records0;
+    header.num_records[1] = num_records1;
+    if (fwrite(&header, sizeof(BINHeader), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+/// Reads \p num_records records of \p record_size bytes in batches, the
+/// containers grow with the records that were read so that a corrupted count
+/// fails at the end of the file.
+bool ReadBINRecords(FILE *file,
+                    uint64_t num_records,
+                    size_t record_size,
+                    const std::function<void(const char *)> &decode) {
+    std::vector<char> buffer(kBINBatchSize * record_size);
+    for (uint64_t i = 0; i < num_records; i += kBINBatchSize) {
+        const size_t batch_size = (size_t)std::min<uint64_t>(
+                kBINBatchSize, num_records - i);
+        if (fread(buffer.data(), record_size, batch_size, file) <
+            batch_size) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+        for (size_t j = 0; j < batch_size; j++) {
+            decode(buffer.data() + j * record_size);
+        }
+    }
+    return true;
+}
+
+bool WriteBINRecords(FILE *file,
+                     size_t num_records,
+                     size_t record_size,
+                     const std::function<void(size_t, char *)> &encode) {
+    std::vector<char> buffer(kBINBatchSize * record_size);
+    for (size_t i = 0; i < num_records; i += kBINBatchSize) {
+        const size_t batch_size = std::min(kBINBatchSize, num_records - i);
+        for (size_t j = 0; j < batch_size; j++) {
+            encode(i + j, buffer.data() + j * record_size);
+        }
+        if (fwrite(buffer.data(), record_size, batch_size, file) <
+            batch_size) {
+            utility::LogWarning("Write BIN failed: unexpected error.");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadPoseGraphFromBINFile(FILE *file, registration::PoseGraph &pose_graph) {
+    BINHeader header;
+    if (!ReadBINHeader(file, kPoseGraphBINMagic, header)) {
+        return false;
+    }
+    const bool upper_triangle = (header.flags & kBINUpperTriangleFlag) != 0;
+    auto decode_node = [&pose_graph](const char *record) {
+        registration::PoseGraphNode node;
+        memcpy(node.pose_.data(), record, 16 * sizeof(double));
+        pose_graph.nodes_.push_back(node);
+    };
+    auto decode_edge = [&pose_graph, upper_triangle](const char *record) {
+        PoseGraphEdgeBINRecord edge_record;
+        memcpy(&edge_record, record, sizeof(PoseGraphEdgeBINRecord));
+        record += sizeof(PoseGraphEdgeBINRecord);
+        registration::PoseGraphEdge edge(
+                edge_record.source_node_id, edge_record.target_node_id,
+                Eigen::Matrix4d::Identity(), Eigen::Matrix6d::Identity(),
+                edge_record.uncertain != 0, edge_record.confidence);
+        memcpy(edge.transformation_.data(), record, 16 * sizeof(double));
+        record += 16 * sizeof(double);
+        if (upper_triangle) {
+            double values[21];
+            memcpy(values, record, sizeof(values));
+            for (int c = 0, k = 0; c < 6; c++) {
+                for (int r = 0; r <= c; r++, k++) {
+                    edge.information_(r, c) = values[k];
+                    edge.information_(c, r) = values[k];
+                }
+            }
+        } else {
+            memcpy(edge.information_.data(), record, 36 * sizeof(double));
+        }
+        pose_graph.edges_.push_back(edge);
+    };
+    return ReadBINRecords(file, header.num_records[0], kPoseGraphNodeBINSize,
+                          decode_node) &&
+           ReadBINRecords(file, header.num_records[1],
+                          GetPoseGraphEdgeBINSize(header.flags), decode_edge);
+}
+
+bool WritePoseGraphToBINFile(FILE *file,
+                             const registration::PoseGraph &pose_graph) {
+    uint32_t flags = kBINUpperTriangleFlag;
+    for (const auto &edge : pose_graph.edges_) {
+        if (!(edge.information_ == edge.information_.transpose())) {
+            flags = 0;
+            break;
+        }
+    }
+    if (!WriteBINHeader(file, kPoseGraphBINMagic, flags,
+                        pose_graph.nodes_.size(), pose_graph.edges_.size())) {
+        return false;
+    }
+    auto encode_node = [&pose_graph](size_t i, char *record) {
+        memcpy(record, pose_graph.nodes_[i].pose_.data(), 16 * sizeof(double));
+    };
+    auto encode_edge = [&pose_graph, flags](size_t i, char *record) {
+        const registration::PoseGraphEdge &edge = pose_graph.edges_[i];
+        PoseGraphEdgeBINRecord edge_record;
+        edge_record.source_node_id = edge.source_node_id_;
+        edge_record.target_node_id = edge.target_node_id_;
+        edge_record.uncertain = edge.uncertain_ ? 1 : 0;
+        edge_record.reserved = 0;
+        edge_record.confidence = edge.confidence_;
+        memcpy(record, &edge_record, sizeof(PoseGraphEdgeBINRecord));
+        record += sizeof(PoseGraphEdgeBINRecord);
+        memcpy(record, edge.transformation_.data(), 16 * sizeof(double));
+        record += 16 * sizeof(double);
+        if (flags & kBINUpperTriangleFlag) {
+            double values[21];
+            for (int c = 0, k = 0; c < 6; c++) {
+                for (int r = 0; r <= c; r++, k++) {
+                    values[k] = edge.information_(r, c);
+                }
+            }
+            memcpy(record, values, sizeof(values));
+        } else {
+            memcpy(record, edge.information_.data(), 36 * sizeof(double));
+        }
+    };
+    return WriteBINRecords(file, pose_graph.nodes_.size(),
+                           kPoseGraphNodeBINSize, encode_node) &&
+           WriteBINRecords(file, pose_graph.edges_.size(),
+                           GetPoseGraphEdgeBINSize(flags), encode_edge);
+}
+
+bool ReadPinholeCameraTrajectoryFromBINFile(
+        FILE *file, camera::PinholeCameraTrajectory &trajectory) {
+    BINHeader header;
+    if (!ReadBINHeader(file, kTrajectoryBINMagic, header)) {
+        return false;
+    }
+    auto decode = [&trajectory](const char *record) {
+        PinholeCameraParametersBINRecord parameters_record;
+        memcpy(&parameters_record, record,
+               sizeof(PinholeCameraParametersBINRecord));
+        record += sizeof(PinholeCameraParametersBINRecord);
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.width_ = parameters_record.width;
+        parameters.intrinsic_.height_ = parameters_record.height;
+        memcpy(parameters.intrinsic_.intrinsic_matrix_.data(), record,
+               9 * sizeof(double));
+        record += 9 * sizeof(double);
+        memcpy(parameters.extrinsic_.data(), record, 16 * sizeof(double));
+        trajectory.parameters_.push_back(parameters);
+    };
+    return ReadBINRecords(file, header.num_records[0], kTrajectoryBINSize,
+                          decode);
+}
+
+bool WritePinholeCameraTrajectoryToBINFile(
+        FILE *file, const camera::PinholeCameraTrajectory &trajectory) {
+    if (!WriteBINHeader(file, kTrajectoryBINMagic, 0,
+                        trajectory.parameters_.size(), 0)) {
+        return false;
+    }
+    auto encode = [&trajectory](size_t i, char *record) {
+        const camera::PinholeCameraParameters &parameters =
+                trajectory.parameters_[i];
+        PinholeCameraParametersBINRecord parameters_record;
+        parameters_record.width = parameters.intrinsic_.width_;
+        parameters_record.height = parameters.intrinsic_.height_;
+        memcpy(record, &parameters_record,
+               sizeof(PinholeCameraParametersBINRecord));
+        record += sizeof(PinholeCameraParametersBINRecord);
+        memcpy(record, parameters.intrinsic_.intrinsic_matrix_.data(),
+               9 * sizeof(double));
+        record += 9 * sizeof(double);
+        memcpy(record, parameters.extrinsic_.data(), 16 * sizeof(double));
+    };
+    return WriteBINRecords(file, trajectory.parameters_.size(),
+                           kTrajectoryBINSize, encode);
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +356,62 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    pose_graph.nodes_.clear();
+    pose_graph.edges_.clear();
+    bool success = ReadPoseGraphFromBINFile(fid, pose_graph);
+    fclose(fid);
+    return success;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WritePoseGraphToBINFile(fid, pose_graph);
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    trajectory.parameters_.clear();
+    bool success = ReadPinholeCameraTrajectoryFromBINFile(fid, trajectory);
+    fclose(fid);
+    return success;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WritePinholeCameraTrajectoryToBINFile(fid, trajectory);
+    fclose(fid);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -0,0 +1,829 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Parallel.h"
+
+// Layout of an o3dpc file:
+//
+//   FileHeader
+//   chunk records, one per kChunkSize points
+//   ChunkIndexEntry for every chunk
+//   FileTrailer
+//
+// A chunk record stores the positions, normals and colors of its points as
+// separate columns, each starting with a ColumnHeader. Chunks are encoded and
+// decoded independently, and the bounding boxes in the index allow readers to
+// skip chunks outside of a crop box without decoding them.
+
+namespace open3d {
+
+namespace {
+
+const char kFileMagic[8] = {'O', '3', 'D', 'P', 'C', 'O', 'L', 'S'};
+const char kIndexMagic[8] = {'O', '3', 'D', 'P', 'C', 'I', 'D', 'X'};
+const uint32_t kFileVersion = 1;
+const uint32_t kChunkSize = 1 << 16;
+/// Maximum error of compressed positions relative to the largest extent of
+/// the point cloud, which puts every chunk on a grid of at most 2^20 cells
+/// per axis.
+const double kDefaultPositionPrecision = 1.0 / double(1 << 21);
+
+const uint32_t kFlagHasNormals = 1;
+const uint32_t kFlagHasColors = 2;
+
+/// Doubles with their bytes transposed, LZF compressed if that is smaller.
+const uint32_t kCodecShuffledDouble = 1;
+/// Positions quantized to a grid, bit packed per axis.
+const uint32_t kCodecQuantizedPosition = 2;
+/// Unit vectors in 16 bit octahedral coordinates.
+const uint32_t kCodecOctahedral16 = 3;
+/// Colors in 8 bits per channel stored in planes, LZF compressed if that is
+/// smaller.
+const uint32_t kCodecColor8 = 4;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t num_points;
+    uint64_t num_chunks;
+    /// Size of the quantization grid, 0 if positions are stored losslessly.
+    double position_step;
+};
+
+struct ChunkIndexEntry {
+    uint64_t offset;
+    uint64_t size;
+    uint64_t num_points;
+    double min_bound[3];
+    double max_bound[3];
+};
+
+struct FileTrailer {
+    uint64_t index_offset;
+    char magic[8];
+};
+
+struct ColumnHeader {
+    uint32_t codec;
+    uint32_t reserved;
+    uint64_t stored_size;
+};
+
+template <typename T>
+void Append(std::vector<uint8_t> &buffer, const T &value) {
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+bool Extract(const uint8_t *&ptr, const uint8_t *end, T &value) {
+    if (end - ptr < (ptrdiff_t)sizeof(T)) {
+        return false;
+    }
+    memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+/// Appends a column of \p size bytes, compressed with LZF if that is smaller.
+void AppendLZFColumn(std::vector<uint8_t> &record,
+                     uint32_t codec,
+                     const std::vector<uint8_t> &data) {
+    ColumnHeader header;
+    header.codec = codec;
+    header.reserved = 0;
+    header.stored_size = data.size();
+    const size_t offset = record.size();
+    record.resize(offset + sizeof(header) + data.size());
+    uint8_t *payload = record.data() + offset + sizeof(header);
+    unsigned int compressed_size = 0;
+    if (data.size() > 1) {
+        compressed_size = lzf_compress(data.data(), (unsigned int)data.size(),
+                                       payload, (unsigned int)data.size() - 1);
+    }
+    if (compressed_size > 0) {
+        header.stored_size = compressed_size;
+    } else {
+        memcpy(payload, data.data(), data.size());
+    }
+    memcpy(record.data() + offset, &header, sizeof(header));
+    record.resize(offset + sizeof(header) + header.stored_size);
+}
+
+/// Reads a column written by AppendLZFColumn into \p data, whose size is the
+/// expected size of the uncompressed column.
+bool ExtractLZFColumn(const uint8_t *payload,
+                      uint64_t stored_size,
+                      std::vector<uint8_t> &data) {
+    if (stored_size == data.size()) {
+        memcpy(data.data(), payload, data.size());
+        return true;
+    }
+    return lzf_decompress(payload, (unsigned int)stored_size, data.data(),
+                          (unsigned int)data.size()) == data.size();
+}
+
+// The bytes of doubles are transposed so that the similar sign and exponent
+// bytes of neighboring values form long runs for LZF.
+void EncodeShuffledDoubles(const std::vector<Eigen::Vector3d> &values,
+                           size_t first,
+                           size_t count,
+                           std::vector<uint8_t> &record) {
+    const size_t num_values = count * 3;
+    std::vector<uint8_t> shuffled(num_values * sizeof(double));
+    const uint8_t *bytes =
+            reinterpret_cast<const uint8_t *>(values[first].data());
+    for (size_t i = 0; i < num_values; i++) {
+        for (size_t b = 0; b < sizeof(double); b++) {
+            shuffled[b * num_values + i] = bytes[i * sizeof(double) + b];
+        }
+    }
+    AppendLZFColumn(record, kCodecShuffledDouble, shuffled);
+}
+
+bool DecodeShuffledDoubles(const uint8_t *payload,
+                           uint64_t stored_size,
+                           size_t count,
+                           Eigen::Vector3d *values) {
+    const size_t num_values = count * 3;
+    std::vector<uint8_t> shuffled(num_values * sizeof(double));
+    if (!ExtractLZFColumn(payload, stored_size, shuffled)) {
+        return false;
+    }
+    uint8_t *bytes = reinterpret_cast<uint8_t *>(values->data());
+    for (size_t i = 0; i < num_values; i++) {
+        for (size_t b = 0; b < sizeof(double); b++) {
+            bytes[i * sizeof(double) + b] = shuffled[b * num_values + i];
+        }
+    }
+    return true;
+}
+
+int GetNumBits(uint32_t value) {
+    int num_bits = 0;
+    while (num_bits < 32 && (value >> num_bits) != 0) {
+        num_bits++;
+    }
+    return num_bits;
+}
+
+void PackBits(const std::vector<uint32_t> &values,
+              int num_bits,
+              std::vector<uint8_t> &record) {
+    uint64_t accumulator = 0;
+    int num_pending_bits = 0;
+    for (uint32_t value : values) {
+        accumulator |= uint64_t(value) << num_pending_bits;
+        num_pending_bits += num_bits;
+        while (num_pending_bits >= 8) {
+            record.push_back(uint8_t(accumulator & 0xff));
+            accumulator >>= 8;
+            num_pending_bits -= 8;
+        }
+    }
+    if (num_pending_bits > 0) {
+        record.push_back(uint8_t(accumulator & 0xff));
+    }
+}
+
+bool UnpackBits(const uint8_t *&ptr,
+                const uint8_t *end,
+                int num_bits,
+                std::vector<uint32_t> &values) {
+    const size_t num_bytes = (values.size() * num_bits + 7) / 8;
+    if (num_bits > 32 || size_t(end - ptr) < num_bytes) {
+        return false;
+    }
+    const uint64_t mask = (uint64_t(1) << num_bits) - 1;
+    uint64_t accumulator = 0;
+    int num_pending_bits = 0;
+    for (uint32_t &value : values) {
+        while (num_pending_bits < num_bits) {
+            accumulator |= uint64_t(*ptr++) << num_pending_bits;
+            num_pending_bits += 8;
+        }
+        value = uint32_t(accumulator & mask);
+        accumulator >>= num_bits;
+        num_pending_bits -= num_bits;
+    }
+    return true;
+}
+
+inline uint32_t ZigZagEncode(int64_t value) {
+    return uint32_t((value << 1) ^ (value >> 63));
+}
+
+inline int64_t ZigZagDecode(uint32_t value) {
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+// The quantized coordinates of every axis are bit packed either directly or
+// as zigzag encoded differences to the previous point, whichever is smaller.
+// Scanned point clouds are mostly spatially coherent in storage order, so the
+// differences need fewer bits.
+bool EncodeQuantizedPositions(const std::vector<Eigen::Vector3d> &points,
+                              size_t first,
+                              size_t count,
+                              double step,
+                              const Eigen::Vector3d &min_bound,
+                              const Eigen::Vector3d &max_bound,
+                              std::vector<uint8_t> &record) {
+    // min_bound and max_bound skip NaN coordinates, which cannot be
+    // quantized
+    for (size_t i = 0; i < count; i++) {
+        if (!points[first + i].allFinite()) {
+            return false;
+        }
+    }
+    // the differences of the grid coordinates must fit the zigzag encoding
+    const double max_grid_coordinate = double(1u << 31) - 1.0;
+    for (int axis = 0; axis < 3; axis++) {
+        if (!((max_bound(axis) - min_bound(axis)) / step <
+              max_grid_coordinate)) {
+            return false;
+        }
+    }
+    std::vector<uint8_t> payload;
+    Append(payload, step);
+    for (int axis = 0; axis < 3; axis++) {
+        Append(payload, min_bound(axis));
+    }
+    std::vector<uint32_t> values(count);
+    std::vector<uint32_t> deltas(count);
+    for (int axis = 0; axis < 3; axis++) {
+        uint32_t max_value = 0;
+        uint32_t max_delta = 0;
+        int64_t prev = 0;
+        for (size_t i = 0; i < count; i++) {
+            values[i] = uint32_t(std::llround(
+                    (points[first + i](axis) - min_bound(axis)) / step));
+            deltas[i] = ZigZagEncode(int64_t(values[i]) - prev);
+            prev = values[i];
+            max_value = std::max(max_value, values[i]);
+            max_delta = std::max(max_delta, deltas[i]);
+        }
+        const uint8_t use_deltas =
+                GetNumBits(max_delta) < GetNumBits(max_value) ? 1 : 0;
+        // constant axes also get one bit, which bounds the number of points
+        // a record of a given size can hold, see GetMinRecordSize
+        const uint8_t num_bits = uint8_t(
+                std::max(1, GetNumBits(use_deltas ? max_delta : max_value)));
+        payload.push_back(use_deltas);
+        payload.push_back(num_bits);
+        PackBits(use_deltas ? deltas : values, num_bits, payload);
+    }
+    ColumnHeader header;
+    header.codec = kCodecQuantizedPosition;
+    header.reserved = 0;
+    header.stored_size = payload.size();
+    Append(record, header);
+    record.insert(record.end(), payload.begin(), payload.end());
+    return true;
+}
+
+bool DecodeQuantizedPositions(const uint8_t *ptr,
+                              const uint8_t *end,
+                              size_t count,
+                              Eigen::Vector3d *points) {
+    double step;
+    Eigen::Vector3d origin;
+    if (!Extract(ptr, end, step)) {
+        return false;
+    }
+    for (int axis = 0; axis < 3; axis++) {
+        if (!Extract(ptr, end, origin(axis))) {
+            return false;
+        }
+    }
+    std::vector<uint32_t> values(count);
+    for (int axis = 0; axis < 3; axis++) {
+        uint8_t use_deltas, num_bits;
+        if (!Extract(ptr, end, use_deltas) || !Extract(ptr, end, num_bits) ||
+            !UnpackBits(ptr, end, num_bits, values)) {
+            return false;
+        }
+        int64_t value = 0;
+        for (size_t i = 0; i < count; i++) {
+            value = use_deltas ? value + ZigZagDecode(values[i])
+                               : int64_t(values[i]);
+            points[i](axis) = origin(axis) + double(value) * step;
+        }
+    }
+    return true;
+}
+
+// Octahedral mapping of unit vectors to the square [-1, 1]^2, see Cigolle et
+// al., "A Survey of Efficient Representations for Independent Unit Vectors".
+void EncodeOctahedralNormals(const std::vector<Eigen::Vector3d> &normals,
+                             size_t first,
+                             size_t count,
+                             std::vector<uint8_t> &record) {
+    ColumnHeader header;
+    header.codec = kCodecOctahedral16;
+    header.reserved = 0;
+    header.stored_size = count * 2 * sizeof(uint16_t);
+    Append(record, header);
+    for (size_t i = 0; i < count; i++) {
+        const Eigen::Vector3d &normal = normals[first + i];
+        const double norm = normal.lpNorm<1>();
+        double u = 0.0;
+        double v = 0.0;
+        if (norm > 0.0) {
+            u = normal(0) / norm;
+            v = normal(1) / norm;
+            if (normal(2) < 0.0) {
+                const double folded_u = (1.0 - std::abs(v)) * (u < 0 ? -1 : 1);
+                v = (1.0 - std::abs(u)) * (v < 0 ? -1 : 1);
+                u = folded_u;
+            }
+        }
+        Append(record, uint16_t(std::lround((u * 0.5 + 0.5) * 65535.0)));
+        Append(record, uint16_t(std::lround((v * 0.5 + 0.5) * 65535.0)));
+    }
+}
+
+bool DecodeOctahedralNormals(const uint8_t *ptr,
+                             const uint8_t *end,
+                             size_t count,
+                             Eigen::Vector3d *normals) {
+    if (size_t(end - ptr) < count * 2 * sizeof(uint16_t)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uint16_t encoded[2];
+        memcpy(encoded, ptr + i * sizeof(encoded), sizeof(encoded));
+        double u = encoded[0] / 65535.0 * 2.0 - 1.0;
+        double v = encoded[1] / 65535.0 * 2.0 - 1.0;
+        const double w = 1.0 - std::abs(u) - std::abs(v);
+        if (w < 0.0) {
+            const double folded_u = (1.0 - std::abs(v)) * (u < 0 ? -1 : 1);
+            v = (1.0 - std::abs(u)) * (v < 0 ? -1 : 1);
+            u = folded_u;
+        }
+        normals[i] = Eigen::Vector3d(u, v, w).normalized();
+    }
+    return true;
+}
+
+void EncodeColors8(const std::vector<Eigen::Vector3d> &colors,
+                   size_t first,
+                   size_t count,
+                   std::vector<uint8_t> &record) {
+    std::vector<uint8_t> planes(count * 3);
+    for (size_t i = 0; i < count; i++) {
+        for (int c = 0; c < 3; c++) {
+            const double value =
+                    std::min(std::max(colors[first + i](c), 0.0), 1.0);
+            planes[c * count + i] = uint8_t(std::lround(value * 255.0));
+        }
+    }
+    AppendLZFColumn(record, kCodecColor8, planes);
+}
+
+bool DecodeColors8(const uint8_t *payload,
+                   uint64_t stored_size,
+                   size_t count,
+                   Eigen::Vector3d *colors) {
+    std::vector<uint8_t> planes(count * 3);
+    if (!ExtractLZFColumn(payload, stored_size, planes)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        colors[i] = Eigen::Vector3d(planes[i], planes[count + i],
+                                    planes[2 * count + i]) /
+                    255.0;
+    }
+    return true;
+}
+
+bool DecodeColumn(const uint8_t *&ptr,
+                  const uint8_t *end,
+                  size_t count,
+                  Eigen::Vector3d *values) {
+    ColumnHeader header;
+    if (!Extract(ptr, end, header) ||
+        uint64_t(end - ptr) < header.stored_size) {
+        return false;
+    }
+    const uint8_t *payload = ptr;
+    ptr += header.stored_size;
+    switch (header.codec) {
+        case kCodecShuffledDouble:
+            return DecodeShuffledDoubles(payload, header.stored_size, count,
+                                         values);
+        case kCodecQuantizedPosition:
+            return DecodeQuantizedPositions(payload, ptr, count, values);
+        case kCodecOctahedral16:
+            return DecodeOctahedralNormals(payload, ptr, count, values);
+        case kCodecColor8:
+            return DecodeColors8(payload, header.stored_size, count, values);
+        default:
+            return false;
+    }
+}
+
+void EncodeChunk(const geometry::PointCloud &pointcloud,
+                 size_t first,
+                 size_t count,
+                 double position_step,
+                 std::vector<uint8_t> &record,
+                 ChunkIndexEntry &entry) {
+    Eigen::Vector3d min_bound = pointcloud.points_[first];
+    Eigen::Vector3d max_bound = pointcloud.points_[first];
+    for (size_t i = first + 1; i < first + count; i++) {
+        min_bound = min_bound.cwiseMin(pointcloud.points_[i]);
+        max_bound = max_bound.cwiseMax(pointcloud.points_[i]);
+    }
+    record.clear();
+    // positions that do not fit the grid, e.g. because of non-finite values,
+    // are stored losslessly
+    if (position_step <= 0.0 ||
+        !EncodeQuantizedPositions(pointcloud.points_, first, count,
+                                  position_step, min_bound, max_bound,
+                                  record)) {
+        EncodeShuffledDoubles(pointcloud.points_, first, count, record);
+    }
+    if (pointcloud.HasNormals()) {
+        if (position_step > 0.0) {
+            EncodeOctahedralNormals(pointcloud.normals_, first, count, record);
+        } else {
+            EncodeShuffledDoubles(pointcloud.normals_, first, count, record);
+        }
+    }
+    if (pointcloud.HasColors()) {
+        if (position_step > 0.0) {
+            EncodeColors8(pointcloud.colors_, first, count, record);
+        } else {
+            EncodeShuffledDoubles(pointcloud.colors_, first, count, record);
+        }
+    }
+    entry.size = record.size();
+    entry.num_points = count;
+    for (int i = 0; i < 3; i++) {
+        entry.min_bound[i] = min_bound(i);
+        entry.max_bound[i] = max_bound(i);
+    }
+}
+
+/// Lower bound of the size of a chunk record with \p count points, which
+/// keeps a small corrupted file from claiming a huge number of points.
+uint64_t GetMinRecordSize(const FileHeader &header, uint64_t count) {
+    // a back reference of LZF expands 3 bytes to at most 264 bytes
+    auto lzf_size = [](uint64_t size) { return (size + 87) / 88; };
+    const uint64_t column_size = sizeof(ColumnHeader);
+    const uint64_t doubles_size = column_size + lzf_size(count * 24);
+    uint64_t size = doubles_size;
+    if (header.position_step > 0.0) {
+        // quantized positions use at least one bit per axis, and the
+        // positions of a chunk that does not fit the grid are doubles
+        const uint64_t quantized_size =
+                column_size + 4 * sizeof(double) + 3 * (2 + (count + 7) / 8);
+        size = std::min(quantized_size, doubles_size);
+    }
+    if ((header.flags & kFlagHasNormals) != 0) {
+        size += header.position_step > 0.0 ? column_size + count * 4
+                                           : doubles_size;
+    }
+    if ((header.flags & kFlagHasColors) != 0) {
+        size += header.position_step > 0.0 ? column_size + lzf_size(count * 3)
+                                           : doubles_size;
+    }
+    return size;
+}
+
+/// A mapped o3dpc file with its validated header and chunk index.
+struct O3DPCFile {
+    utility::filesystem::MappedFile file;
+    FileHeader header;
+    std::vector<ChunkIndexEntry> index;
+    /// The first point of every chunk, the last entry is the number of points.
+    std::vector<size_t> chunk_offsets;
+
+    bool HasNormals() const { return (header.flags & kFlagHasNormals) != 0; }
+    bool HasColors() const { return (header.flags & kFlagHasColors) != 0; }
+};
+
+bool OpenO3DPCFile(const std::string &filename, O3DPCFile &o3dpc) {
+    if (!o3dpc.file.Map(filename)) {
+        utility::LogWarning("Read O3DPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const uint8_t *data =
+            reinterpret_cast<const uint8_t *>(o3dpc.file.GetData());
+    const uint64_t size = o3dpc.file.GetSize();
+    FileTrailer trailer;
+    if (size < sizeof(FileHeader) + sizeof(FileTrailer)) {
+        utility::LogWarning("Read O3DPC failed: {} is truncated.", filename);
+        return false;
+    }
+    memcpy(&o3dpc.header, data, sizeof(FileHeader));
+    memcpy(&trailer, data + size - sizeof(FileTrailer), sizeof(FileTrailer));
+    if (memcmp(o3dpc.header.magic, kFileMagic, sizeof(kFileMagic)) != 0 ||
+        memcmp(trailer.magic, kIndexMagic, sizeof(kIndexMagic)) != 0) {
+        utility::LogWarning("Read O3DPC failed: {} is not an o3dpc file.",
+                            filename);
+        return false;
+    }
+    if (o3dpc.header.version != kFileVersion) {
+        utility::LogWarning("Read O3DPC failed: unsupported version {:d}.",
+                            o3dpc.header.version);
+        return false;
+    }
+    if (o3dpc.header.num_chunks > size / sizeof(ChunkIndexEntry) ||
+        trailer.index_offset < sizeof(FileHeader) ||
+        trailer.index_offset > size - sizeof(FileTrailer) ||
+        o3dpc.header.num_chunks * sizeof(ChunkIndexEntry) !=
+                size - sizeof(FileTrailer) - trailer.index_offset) {
+        utility::LogWarning("Read O3DPC failed: {} has a corrupted index.",
+                            filename);
+        return false;
+    }
+    o3dpc.index.resize(o3dpc.header.num_chunks);
+    if (!o3dpc.index.empty()) {
+        memcpy(o3dpc.index.data(), data + trailer.index_offset,
+               o3dpc.index.size() * sizeof(ChunkIndexEntry));
+    }
+    o3dpc.chunk_offsets.assign(1, 0);
+    for (const auto &entry : o3dpc.index) {
+        if (entry.offset < sizeof(FileHeader) ||
+            entry.offset > trailer.index_offset ||
+            entry.size > trailer.index_offset - entry.offset ||
+            entry.num_points > kChunkSize ||
+            entry.size < GetMinRecordSize(o3dpc.header, entry.num_points)) {
+            utility::LogWarning("Read O3DPC failed: {} has a corrupted index.",
+                                filename);
+            return false;
+        }
+        o3dpc.chunk_offsets.push_back(o3dpc.chunk_offsets.back() +
+                                      size_t(entry.num_points));
+    }
+    if (o3dpc.chunk_offsets.back() != o3dpc.header.num_points) {
+        utility::LogWarning("Read O3DPC failed: {} has a corrupted index.",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+/// Decodes chunk \p c into the arrays starting at the given pointers.
+bool DecodeChunk(const O3DPCFile &o3dpc,
+                 size_t c,
+                 Eigen::Vector3d *points,
+                 Eigen::Vector3d *normals,
+                 Eigen::Vector3d *colors) {
+    const ChunkIndexEntry &entry = o3dpc.index[c];
+    const uint8_t *ptr =
+            reinterpret_cast<const uint8_t *>(o3dpc.file.GetData()) +
+            entry.offset;
+    const uint8_t *end = ptr + entry.size;
+    const size_t count = size_t(entry.num_points);
+    return DecodeColumn(ptr, end, count, points) &&
+           (!o3dpc.HasNormals() || DecodeColumn(ptr, end, count, normals)) &&
+           (!o3dpc.HasColors() || DecodeColumn(ptr, end, count, colors));
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+bool ReadPointCloudFromO3DPC(const std::string &filename,
+                             geometry::PointCloud &pointcloud,
+                             bool print_progress) {
+    O3DPCFile o3dpc;
+    if (!OpenO3DPCFile(filename, o3dpc)) {
+        return false;
+    }
+    const size_t num_points = o3dpc.chunk_offsets.back();
+    pointcloud.Clear();
+    pointcloud.points_.resize(num_points);
+    if (o3dpc.HasNormals()) {
+        pointcloud.normals_.resize(num_points);
+    }
+    if (o3dpc.HasColors()) {
+        pointcloud.colors_.resize(num_points);
+    }
+
+    const int num_chunks = int(o3dpc.index.size());
+    std::vector<uint8_t> is_chunk_valid(num_chunks, 0);
+    utility::ConsoleProgressBar progress_bar(num_chunks, "Reading O3DPC: ",
+                                             print_progress);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        const size_t offset = o3dpc.chunk_offsets[c];
+        is_chunk_valid[c] = DecodeChunk(
+                o3dpc, c, pointcloud.points_.data() + offset,
+                o3dpc.HasNormals() ? pointcloud.normals_.data() + offset
+                                   : nullptr,
+                o3dpc.HasColors() ? pointcloud.colors_.data() + offset
+                                  : nullptr);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        { ++progress_bar; }
+    }
+    if (std::find(is_chunk_valid.begin(), is_chunk_valid.end(), 0) !=
+        is_chunk_valid.end()) {
+        utility::LogWarning("Read O3DPC failed: {} has corrupted chunks.",
+                            filename);
+        pointcloud.Clear();
+        return false;
+    }
+    return true;
+}
+
+bool CropPointCloudFromO3DPC(const std::string &filename,
+                             const geometry::AxisAlignedBoundingBox &bbox,
+                             geometry::PointCloud &pointcloud,
+                             bool print_progress /* = false*/) {
+    O3DPCFile o3dpc;
+    if (!OpenO3DPCFile(filename, o3dpc)) {
+        return false;
+    }
+    // quantized positions may lie up to half a grid step beyond the chunk
+    // bounds
+    const double margin = o3dpc.header.position_step;
+    std::vector<size_t> chunks;
+    for (size_t c = 0; c < o3dpc.index.size(); c++) {
+        const ChunkIndexEntry &entry = o3dpc.index[c];
+        bool is_overlapping = true;
+        for (int i = 0; i < 3; i++) {
+            if (entry.max_bound[i] + margin < bbox.min_bound_(i) ||
+                entry.min_bound[i] - margin > bbox.max_bound_(i)) {
+                is_overlapping = false;
+            }
+        }
+        if (is_overlapping) {
+            chunks.push_back(c);
+        }
+    }
+
+    const int num_chunks = int(chunks.size());
+    std::vector<geometry::PointCloud> cropped(num_chunks);
+    std::vector<uint8_t> is_chunk_valid(num_chunks, 0);
+    utility::ConsoleProgressBar progress_bar(num_chunks, "Cropping O3DPC: ",
+                                             print_progress);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        const size_t count = size_t(o3dpc.index[chunks[c]].num_points);
+        geometry::PointCloud chunk;
+        chunk.points_.resize(count);
+        if (o3dpc.HasNormals()) {
+            chunk.normals_.resize(count);
+        }
+        if (o3dpc.HasColors()) {
+            chunk.colors_.resize(count);
+        }
+        is_chunk_valid[c] =
+                DecodeChunk(o3dpc, chunks[c], chunk.points_.data(),
+                            chunk.normals_.data(), chunk.colors_.data());
+        if (is_chunk_valid[c]) {
+            cropped[c] = *chunk.SelectByIndex(
+                    bbox.GetPointIndicesWithinBoundingBox(chunk.points_));
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        { ++progress_bar; }
+    }
+    pointcloud.Clear();
+    if (std::find(is_chunk_valid.begin(), is_chunk_valid.end(), 0) !=
+        is_chunk_valid.end()) {
+        utility::LogWarning("Read O3DPC failed: {} has corrupted chunks.",
+                            filename);
+        return false;
+    }
+    for (const auto &chunk : cropped) {
+        pointcloud += chunk;
+    }
+    return true;
+}
+
+bool WriteQuantizedPointCloudToO3DPC(const std::string &filename,
+                                     const geometry::PointCloud &pointcloud,
+                                     double position_precision,
+                                     bool print_progress /* = false*/) {
+    // rounding to the grid moves a point by at most half a grid step
+    const double position_step = std::max(position_precision, 0.0) * 2.0;
+    const size_t num_points = pointcloud.points_.size();
+    const size_t num_chunks = (num_points + kChunkSize - 1) / kChunkSize;
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write O3DPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    FileHeader header;
+    memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+    header.version = kFileVersion;
+    header.flags = (pointcloud.HasNormals() ? kFlagHasNormals : 0) |
+                   (pointcloud.HasColors() ? kFlagHasColors : 0);
+    header.num_points = num_points;
+    header.num_chunks = num_chunks;
+    header.position_step = position_step;
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    // a few chunks per thread are encoded before they are written, which
+    // bounds the memory used for the records
+    std::vector<ChunkIndexEntry> index(num_chunks);
+    uint64_t offset = sizeof(header);
+    const int num_chunks_per_batch = 4 * utility::GetMaxThreads();
+    std::vector<std::vector<uint8_t>> records(num_chunks_per_batch);
+    utility::ConsoleProgressBar progress_bar(num_chunks, "Writing O3DPC: ",
+                                             print_progress);
+    for (size_t batch_begin = 0; batch_begin < num_chunks && success;
+         batch_begin += num_chunks_per_batch) {
+        const int batch_size = int(std::min(
+                num_chunks - batch_begin, size_t(num_chunks_per_batch)));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < batch_size; i++) {
+            const size_t first = (batch_begin + i) * kChunkSize;
+            EncodeChunk(pointcloud, first,
+                        std::min(size_t(kChunkSize), num_points - first),
+                        position_step, records[i], index[batch_begin + i]);
+        }
+        for (int i = 0; i < batch_size && success; i++) {
+            index[batch_begin + i].offset = offset;
+            offset += records[i].size();
+            success = fwrite(records[i].data(), 1, records[i].size(), file) ==
+                      records[i].size();
+        }
+        progress_bar += batch_size;
+    }
+
+    FileTrailer trailer;
+    trailer.index_offset = offset;
+    memcpy(trailer.magic, kIndexMagic, sizeof(kIndexMagic));
+    success = success &&
+              fwrite(index.data(), sizeof(ChunkIndexEntry), num_chunks,
+                     file) == num_chunks &&
+              fwrite(&trailer, sizeof(trailer), 1, file) == 1;
+    if (!success) {
+        utility::LogWarning("Write O3DPC failed: unable to write file: {}",
+                            filename);
+    }
+    fclose(file);
+    return success;
+}
+
+bool WritePointCloudToO3DPC(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            bool write_ascii /* = false*/,
+                            bool compressed /* = false*/,
+                            bool print_progress /* = false*/) {
+    double position_precision = 0.0;
+    if (compressed && !pointcloud.IsEmpty()) {
+        const Eigen::Vector3d extent =
+                pointcloud.GetMaxBound() - pointcloud.GetMinBound();
+        position_precision = extent.maxCoeff() * kDefaultPositionPrecision;
+        if (!std::isfinite(position_precision)) {
+            position_precision = 0.0;
+        }
+    }
+    return WriteQuantizedPointCloudToO3DPC(filename, pointcloud,
+                                           position_precision, print_progress);
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -24,139 +24,532 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <future>
+#include <map>
 #include <numeric>
+#include <unordered_map>
 #include <vector>
 
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
-
-#define TINYOBJLOADER_IMPLEMENTATION
-#include "tinyobjloader/tiny_obj_loader.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
-namespace io {
 
-bool ReadTriangleMeshFromOBJ(const std::string& filename,
-                             geometry::TriangleMesh& mesh,
-                             bool print_progress) {
-    tinyobj::attrib_t attrib;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string warn;
-    std::string err;
+namespace {
+
+// Text is split into chunks of about this many bytes for parsing.
+const size_t kOBJReadChunkSize = 1 << 20;
+
+struct OBJMaterial {
+    std::string name;
+    std::string diffuse_texname;
+};
+
+// Number of elements declared in a chunk of an OBJ file.
+struct OBJChunkCounts {
+    size_t num_vertices = 0;
+    size_t num_texcoords = 0;
+    size_t num_normals = 0;
+    size_t num_triangles = 0;
+};
+
+// Per chunk state of the parser that is only known after all chunks are
+// parsed.
+struct OBJChunkState {
+    bool has_colors = true;
+    bool has_all_texcoords = true;
+    // names of the materials selected in the chunk, the material ids of the
+    // triangles index into this list until they are resolved
+    std::vector<std::string> material_names;
+    std::vector<std::string> mtllibs;
+    bool is_valid = true;
+};
+
+inline bool IsOBJSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
 
-    std::string mtl_base_path =
-            utility::filesystem::GetFileParentDirectory(filename);
-    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err,
-                                filename.c_str(), mtl_base_path.c_str());
-    if (!warn.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", warn);
+const char *SkipOBJSpaces(const char *p, const char *end) {
+    while (p != end && IsOBJSpace(*p)) {
+        p++;
     }
-    if (!err.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", err);
+    return p;
+}
+
+/// Returns the keyword of a line and moves \p p after it.
+std::string ParseOBJKeyword(const char *&p, const char *end) {
+    p = SkipOBJSpaces(p, end);
+    const char *keyword_begin = p;
+    while (p != end && !IsOBJSpace(*p)) {
+        p++;
     }
+    return std::string(keyword_begin, p);
+}
 
-    if (!ret) {
-        return false;
+/// Returns the rest of a line without the surrounding white spaces.
+std::string ParseOBJName(const char *p, const char *end) {
+    p = SkipOBJSpaces(p, end);
+    while (end != p && IsOBJSpace(*(end - 1))) {
+        end--;
     }
+    return std::string(p, end);
+}
 
-    mesh.Clear();
+/// Parses an optionally signed integer, \p value is 0 if there is none.
+const char *ParseOBJIndex(const char *p, const char *end, int64_t &value) {
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    value = 0;
+    while (p != end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p - '0');
+        p++;
+    }
+    if (negative) {
+        value = -value;
+    }
+    return p;
+}
 
-    // copy vertex and data
-    for (size_t vidx = 0; vidx < attrib.vertices.size(); vidx += 3) {
-        tinyobj::real_t vx = attrib.vertices[vidx + 0];
-        tinyobj::real_t vy = attrib.vertices[vidx + 1];
-        tinyobj::real_t vz = attrib.vertices[vidx + 2];
-        mesh.vertices_.push_back(Eigen::Vector3d(vx, vy, vz));
+/// Converts a one based or negative relative OBJ index to a zero based
+/// index, or -1 if the index is invalid.
+int ResolveOBJIndex(int64_t index, size_t num_declared, size_t num_total) {
+    int64_t resolved = index > 0 ? index - 1 : int64_t(num_declared) + index;
+    if (index == 0 || resolved < 0 || resolved >= int64_t(num_total)) {
+        return -1;
     }
+    return int(resolved);
+}
 
-    for (size_t vidx = 0; vidx < attrib.colors.size(); vidx += 3) {
-        tinyobj::real_t r = attrib.colors[vidx + 0];
-        tinyobj::real_t g = attrib.colors[vidx + 1];
-        tinyobj::real_t b = attrib.colors[vidx + 2];
-        mesh.vertex_colors_.push_back(Eigen::Vector3d(r, g, b));
+/// Calls \p process_line for every line of [begin, end).
+template <typename Function>
+void ForEachOBJLine(const char *begin,
+                    const char *end,
+                    const Function &process_line) {
+    while (begin != end) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(begin, '\n', size_t(end - begin)));
+        if (line_end == nullptr) {
+            line_end = end;
+        }
+        process_line(begin, line_end);
+        begin = line_end == end ? end : line_end + 1;
     }
+}
 
-    // resize normal data and create bool indicator vector
-    mesh.vertex_normals_.resize(mesh.vertices_.size());
-    std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
+enum class OBJLineType { Vertex, TexCoord, Normal, Face, Other };
+
+/// Classifies a line by its keyword and moves \p p after the keyword. The
+/// counting and the parsing pass share it so that they agree on the number
+/// of elements.
+OBJLineType ClassifyOBJLine(const char *&p,
+                            const char *end,
+                            std::string &keyword) {
+    keyword = ParseOBJKeyword(p, end);
+    if (p == end) {
+        return OBJLineType::Other;
+    }
+    if (keyword == "v") {
+        return OBJLineType::Vertex;
+    } else if (keyword == "vt") {
+        return OBJLineType::TexCoord;
+    } else if (keyword == "vn") {
+        return OBJLineType::Normal;
+    } else if (keyword == "f") {
+        return OBJLineType::Face;
+    }
+    return OBJLineType::Other;
+}
 
-    // copy face data and copy normals data
-    // append face-wise uv data
-    for (size_t s = 0; s < shapes.size(); s++) {
-        size_t index_offset = 0;
-        for (size_t f = 0; f < shapes[s].mesh.num_face_vertices.size(); f++) {
-            int fv = shapes[s].mesh.num_face_vertices[f];
-            if (fv != 3) {
-                utility::LogWarning(
-                        "Read OBJ failed: facet with number of vertices not "
-                        "equal to 3");
-                return false;
+OBJChunkCounts CountOBJChunk(const char *begin, const char *end) {
+    OBJChunkCounts counts;
+    std::string keyword;
+    ForEachOBJLine(begin, end, [&](const char *p, const char *line_end) {
+        switch (ClassifyOBJLine(p, line_end, keyword)) {
+            case OBJLineType::Vertex:
+                counts.num_vertices++;
+                break;
+            case OBJLineType::TexCoord:
+                counts.num_texcoords++;
+                break;
+            case OBJLineType::Normal:
+                counts.num_normals++;
+                break;
+            case OBJLineType::Face: {
+                size_t num_corners = 0;
+                while (true) {
+                    p = SkipOBJSpaces(p, line_end);
+                    if (p == line_end) {
+                        break;
+                    }
+                    num_corners++;
+                    while (p != line_end && !IsOBJSpace(*p)) {
+                        p++;
+                    }
+                }
+                counts.num_triangles +=
+                        num_corners >= 3 ? num_corners - 2 : 0;
+                break;
             }
+            default:
+                break;
+        }
+    });
+    return counts;
+}
 
-            Eigen::Vector3i facet;
-            for (int v = 0; v < fv; v++) {
-                tinyobj::index_t idx = shapes[s].mesh.indices[index_offset + v];
-                int vidx = idx.vertex_index;
-                facet(v) = vidx;
-
-                if (!attrib.normals.empty() && !normals_indicator[vidx] &&
-                    (3 * idx.normal_index + 2) < int(attrib.normals.size())) {
-                    tinyobj::real_t nx =
-                            attrib.normals[3 * idx.normal_index + 0];
-                    tinyobj::real_t ny =
-                            attrib.normals[3 * idx.normal_index + 1];
-                    tinyobj::real_t nz =
-                            attrib.normals[3 * idx.normal_index + 2];
-                    mesh.vertex_normals_[vidx](0) = nx;
-                    mesh.vertex_normals_[vidx](1) = ny;
-                    mesh.vertex_normals_[vidx](2) = nz;
-                    normals_indicator[vidx] = true;
-                }
+bool ReadMTLFile(const std::string &filename,
+                 std::vector<OBJMaterial> &materials) {
+    std::ifstream file(filename.c_str());
+    if (!file) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        const char *p = line.data();
+        const char *end = p + line.size();
+        std::string keyword = ParseOBJKeyword(p, end);
+        if (keyword == "newmtl") {
+            OBJMaterial material;
+            material.name = ParseOBJName(p, end);
+            materials.push_back(material);
+        } else if (keyword == "map_Kd" && !materials.empty()) {
+            // the file name follows the texture options
+            std::string value = ParseOBJName(p, end);
+            size_t name_begin = value.find_last_of(" \t");
+            materials.back().diffuse_texname =
+                    name_begin == std::string::npos
+                            ? value
+                            : value.substr(name_begin + 1);
+        }
+    }
+    return true;
+}
+
+/// Loads the materials of an mtllib statement, the first file that exists
+/// is used.
+void ReadMTLLibrary(const std::string &mtllib,
+                    const std::string &base_path,
+                    std::vector<OBJMaterial> &materials) {
+    std::vector<std::string> filenames;
+    utility::SplitString(filenames, mtllib, " \t");
+    for (const auto &filename : filenames) {
+        if (ReadMTLFile(base_path + filename, materials)) {
+            return;
+        }
+    }
+    utility::LogWarning("Read OBJ: unable to open material file {}.", mtllib);
+}
+
+/// Decodes the diffuse textures of \p materials in parallel.
+std::vector<geometry::Image> ReadOBJTextures(
+        const std::vector<OBJMaterial> &materials,
+        const std::string &base_path) {
+    std::vector<std::string> texnames;
+    for (const auto &material : materials) {
+        if (!material.diffuse_texname.empty()) {
+            texnames.push_back(material.diffuse_texname);
+        }
+    }
+    std::vector<geometry::Image> textures(texnames.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)texnames.size(); i++) {
+        textures[i] =
+                *(io::CreateImageFromFile(base_path + texnames[i])
+                          ->FlipVertical());
+    }
+    return textures;
+}
+
+}  // unnamed namespace
 
-                if (!attrib.texcoords.empty() &&
-                    2 * idx.texcoord_index + 1 < int(attrib.texcoords.size())) {
-                    tinyobj::real_t tx =
-                            attrib.texcoords[2 * idx.texcoord_index + 0];
-                    tinyobj::real_t ty =
-                            attrib.texcoords[2 * idx.texcoord_index + 1];
-                    mesh.triangle_uvs_.push_back(Eigen::Vector2d(tx, ty));
+namespace io {
+
+bool ReadTriangleMeshFromOBJ(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             bool print_progress) {
+    utility::filesystem::MappedFile file;
+    if (!file.Map(filename)) {
+        utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const char *data = file.GetData();
+    const size_t size = size_t(file.GetSize());
+    std::string mtl_base_path =
+            utility::filesystem::GetFileParentDirectory(filename);
+
+    // chunks end after a line break so that no line is split
+    std::vector<size_t> chunk_begins(1, 0);
+    while (chunk_begins.back() < size) {
+        size_t chunk_end = chunk_begins.back() + kOBJReadChunkSize;
+        if (chunk_end >= size) {
+            chunk_end = size;
+        } else {
+            const void *line_break = std::memchr(data + chunk_end - 1, '\n',
+                                                 size - chunk_end + 1);
+            chunk_end = line_break == nullptr
+                                ? size
+                                : size_t(static_cast<const char *>(
+                                                 line_break) -
+                                         data) + 1;
+        }
+        chunk_begins.push_back(chunk_end);
+    }
+    const int num_chunks = int(chunk_begins.size()) - 1;
+
+    // the textures of the material libraries declared in the first chunk,
+    // usually in the header, are decoded while the geometry is parsed
+    std::vector<OBJMaterial> materials;
+    if (num_chunks > 0) {
+        ForEachOBJLine(data, data + chunk_begins[1],
+                       [&](const char *p, const char *line_end) {
+                           if (ParseOBJKeyword(p, line_end) == "mtllib") {
+                               ReadMTLLibrary(ParseOBJName(p, line_end),
+                                              mtl_base_path, materials);
+                           }
+                       });
+    }
+    std::future<std::vector<geometry::Image>> textures =
+            std::async(std::launch::async, ReadOBJTextures, materials,
+                       mtl_base_path);
+
+    // the counts of the chunks locate their elements in the mesh
+    std::vector<OBJChunkCounts> chunk_offsets(num_chunks + 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        chunk_offsets[c + 1] = CountOBJChunk(data + chunk_begins[c],
+                                             data + chunk_begins[c + 1]);
+    }
+    for (int c = 0; c < num_chunks; c++) {
+        chunk_offsets[c + 1].num_vertices += chunk_offsets[c].num_vertices;
+        chunk_offsets[c + 1].num_texcoords += chunk_offsets[c].num_texcoords;
+        chunk_offsets[c + 1].num_normals += chunk_offsets[c].num_normals;
+        chunk_offsets[c + 1].num_triangles += chunk_offsets[c].num_triangles;
+    }
+    const OBJChunkCounts &total = chunk_offsets.back();
+
+    mesh.Clear();
+    mesh.vertices_.resize(total.num_vertices);
+    mesh.vertex_colors_.resize(total.num_vertices);
+    mesh.triangles_.resize(total.num_triangles);
+    mesh.triangle_material_ids_.resize(total.num_triangles);
+    std::vector<Eigen::Vector2d> texcoords(total.num_texcoords);
+    std::vector<Eigen::Vector3d> normals(total.num_normals);
+    std::vector<Eigen::Vector3i> triangle_texcoords(total.num_triangles);
+    std::vector<Eigen::Vector3i> triangle_normals(total.num_triangles);
+    std::vector<OBJChunkState> chunk_states(num_chunks);
+
+    utility::ConsoleProgressBar progress_bar(size, "Reading OBJ file: ",
+                                             print_progress);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        OBJChunkCounts counts = chunk_offsets[c];
+        OBJChunkState &state = chunk_states[c];
+        // -1 selects the material of the previous chunks
+        int material_id = -1;
+        std::string keyword;
+        auto parse_line = [&](const char *p, const char *line_end) {
+            OBJLineType type = ClassifyOBJLine(p, line_end, keyword);
+            if (type == OBJLineType::Vertex) {
+                double values[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+                size_t num_values =
+                        utility::ParseNumbers(p, line_end, values, 6);
+                state.is_valid = state.is_valid && num_values >= 3;
+                mesh.vertices_[counts.num_vertices] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                if (num_values == 6) {
+                    mesh.vertex_colors_[counts.num_vertices] =
+                            Eigen::Vector3d(values[3], values[4], values[5]);
+                } else {
+                    state.has_colors = false;
+                }
+                counts.num_vertices++;
+            } else if (type == OBJLineType::TexCoord) {
+                double values[2] = {0.0, 0.0};
+                utility::ParseNumbers(p, line_end, values, 2);
+                texcoords[counts.num_texcoords++] =
+                        Eigen::Vector2d(values[0], values[1]);
+            } else if (type == OBJLineType::Normal) {
+                double values[3] = {0.0, 0.0, 0.0};
+                utility::ParseNumbers(p, line_end, values, 3);
+                normals[counts.num_normals++] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+            } else if (type == OBJLineType::Face) {
+                // polygons are triangulated as a fan around the first corner
+                int num_corners = 0;
+                Eigen::Vector3i corners[3];
+                while (true) {
+                    p = SkipOBJSpaces(p, line_end);
+                    if (p == line_end) {
+                        break;
+                    }
+                    int64_t indices[3] = {0, 0, 0};
+                    for (int k = 0; k < 3; k++) {
+                        p = ParseOBJIndex(p, line_end, indices[k]);
+                        if (p == line_end || *p != '/') {
+                            break;
+                        }
+                        p++;
+                    }
+                    while (p != line_end && !IsOBJSpace(*p)) {
+                        p++;
+                    }
+                    Eigen::Vector3i corner(
+                            ResolveOBJIndex(indices[0], counts.num_vertices,
+                                            total.num_vertices),
+                            ResolveOBJIndex(indices[1], counts.num_texcoords,
+                                            total.num_texcoords),
+                            ResolveOBJIndex(indices[2], counts.num_normals,
+                                            total.num_normals));
+                    state.is_valid = state.is_valid && corner(0) >= 0;
+                    state.has_all_texcoords =
+                            state.has_all_texcoords && corner(1) >= 0;
+                    if (num_corners < 3) {
+                        corners[num_corners] = corner;
+                    } else {
+                        corners[1] = corners[2];
+                        corners[2] = corner;
+                    }
+                    num_corners++;
+                    if (num_corners >= 3) {
+                        const size_t t = counts.num_triangles++;
+                        for (int k = 0; k < 3; k++) {
+                            mesh.triangles_[t](k) = corners[k](0);
+                            triangle_texcoords[t](k) = corners[k](1);
+                            triangle_normals[t](k) = corners[k](2);
+                        }
+                        mesh.triangle_material_ids_[t] = material_id;
+                    }
                 }
+            } else if (keyword == "usemtl") {
+                material_id = int(state.material_names.size());
+                state.material_names.push_back(ParseOBJName(p, line_end));
+            } else if (keyword == "mtllib" && c > 0) {
+                state.mtllibs.push_back(ParseOBJName(p, line_end));
             }
-            mesh.triangles_.push_back(facet);
-            mesh.triangle_material_ids_.push_back(
-                    shapes[s].mesh.material_ids[f]);
-            index_offset += fv;
-        }
+        };
+        ForEachOBJLine(data + chunk_begins[c], data + chunk_begins[c + 1],
+                       parse_line);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        { progress_bar += chunk_begins[c + 1] - chunk_begins[c]; }
     }
 
-    // if not all normals have been set, then remove the vertex normals
-    bool all_normals_set =
-            std::accumulate(normals_indicator.begin(), normals_indicator.end(),
-                            true, [](bool a, bool b) { return a && b; });
-    if (!all_normals_set) {
-        mesh.vertex_normals_.clear();
+    std::vector<geometry::Image> late_textures;
+    std::vector<OBJMaterial> late_materials;
+    for (int c = 0; c < num_chunks; c++) {
+        for (const auto &mtllib : chunk_states[c].mtllibs) {
+            ReadMTLLibrary(mtllib, mtl_base_path, late_materials);
+        }
+    }
+    if (!late_materials.empty()) {
+        late_textures = ReadOBJTextures(late_materials, mtl_base_path);
+        materials.insert(materials.end(), late_materials.begin(),
+                         late_materials.end());
+    }
+    mesh.textures_ = textures.get();
+    mesh.textures_.insert(mesh.textures_.end(), late_textures.begin(),
+                          late_textures.end());
+
+    bool is_valid = true;
+    bool has_colors = true;
+    bool has_all_texcoords = true;
+    for (const auto &state : chunk_states) {
+        is_valid = is_valid && state.is_valid;
+        has_colors = has_colors && state.has_colors;
+        has_all_texcoords = has_all_texcoords && state.has_all_texcoords;
+    }
+    if (!is_valid) {
+        utility::LogWarning(
+                "Read OBJ failed: invalid vertex or vertex index in {}.",
+                filename);
+        mesh.Clear();
+        return false;
+    }
+    if (!has_colors) {
+        mesh.vertex_colors_.clear();
     }
 
-    // if not all triangles have corresponding uvs, then remove uvs
-    if (3 * mesh.triangles_.size() != mesh.triangle_uvs_.size()) {
-        mesh.triangle_uvs_.clear();
+    // the material names are resolved, a chunk starts with the last material
+    // selected by the previous chunks
+    std::unordered_map<std::string, int> material_ids;
+    for (size_t i = 0; i < materials.size(); i++) {
+        material_ids.emplace(materials[i].name, int(i));
+    }
+    std::vector<std::vector<int>> chunk_material_ids(num_chunks);
+    std::vector<int> chunk_first_material_ids(num_chunks + 1, -1);
+    for (int c = 0; c < num_chunks; c++) {
+        for (const auto &name : chunk_states[c].material_names) {
+            auto it = material_ids.find(name);
+            chunk_material_ids[c].push_back(
+                    it == material_ids.end() ? -1 : it->second);
+        }
+        chunk_first_material_ids[c + 1] =
+                chunk_material_ids[c].empty() ? chunk_first_material_ids[c]
+                                              : chunk_material_ids[c].back();
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_chunks; c++) {
+        for (size_t t = chunk_offsets[c].num_triangles;
+             t < chunk_offsets[c + 1].num_triangles; t++) {
+            int &material_id = mesh.triangle_material_ids_[t];
+            material_id = material_id < 0 ? chunk_first_material_ids[c]
+                                          : chunk_material_ids[c][material_id];
+        }
     }
 
-    // Now we assert only one shape is stored, we only select the first
-    // diffuse material
-    for (auto& material : materials) {
-        if (!material.diffuse_texname.empty()) {
-            mesh.textures_.push_back(
-                    *(io::CreateImageFromFile(mtl_base_path +
-                                              material.diffuse_texname)
-                              ->FlipVertical()));
+    // a vertex takes the normal of its first corner with a normal, normals
+    // are only kept if every vertex has one
+    if (!normals.empty()) {
+        mesh.vertex_normals_.resize(mesh.vertices_.size());
+        std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
+        for (size_t t = 0; t < mesh.triangles_.size(); t++) {
+            for (int k = 0; k < 3; k++) {
+                const int vidx = mesh.triangles_[t](k);
+                const int nidx = triangle_normals[t](k);
+                if (nidx >= 0 && !normals_indicator[vidx]) {
+                    mesh.vertex_normals_[vidx] = normals[nidx];
+                    normals_indicator[vidx] = true;
+                }
+            }
+        }
+        if (std::find(normals_indicator.begin(), normals_indicator.end(),
+                      false) != normals_indicator.end()) {
+            mesh.vertex_normals_.clear();
         }
     }
 
+    // uvs are only kept if every corner has one
+    if (!texcoords.empty() && has_all_texcoords) {
+        mesh.triangle_uvs_.resize(3 * mesh.triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int t = 0; t < (int)mesh.triangles_.size(); t++) {
+            for (int k = 0; k < 3; k++) {
+                mesh.triangle_uvs_[3 * t + k] =
+                        texcoords[triangle_texcoords[t](k)];
+            }
+        }
+    }
     return true;
 }
 
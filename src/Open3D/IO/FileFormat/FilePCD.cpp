@@ -25,14 +25,19 @@
 // ----------------------------------------------------------------------------
 
 #include <liblzf/lzf.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <limits>
 #include <sstream>
 
+#include "Open3D/IO/ClassIO/MappedPointCloudIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/Parallel.h"
 
 // References for PCD file IO
 // http://pointclouds.org/documentation/tutorials/pcd_file_format.php
@@ -332,6 +337,210 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+// LZF back references reach at most this many bytes back.
+const size_t kLZFMaxOffset = 1 << 13;
+// binary_compressed data is compressed and converted in blocks of this size.
+const size_t kPCDCompressionBlockSize = 1 << 20;
+
+bool IsPCDFieldUsed(const PCLPointField &field) {
+    return field.name == "x" || field.name == "y" || field.name == "z" ||
+           field.name == "normal_x" || field.name == "normal_y" ||
+           field.name == "normal_z" || field.name == "rgb" ||
+           field.name == "rgba";
+}
+
+void UnpackBinaryPCDField(const PCLPointField &field,
+                          const char *data_ptr,
+                          int i,
+                          geometry::PointCloud &pointcloud) {
+    if (field.name == "x") {
+        pointcloud.points_[i](0) =
+                UnpackBinaryPCDElement(data_ptr, field.type, field.size);
+    } else if (field.name == "y") {
+        pointcloud.points_[i](1) =
+                UnpackBinaryPCDElement(data_ptr, field.type, field.size);
+    } else if (field.name == "z") {
+        pointcloud.points_[i](2) =
+                UnpackBinaryPCDElement(data_ptr, field.type, field.size);
+    } else if (field.name == "normal_x") {
+        pointcloud.normals_[i](0) =
+                UnpackBinaryPCDElement(data_ptr, field.type, field.size);
+    } else if (field.name == "normal_y") {
+        pointcloud.normals_[i](1) =
+                UnpackBinaryPCDElement(data_ptr, field.type, field.size);
+    } else if (field.name == "normal_z") {
+        pointcloud.normals_[i](2) =
+                UnpackBinaryPCDElement(data_ptr, field.type, field.size);
+    } else if (field.name == "rgb" || field.name == "rgba") {
+        pointcloud.colors_[i] =
+                UnpackBinaryPCDColor(data_ptr, field.type, field.size);
+    }
+}
+
+/// Reads binary_compressed data, which stores every field for all points
+/// contiguously and compresses the result as a single LZF stream.
+///
+/// The stream is decompressed while it is read, into a window that keeps the
+/// last kLZFMaxOffset bytes for back references. Whenever the window is full,
+/// the completely decompressed elements of every field are converted in
+/// parallel. Neither the compressed nor the uncompressed data is held in
+/// memory as a whole.
+bool ReadCompressedPCDData(FILE *file,
+                           const PCDHeader &header,
+                           geometry::PointCloud &pointcloud) {
+    std::uint32_t compressed_size;
+    std::uint32_t uncompressed_size;
+    if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
+        utility::LogWarning("[ReadPCDData] Failed to read data record.");
+        return false;
+    }
+    if (fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) != 1) {
+        utility::LogWarning("[ReadPCDData] Failed to read data record.");
+        return false;
+    }
+    utility::LogDebug(
+            "PCD data with {:d} compressed size, and {:d} uncompressed "
+            "size.",
+            compressed_size, uncompressed_size);
+    if (uint64_t(uncompressed_size) <
+        uint64_t(header.pointsize) * uint64_t(header.points)) {
+        utility::LogWarning("[ReadPCDData] Uncompression failed.");
+        return false;
+    }
+
+    struct FieldStrip {
+        const PCLPointField *field;
+        uint64_t begin;
+        size_t stride;
+        int next_point;
+    };
+    std::vector<FieldStrip> strips;
+    size_t max_stride = 0;
+    for (const auto &field : header.fields) {
+        if (IsPCDFieldUsed(field)) {
+            FieldStrip strip;
+            strip.field = &field;
+            strip.begin = uint64_t(field.offset) * uint64_t(header.points);
+            strip.stride = size_t(field.size) * size_t(field.count);
+            strip.next_point = 0;
+            strips.push_back(strip);
+            max_stride = std::max(max_stride, strip.stride);
+        }
+    }
+    // elements are converted once all their bytes are decompressed, so the
+    // window also keeps the bytes of partially decompressed elements
+    const size_t history_size = kLZFMaxOffset + max_stride;
+    std::vector<char> window(history_size + kPCDCompressionBlockSize);
+    uint64_t window_begin = 0;
+    size_t window_size = 0;
+    auto convert_elements = [&]() {
+        const uint64_t decoded_end = window_begin + window_size;
+        for (auto &strip : strips) {
+            if (decoded_end <= strip.begin) {
+                continue;
+            }
+            const int end_point = int(std::min(
+                    uint64_t(header.points),
+                    (decoded_end - strip.begin) / uint64_t(strip.stride)));
+            // the strip may start before the window, its pending elements
+            // do not
+            const int64_t base = int64_t(strip.begin) - int64_t(window_begin);
+            const int64_t stride = int64_t(strip.stride);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = strip.next_point; i < end_point; i++) {
+                const int64_t position = base + int64_t(i) * stride;
+                UnpackBinaryPCDField(*strip.field, window.data() + position, i,
+                                     pointcloud);
+            }
+            strip.next_point = std::max(strip.next_point, end_point);
+        }
+    };
+    auto flush_window = [&]() {
+        convert_elements();
+        const size_t keep = std::min(window_size, history_size);
+        memmove(window.data(), window.data() + window_size - keep, keep);
+        window_begin += window_size - keep;
+        window_size = keep;
+    };
+
+    // a token is a control byte followed by up to 32 literal bytes
+    const size_t max_token_size = 33;
+    std::vector<std::uint8_t> input(1 << 16);
+    size_t input_begin = 0;
+    size_t input_end = 0;
+    uint64_t remaining_input = compressed_size;
+    uint64_t decoded_size = 0;
+    while (decoded_size < uncompressed_size) {
+        if (input_end - input_begin < max_token_size && remaining_input > 0) {
+            memmove(input.data(), input.data() + input_begin,
+                    input_end - input_begin);
+            input_end -= input_begin;
+            input_begin = 0;
+            const size_t read_size = (size_t)std::min(
+                    remaining_input, uint64_t(input.size() - input_end));
+            if (fread(input.data() + input_end, 1, read_size, file) !=
+                read_size) {
+                utility::LogWarning(
+                        "[ReadPCDData] Failed to read data record.");
+                return false;
+            }
+            input_end += read_size;
+            remaining_input -= read_size;
+        }
+        if (input_begin == input_end) {
+            break;
+        }
+        const unsigned int control = input[input_begin++];
+        size_t length;
+        size_t offset = 0;
+        if (control < (1 << 5)) {
+            length = control + 1;
+            if (input_end - input_begin < length) {
+                break;
+            }
+        } else {
+            length = control >> 5;
+            if (input_end - input_begin < (length == 7 ? 2u : 1u)) {
+                break;
+            }
+            if (length == 7) {
+                length += input[input_begin++];
+            }
+            offset = ((control & 0x1f) << 8) + input[input_begin++] + 1;
+            length += 2;
+            if (offset > decoded_size) {
+                break;
+            }
+        }
+        if (decoded_size + length > uncompressed_size) {
+            break;
+        }
+        if (window_size + length > window.size()) {
+            flush_window();
+        }
+        char *dst = window.data() + window_size;
+        if (offset == 0) {
+            memcpy(dst, input.data() + input_begin, length);
+            input_begin += length;
+        } else {
+            // the source may overlap the copied bytes
+            for (size_t k = 0; k < length; k++) {
+                dst[k] = dst[k - offset];
+            }
+        }
+        window_size += length;
+        decoded_size += length;
+    }
+    if (decoded_size != uncompressed_size) {
+        utility::LogWarning("[ReadPCDData] Uncompression failed.");
+        return false;
+    }
+    convert_elements();
+    return true;
+}
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud) {
@@ -436,85 +645,10 @@ bool ReadPCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        std::uint32_t compressed_size;
-        std::uint32_t uncompressed_size;
-        if (fread(&compressed_size, sizeof(compressed_size), 1, file) != 1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+        if (!ReadCompressedPCDData(file, header, pointcloud)) {
             pointcloud.Clear();
             return false;
         }
-        if (fread(&uncompressed_size, sizeof(uncompressed_size), 1, file) !=
-            1) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        utility::LogDebug(
-                "PCD data with {:d} compressed size, and {:d} uncompressed "
-                "size.",
-                compressed_size, uncompressed_size);
-        std::unique_ptr<char[]> buffer_compressed(new char[compressed_size]);
-        if (fread(buffer_compressed.get(), 1, compressed_size, file) !=
-            compressed_size) {
-            utility::LogWarning("[ReadPCDData] Failed to read data record.");
-            pointcloud.Clear();
-            return false;
-        }
-        std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
-            utility::LogWarning("[ReadPCDData] Uncompression failed.");
-            pointcloud.Clear();
-            return false;
-        }
-        for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            }
-        }
     }
     return true;
 }
@@ -625,6 +759,102 @@ float ConvertRGBToFloat(const Eigen::Vector3d &color) {
     return value;
 }
 
+/// Writes binary_compressed data in blocks that are filled and LZF compressed
+/// in parallel. LZF back references never reach before the start of the
+/// output, so the concatenated blocks form a single valid LZF stream, which
+/// is how PCL reads the data.
+bool WriteCompressedPCDData(FILE *file,
+                            const PCDHeader &header,
+                            const geometry::PointCloud &pointcloud) {
+    const bool has_normal = pointcloud.HasNormals();
+    const bool has_color = pointcloud.HasColors();
+    const uint64_t num_elements =
+            uint64_t(header.elementnum) * uint64_t(header.points);
+    const uint64_t uncompressed_size = num_elements * sizeof(float);
+    if (uncompressed_size > std::numeric_limits<std::uint32_t>::max()) {
+        utility::LogWarning(
+                "[WritePCDData] Data exceeds the size limit of compressed "
+                "PCD files.");
+        return false;
+    }
+    // element e of the data is field e / points of point e % points
+    auto get_element = [&](uint64_t e) -> float {
+        const size_t i = size_t(e % uint64_t(header.points));
+        int field = int(e / uint64_t(header.points));
+        if (field < 3) {
+            return (float)pointcloud.points_[i](field);
+        }
+        field -= 3;
+        if (has_normal) {
+            if (field < 3) {
+                return (float)pointcloud.normals_[i](field);
+            }
+            field -= 3;
+        }
+        return has_color ? ConvertRGBToFloat(pointcloud.colors_[i]) : 0.0f;
+    };
+
+    const long size_position = ftell(file);
+    std::uint32_t size_compressed = 0;
+    std::uint32_t buffer_size_in_bytes = std::uint32_t(uncompressed_size);
+    fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+    fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
+
+    const uint64_t block_elements = kPCDCompressionBlockSize / sizeof(float);
+    const int num_blocks =
+            int((num_elements + block_elements - 1) / block_elements);
+    const int num_blocks_per_batch = 4 * utility::GetMaxThreads();
+    // every 32 literal bytes need a control byte in the worst case
+    const size_t max_compressed_block_size =
+            kPCDCompressionBlockSize + kPCDCompressionBlockSize / 32 + 64;
+    std::vector<std::vector<char>> compressed_blocks(num_blocks_per_batch);
+    uint64_t total_compressed_size = 0;
+    bool success = true;
+    for (int batch_begin = 0; batch_begin < num_blocks && success;
+         batch_begin += num_blocks_per_batch) {
+        const int batch_end =
+                std::min(batch_begin + num_blocks_per_batch, num_blocks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int b = batch_begin; b < batch_end; b++) {
+            const uint64_t first = uint64_t(b) * block_elements;
+            const size_t count =
+                    size_t(std::min(block_elements, num_elements - first));
+            std::vector<float> block(count);
+            for (size_t k = 0; k < count; k++) {
+                block[k] = get_element(first + k);
+            }
+            std::vector<char> &compressed = compressed_blocks[b - batch_begin];
+            compressed.resize(max_compressed_block_size);
+            compressed.resize(lzf_compress(
+                    block.data(), (unsigned int)(count * sizeof(float)),
+                    compressed.data(), (unsigned int)compressed.size()));
+        }
+        for (int b = batch_begin; b < batch_end && success; b++) {
+            const std::vector<char> &compressed =
+                    compressed_blocks[b - batch_begin];
+            success = !compressed.empty() &&
+                      fwrite(compressed.data(), 1, compressed.size(), file) ==
+                              compressed.size();
+            total_compressed_size += compressed.size();
+        }
+    }
+    if (!success ||
+        total_compressed_size > std::numeric_limits<std::uint32_t>::max()) {
+        utility::LogWarning("[WritePCDData] Failed to compress data.");
+        return false;
+    }
+    size_compressed = std::uint32_t(total_compressed_size);
+    utility::LogDebug(
+            "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
+            buffer_size_in_bytes, size_compressed);
+    fseek(file, size_position, SEEK_SET);
+    fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+    fseek(file, 0, SEEK_END);
+    return true;
+}
+
 bool WritePCDData(FILE *file,
                   const PCDHeader &header,
                   const geometry::PointCloud &pointcloud) {
@@ -667,43 +897,32 @@ bool WritePCDData(FILE *file,
             fwrite(data.get(), sizeof(float), header.elementnum, file);
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
-            }
-        }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
-            return false;
-        }
-        utility::LogDebug(
-                "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+        return WriteCompressedPCDData(file, header, pointcloud);
+    }
+    return true;
+}
+
+bool GetMappedScalarType(const PCLPointField &field,
+                         MappedPointCloudLayout::ScalarType &type) {
+    typedef MappedPointCloudLayout::ScalarType ScalarType;
+    if (field.type == 'I' && field.size == 1) {
+        type = ScalarType::Int8;
+    } else if (field.type == 'I' && field.size == 2) {
+        type = ScalarType::Int16;
+    } else if (field.type == 'I' && field.size == 4) {
+        type = ScalarType::Int32;
+    } else if (field.type == 'U' && field.size == 1) {
+        type = ScalarType::UInt8;
+    } else if (field.type == 'U' && field.size == 2) {
+        type = ScalarType::UInt16;
+    } else if (field.type == 'U' && field.size == 4) {
+        type = ScalarType::UInt32;
+    } else if (field.type == 'F' && field.size == 4) {
+        type = ScalarType::Float32;
+    } else if (field.type == 'F' && field.size == 8) {
+        type = ScalarType::Float64;
+    } else {
+        return false;
     }
     return true;
 }
@@ -748,6 +967,61 @@ bool ReadPointCloudFromPCD(const std::string &filename,
     return true;
 }
 
+bool ReadMappedPointCloudLayoutFromPCD(const std::string &filename,
+                                       MappedPointCloudLayout &layout) {
+    PCDHeader header;
+    FILE *file = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (file == NULL) {
+        return false;
+    }
+    if (ReadPCDHeader(file, header) == false ||
+        header.datatype != PCD_DATA_BINARY) {
+        fclose(file);
+        return false;
+    }
+    const uint64_t data_offset = uint64_t(ftell(file));
+    fclose(file);
+
+    layout.num_points = size_t(header.points);
+    layout.has_normals = header.has_normals;
+    layout.has_colors = header.has_colors;
+    static const char *const point_names[3] = {"x", "y", "z"};
+    static const char *const normal_names[3] = {"normal_x", "normal_y",
+                                                "normal_z"};
+    for (const auto &field : header.fields) {
+        MappedPointCloudLayout::Field mapped;
+        mapped.offset = data_offset + field.offset;
+        mapped.stride = uint64_t(header.pointsize);
+        if (field.name == "rgb" || field.name == "rgba") {
+            if (field.size != 4) {
+                return false;
+            }
+            // color data is packed in BGR order.
+            mapped.type = MappedPointCloudLayout::ScalarType::UInt8;
+            for (int i = 0; i < 3; i++) {
+                layout.colors[i] = mapped;
+                layout.colors[i].offset += 2 - i;
+            }
+            continue;
+        }
+        for (int i = 0; i < 3; i++) {
+            MappedPointCloudLayout::Field *target = nullptr;
+            if (field.name == point_names[i]) {
+                target = &layout.points[i];
+            } else if (field.name == normal_names[i]) {
+                target = &layout.normals[i];
+            }
+            if (target != nullptr) {
+                if (!GetMappedScalarType(field, mapped.type)) {
+                    return false;
+                }
+                *target = mapped;
+            }
+        }
+    }
+    return true;
+}
+
 bool WritePointCloudToPCD(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           bool write_ascii /* = false*/,
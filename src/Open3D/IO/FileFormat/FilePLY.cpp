@@ -25,12 +25,21 @@
 // ----------------------------------------------------------------------------
 
 #include <rply/rply.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
 
 #include "Open3D/IO/ClassIO/LineSetIO.h"
+#include "Open3D/IO/ClassIO/MappedPointCloudIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 
@@ -351,6 +360,639 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
+namespace ply_bulk_io {
+
+// Binary little endian files are read and written in blocks of this many
+// elements, the properties of a block are converted in parallel.
+const size_t kBlockSize = 1 << 20;
+
+typedef MappedPointCloudLayout::ScalarType ScalarType;
+
+struct Property {
+    std::string name;
+    bool is_list;
+    ScalarType type;         // type of the values of lists
+    ScalarType length_type;  // only used by lists
+    size_t offset;           // only used by scalar properties
+};
+
+struct Element {
+    std::string name;
+    size_t count;
+    std::vector<Property> properties;
+    size_t stride;  // size of the scalar properties of one element
+    bool has_list;
+
+    const Property *FindProperty(const std::string &property_name) const {
+        for (const auto &property : properties) {
+            if (property.name == property_name) {
+                return &property;
+            }
+        }
+        return nullptr;
+    }
+};
+
+struct Header {
+    bool is_binary_little_endian;
+    std::vector<Element> elements;
+};
+
+/// The vertex properties read by Open3D, normals and colors are nullptr if
+/// the file has none.
+struct VertexLayout {
+    const Property *point[3];
+    const Property *normal[3];
+    const Property *color[3];
+};
+
+enum class ReadResult {
+    Success,
+    Failure,
+    Unsupported,  // the file has to be read by rply
+};
+
+bool IsLittleEndianHost() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+bool ParseScalarType(const std::string &name, ScalarType &type) {
+    static const std::unordered_map<std::string, ScalarType> types = {
+            {"char", ScalarType::Int8},      {"int8", ScalarType::Int8},
+            {"uchar", ScalarType::UInt8},    {"uint8", ScalarType::UInt8},
+            {"short", ScalarType::Int16},    {"int16", ScalarType::Int16},
+            {"ushort", ScalarType::UInt16},  {"uint16", ScalarType::UInt16},
+            {"int", ScalarType::Int32},      {"int32", ScalarType::Int32},
+            {"uint", ScalarType::UInt32},    {"uint32", ScalarType::UInt32},
+            {"float", ScalarType::Float32},  {"float32", ScalarType::Float32},
+            {"double", ScalarType::Float64}, {"float64", ScalarType::Float64},
+    };
+    auto itr = types.find(name);
+    if (itr == types.end()) {
+        return false;
+    }
+    type = itr->second;
+    return true;
+}
+
+size_t GetScalarSize(ScalarType type) {
+    switch (type) {
+        case ScalarType::Int8:
+        case ScalarType::UInt8:
+            return 1;
+        case ScalarType::Int16:
+        case ScalarType::UInt16:
+            return 2;
+        case ScalarType::Int32:
+        case ScalarType::UInt32:
+        case ScalarType::Float32:
+            return 4;
+        default:
+            return 8;
+    }
+}
+
+/// Parses the header and leaves \p file at the first byte of the data.
+bool ReadHeader(FILE *file, Header &header) {
+    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    std::vector<std::string> tokens;
+    if (!fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file) ||
+        strncmp(line_buffer, "ply", 3) != 0) {
+        return false;
+    }
+    header.is_binary_little_endian = false;
+    header.elements.clear();
+    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        tokens.clear();
+        utility::SplitString(tokens, line_buffer, " \t\r\n");
+        if (tokens.empty()) {
+            continue;
+        }
+        if (tokens[0] == "end_header") {
+            return true;
+        } else if (tokens[0] == "format" && tokens.size() >= 2) {
+            header.is_binary_little_endian =
+                    tokens[1] == "binary_little_endian";
+        } else if (tokens[0] == "element" && tokens.size() >= 3) {
+            Element element;
+            element.name = tokens[1];
+            element.count = std::strtoull(tokens[2].c_str(), NULL, 10);
+            element.stride = 0;
+            element.has_list = false;
+            header.elements.push_back(element);
+        } else if (tokens[0] == "property" && !header.elements.empty()) {
+            Element &element = header.elements.back();
+            Property property;
+            property.is_list = tokens.size() >= 5 && tokens[1] == "list";
+            if (property.is_list) {
+                if (!ParseScalarType(tokens[2], property.length_type) ||
+                    !ParseScalarType(tokens[3], property.type)) {
+                    return false;
+                }
+                property.name = tokens[4];
+                property.offset = 0;
+                element.has_list = true;
+            } else {
+                if (tokens.size() < 3 ||
+                    !ParseScalarType(tokens[1], property.type)) {
+                    return false;
+                }
+                property.name = tokens[2];
+                property.offset = element.stride;
+                element.stride += GetScalarSize(property.type);
+            }
+            element.properties.push_back(property);
+        }
+    }
+    return false;
+}
+
+/// Finds the properties of a vertex group, all three or none must exist.
+bool FindPropertyGroup(const Element &vertex,
+                       const char *const names[3],
+                       const Property *group[3]) {
+    int num_found = 0;
+    for (int i = 0; i < 3; i++) {
+        group[i] = vertex.FindProperty(names[i]);
+        num_found += group[i] != nullptr ? 1 : 0;
+    }
+    return num_found == 0 || num_found == 3;
+}
+
+bool GetVertexLayout(const Element &vertex, VertexLayout &layout) {
+    static const char *const point_names[3] = {"x", "y", "z"};
+    static const char *const normal_names[3] = {"nx", "ny", "nz"};
+    static const char *const color_names[3] = {"red", "green", "blue"};
+    return !vertex.has_list &&
+           FindPropertyGroup(vertex, point_names, layout.point) &&
+           layout.point[0] != nullptr &&
+           FindPropertyGroup(vertex, normal_names, layout.normal) &&
+           FindPropertyGroup(vertex, color_names, layout.color);
+}
+
+int SkipBytes(FILE *file, uint64_t size) {
+#ifdef _WIN32
+    return _fseeki64(file, (__int64)size, SEEK_CUR);
+#else
+    return fseeko(file, (off_t)size, SEEK_CUR);
+#endif
+}
+
+template <typename T>
+void LoadProperty(const uint8_t *data,
+                  size_t stride,
+                  int64_t num,
+                  double divisor,
+                  Eigen::Vector3d *values,
+                  int dim) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num; i++) {
+        T value;
+        memcpy(&value, data + i * stride, sizeof(T));
+        values[i](dim) = double(value) / divisor;
+    }
+}
+
+void LoadProperty(const Property &property,
+                  const uint8_t *block,
+                  size_t stride,
+                  int64_t num,
+                  double divisor,
+                  Eigen::Vector3d *values,
+                  int dim) {
+    const uint8_t *data = block + property.offset;
+    switch (property.type) {
+        case ScalarType::Int8:
+            LoadProperty<int8_t>(data, stride, num, divisor, values, dim);
+            break;
+        case ScalarType::UInt8:
+            LoadProperty<uint8_t>(data, stride, num, divisor, values, dim);
+            break;
+        case ScalarType::Int16:
+            LoadProperty<int16_t>(data, stride, num, divisor, values, dim);
+            break;
+        case ScalarType::UInt16:
+            LoadProperty<uint16_t>(data, stride, num, divisor, values, dim);
+            break;
+        case ScalarType::Int32:
+            LoadProperty<int32_t>(data, stride, num, divisor, values, dim);
+            break;
+        case ScalarType::UInt32:
+            LoadProperty<uint32_t>(data, stride, num, divisor, values, dim);
+            break;
+        case ScalarType::Float32:
+            LoadProperty<float>(data, stride, num, divisor, values, dim);
+            break;
+        case ScalarType::Float64:
+            LoadProperty<double>(data, stride, num, divisor, values, dim);
+            break;
+    }
+}
+
+bool ReadVertices(FILE *file,
+                  const Element &vertex,
+                  const VertexLayout &layout,
+                  Eigen::Vector3d *points,
+                  Eigen::Vector3d *normals,
+                  Eigen::Vector3d *colors,
+                  utility::ConsoleProgressBar &progress_bar) {
+    std::vector<uint8_t> block;
+    for (size_t first = 0; first < vertex.count; first += kBlockSize) {
+        const size_t num = std::min(kBlockSize, vertex.count - first);
+        block.resize(num * vertex.stride);
+        if (fread(block.data(), vertex.stride, num, file) != num) {
+            return false;
+        }
+        for (int i = 0; i < 3; i++) {
+            LoadProperty(*layout.point[i], block.data(), vertex.stride,
+                         int64_t(num), 1.0, points + first, i);
+            if (normals != nullptr) {
+                LoadProperty(*layout.normal[i], block.data(), vertex.stride,
+                             int64_t(num), 1.0, normals + first, i);
+            }
+            if (colors != nullptr) {
+                LoadProperty(*layout.color[i], block.data(), vertex.stride,
+                             int64_t(num), 255.0, colors + first, i);
+            }
+        }
+        progress_bar += num;
+    }
+    return true;
+}
+
+/// Converts a block of faces, returns false if a face is not a triangle.
+template <typename T>
+bool LoadTriangles(const uint8_t *block,
+                   int64_t num,
+                   Eigen::Vector3i *triangles) {
+    const size_t stride = 1 + 3 * sizeof(T);
+    int num_polygons = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : num_polygons)
+#endif
+    for (int64_t i = 0; i < num; i++) {
+        const uint8_t *face = block + i * stride;
+        if (face[0] != 3) {
+            num_polygons++;
+            continue;
+        }
+        for (int j = 0; j < 3; j++) {
+            T index;
+            memcpy(&index, face + 1 + j * sizeof(T), sizeof(T));
+            triangles[i](j) = int(index);
+        }
+    }
+    return num_polygons == 0;
+}
+
+/// Faces are read in bulk if they are all triangles with 8 bit lengths and
+/// 32 bit indices, which is how nearly all meshes are stored.
+bool IsTriangleBlockFace(const Element &face) {
+    if (face.properties.size() != 1) {
+        return false;
+    }
+    const Property &property = face.properties[0];
+    return property.is_list &&
+           (property.name == "vertex_indices" ||
+            property.name == "vertex_index") &&
+           GetScalarSize(property.length_type) == 1 &&
+           (property.type == ScalarType::Int32 ||
+            property.type == ScalarType::UInt32);
+}
+
+ReadResult ReadTriangles(FILE *file,
+                         const Element &face,
+                         Eigen::Vector3i *triangles,
+                         utility::ConsoleProgressBar &progress_bar) {
+    const Property &property = face.properties[0];
+    const size_t stride = 1 + 3 * GetScalarSize(property.type);
+    std::vector<uint8_t> block;
+    for (size_t first = 0; first < face.count; first += kBlockSize) {
+        const size_t num = std::min(kBlockSize, face.count - first);
+        block.resize(num * stride);
+        // polygons make the faces longer than expected, rply triangulates
+        // them
+        if (fread(block.data(), stride, num, file) != num) {
+            return ReadResult::Unsupported;
+        }
+        bool is_triangles =
+                property.type == ScalarType::Int32
+                        ? LoadTriangles<int32_t>(block.data(), int64_t(num),
+                                                 triangles + first)
+                        : LoadTriangles<uint32_t>(block.data(), int64_t(num),
+                                                  triangles + first);
+        if (!is_triangles) {
+            return ReadResult::Unsupported;
+        }
+        progress_bar += num;
+    }
+    return ReadResult::Success;
+}
+
+/// Opens a binary little endian file and parses its header, files in any
+/// other format are left to rply.
+FILE *OpenBinaryFile(const std::string &filename, Header &header) {
+    if (!IsLittleEndianHost()) {
+        return NULL;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    if (!ReadHeader(file, header) || !header.is_binary_little_endian) {
+        fclose(file);
+        return NULL;
+    }
+    return file;
+}
+
+ReadResult ReadPointCloud(const std::string &filename,
+                          geometry::PointCloud &pointcloud,
+                          bool print_progress) {
+    Header header;
+    FILE *file = OpenBinaryFile(filename, header);
+    if (file == NULL) {
+        return ReadResult::Unsupported;
+    }
+    // elements in front of the vertices must have a fixed size to be skipped
+    size_t vertex_index = 0;
+    uint64_t skipped_size = 0;
+    while (vertex_index < header.elements.size() &&
+           header.elements[vertex_index].name != "vertex" &&
+           !header.elements[vertex_index].has_list) {
+        skipped_size += uint64_t(header.elements[vertex_index].count) *
+                        header.elements[vertex_index].stride;
+        vertex_index++;
+    }
+    VertexLayout layout;
+    if (vertex_index == header.elements.size() ||
+        header.elements[vertex_index].name != "vertex" ||
+        header.elements[vertex_index].count == 0 ||
+        !GetVertexLayout(header.elements[vertex_index], layout)) {
+        fclose(file);
+        return ReadResult::Unsupported;
+    }
+    const Element &vertex = header.elements[vertex_index];
+
+    pointcloud.Clear();
+    pointcloud.points_.resize(vertex.count);
+    if (layout.normal[0] != nullptr) {
+        pointcloud.normals_.resize(vertex.count);
+    }
+    if (layout.color[0] != nullptr) {
+        pointcloud.colors_.resize(vertex.count);
+    }
+
+    utility::ConsoleProgressBar progress_bar(vertex.count + 1,
+                                             "Reading PLY: ", print_progress);
+    if (SkipBytes(file, skipped_size) != 0 ||
+        !ReadVertices(file, vertex, layout, pointcloud.points_.data(),
+                      pointcloud.HasNormals() ? pointcloud.normals_.data()
+                                              : nullptr,
+                      pointcloud.HasColors() ? pointcloud.colors_.data()
+                                             : nullptr,
+                      progress_bar)) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}",
+                            filename);
+        fclose(file);
+        return ReadResult::Failure;
+    }
+    fclose(file);
+    ++progress_bar;
+    return ReadResult::Success;
+}
+
+ReadResult ReadTriangleMesh(const std::string &filename,
+                            geometry::TriangleMesh &mesh,
+                            bool print_progress) {
+    Header header;
+    FILE *file = OpenBinaryFile(filename, header);
+    if (file == NULL) {
+        return ReadResult::Unsupported;
+    }
+    size_t vertex_index = header.elements.size();
+    size_t face_index = header.elements.size();
+    for (size_t i = 0; i < header.elements.size(); i++) {
+        if (header.elements[i].name == "vertex" &&
+            vertex_index == header.elements.size()) {
+            vertex_index = i;
+        } else if (header.elements[i].name == "face" &&
+                   face_index == header.elements.size()) {
+            face_index = i;
+        }
+    }
+    VertexLayout layout;
+    if (vertex_index == header.elements.size() ||
+        header.elements[vertex_index].count == 0 ||
+        !GetVertexLayout(header.elements[vertex_index], layout) ||
+        (face_index != header.elements.size() &&
+         !IsTriangleBlockFace(header.elements[face_index]))) {
+        fclose(file);
+        return ReadResult::Unsupported;
+    }
+    // elements in front of the vertices and faces must have a fixed size to
+    // be skipped
+    const size_t last_index = face_index != header.elements.size()
+                                      ? std::max(vertex_index, face_index)
+                                      : vertex_index;
+    for (size_t i = 0; i < last_index; i++) {
+        if (i != face_index && header.elements[i].has_list) {
+            fclose(file);
+            return ReadResult::Unsupported;
+        }
+    }
+    const Element &vertex = header.elements[vertex_index];
+
+    mesh.Clear();
+    mesh.vertices_.resize(vertex.count);
+    if (layout.normal[0] != nullptr) {
+        mesh.vertex_normals_.resize(vertex.count);
+    }
+    if (layout.color[0] != nullptr) {
+        mesh.vertex_colors_.resize(vertex.count);
+    }
+    if (face_index != header.elements.size()) {
+        mesh.triangles_.resize(header.elements[face_index].count);
+    }
+
+    utility::ConsoleProgressBar progress_bar(
+            vertex.count + mesh.triangles_.size(), "Reading PLY: ",
+            print_progress);
+    ReadResult result = ReadResult::Success;
+    for (size_t i = 0; i <= last_index && result == ReadResult::Success;
+         i++) {
+        const Element &element = header.elements[i];
+        if (i == vertex_index) {
+            if (!ReadVertices(file, element, layout, mesh.vertices_.data(),
+                              mesh.HasVertexNormals()
+                                      ? mesh.vertex_normals_.data()
+                                      : nullptr,
+                              mesh.HasVertexColors()
+                                      ? mesh.vertex_colors_.data()
+                                      : nullptr,
+                              progress_bar)) {
+                result = ReadResult::Failure;
+            }
+        } else if (i == face_index) {
+            result = ReadTriangles(file, element, mesh.triangles_.data(),
+                                   progress_bar);
+        } else if (SkipBytes(file, uint64_t(element.count) * element.stride) !=
+                   0) {
+            result = ReadResult::Failure;
+        }
+    }
+    fclose(file);
+    if (result == ReadResult::Failure) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}",
+                            filename);
+    }
+    return result;
+}
+
+bool WriteHeader(FILE *file,
+                 size_t num_vertices,
+                 bool has_normals,
+                 bool has_colors,
+                 const size_t *num_triangles) {
+    fprintf(file, "ply\nformat binary_little_endian 1.0\n");
+    fprintf(file, "comment Created by Open3D\n");
+    fprintf(file, "element vertex %zu\n", num_vertices);
+    fprintf(file, "property double x\nproperty double y\n");
+    fprintf(file, "property double z\n");
+    if (has_normals) {
+        fprintf(file, "property double nx\nproperty double ny\n");
+        fprintf(file, "property double nz\n");
+    }
+    if (has_colors) {
+        fprintf(file, "property uchar red\nproperty uchar green\n");
+        fprintf(file, "property uchar blue\n");
+    }
+    if (num_triangles != nullptr) {
+        fprintf(file, "element face %zu\n", *num_triangles);
+        fprintf(file, "property list uchar uint vertex_indices\n");
+    }
+    return fprintf(file, "end_header\n") > 0;
+}
+
+bool WriteVertices(FILE *file,
+                   const std::vector<Eigen::Vector3d> &points,
+                   const std::vector<Eigen::Vector3d> *normals,
+                   const std::vector<Eigen::Vector3d> *colors,
+                   utility::ConsoleProgressBar &progress_bar) {
+    const size_t normal_offset = 3 * sizeof(double);
+    const size_t color_offset =
+            normal_offset + (normals != nullptr ? 3 * sizeof(double) : 0);
+    const size_t stride = color_offset + (colors != nullptr ? 3 : 0);
+    std::vector<uint8_t> block;
+    int num_clamped = 0;
+    for (size_t first = 0; first < points.size(); first += kBlockSize) {
+        const int64_t num =
+                int64_t(std::min(kBlockSize, points.size() - first));
+        block.resize(num * stride);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : num_clamped)
+#endif
+        for (int64_t i = 0; i < num; i++) {
+            uint8_t *data = block.data() + i * stride;
+            memcpy(data, points[first + i].data(), 3 * sizeof(double));
+            if (normals != nullptr) {
+                memcpy(data + normal_offset, (*normals)[first + i].data(),
+                       3 * sizeof(double));
+            }
+            if (colors != nullptr) {
+                const Eigen::Vector3d &color = (*colors)[first + i];
+                for (int j = 0; j < 3; j++) {
+                    if (color(j) < 0 || color(j) > 1) {
+                        num_clamped++;
+                    }
+                    data[color_offset + j] = uint8_t(
+                            std::min(255.0, std::max(0.0, color(j) * 255.0)));
+                }
+            }
+        }
+        if (fwrite(block.data(), stride, size_t(num), file) != size_t(num)) {
+            return false;
+        }
+        progress_bar += size_t(num);
+    }
+    if (num_clamped > 0) {
+        utility::LogWarning("Write Ply clamped color value to valid range");
+    }
+    return true;
+}
+
+bool WriteTriangles(FILE *file,
+                    const std::vector<Eigen::Vector3i> &triangles,
+                    utility::ConsoleProgressBar &progress_bar) {
+    const size_t stride = 1 + 3 * sizeof(uint32_t);
+    std::vector<uint8_t> block;
+    for (size_t first = 0; first < triangles.size(); first += kBlockSize) {
+        const int64_t num =
+                int64_t(std::min(kBlockSize, triangles.size() - first));
+        block.resize(num * stride);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num; i++) {
+            uint8_t *data = block.data() + i * stride;
+            data[0] = 3;
+            for (int j = 0; j < 3; j++) {
+                uint32_t index = uint32_t(triangles[first + i](j));
+                memcpy(data + 1 + j * sizeof(uint32_t), &index,
+                       sizeof(uint32_t));
+            }
+        }
+        if (fwrite(block.data(), stride, size_t(num), file) != size_t(num)) {
+            return false;
+        }
+        progress_bar += size_t(num);
+    }
+    return true;
+}
+
+/// Writes the vertices and, if \p triangles is not nullptr, the faces of a
+/// binary little endian file, in the same layout as rply.
+bool WriteBinaryFile(const std::string &filename,
+                     const std::vector<Eigen::Vector3d> &points,
+                     const std::vector<Eigen::Vector3d> *normals,
+                     const std::vector<Eigen::Vector3d> *colors,
+                     const std::vector<Eigen::Vector3i> *triangles,
+                     bool print_progress) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write PLY failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const size_t num_triangles = triangles != nullptr ? triangles->size() : 0;
+    if (!WriteHeader(file, points.size(), normals != nullptr,
+                     colors != nullptr,
+                     triangles != nullptr ? &num_triangles : nullptr)) {
+        utility::LogWarning("Write PLY failed: unable to write header.");
+        fclose(file);
+        return false;
+    }
+    utility::ConsoleProgressBar progress_bar(points.size() + num_triangles,
+                                             "Writing PLY: ", print_progress);
+    bool success = WriteVertices(file, points, normals, colors, progress_bar);
+    if (success && triangles != nullptr) {
+        success = WriteTriangles(file, *triangles, progress_bar);
+    }
+    if (fclose(file) != 0 || !success) {
+        utility::LogWarning("Write PLY failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace ply_bulk_io
+
 }  // unnamed namespace
 
 namespace io {
@@ -360,6 +1002,12 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            bool print_progress) {
     using namespace ply_pointcloud_reader;
 
+    ply_bulk_io::ReadResult result = ply_bulk_io::ReadPointCloud(
+            filename, pointcloud, print_progress);
+    if (result != ply_bulk_io::ReadResult::Unsupported) {
+        return result == ply_bulk_io::ReadResult::Success;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -420,6 +1068,52 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     return true;
 }
 
+bool ReadMappedPointCloudLayoutFromPLY(const std::string &filename,
+                                       MappedPointCloudLayout &layout) {
+    using namespace ply_bulk_io;
+
+    Header header;
+    FILE *file = OpenBinaryFile(filename, header);
+    if (file == NULL) {
+        return false;
+    }
+    uint64_t offset = uint64_t(ftell(file));
+    fclose(file);
+    for (const auto &element : header.elements) {
+        if (element.name == "vertex") {
+            VertexLayout vertex_layout;
+            if (!GetVertexLayout(element, vertex_layout)) {
+                return false;
+            }
+            auto to_field = [&](const Property *property) {
+                MappedPointCloudLayout::Field field;
+                field.type = property->type;
+                field.offset = offset + property->offset;
+                field.stride = element.stride;
+                return field;
+            };
+            layout.num_points = element.count;
+            layout.has_normals = vertex_layout.normal[0] != nullptr;
+            layout.has_colors = vertex_layout.color[0] != nullptr;
+            for (int i = 0; i < 3; i++) {
+                layout.points[i] = to_field(vertex_layout.point[i]);
+                if (layout.has_normals) {
+                    layout.normals[i] = to_field(vertex_layout.normal[i]);
+                }
+                if (layout.has_colors) {
+                    layout.colors[i] = to_field(vertex_layout.color[i]);
+                }
+            }
+            return true;
+        }
+        if (element.has_list) {
+            return false;
+        }
+        offset += uint64_t(element.count) * element.stride;
+    }
+    return false;
+}
+
 bool WritePointCloudToPLY(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           bool write_ascii /* = false*/,
@@ -429,6 +1123,13 @@ bool WritePointCloudToPLY(const std::string &filename,
         utility::LogWarning("Write PLY failed: point cloud has 0 points.");
         return false;
     }
+    if (!write_ascii && ply_bulk_io::IsLittleEndianHost()) {
+        return ply_bulk_io::WriteBinaryFile(
+                filename, pointcloud.points_,
+                pointcloud.HasNormals() ? &pointcloud.normals_ : nullptr,
+                pointcloud.HasColors() ? &pointcloud.colors_ : nullptr,
+                nullptr, print_progress);
+    }
 
     p_ply ply_file = ply_create(filename.c_str(),
                                 write_ascii ? PLY_ASCII : PLY_LITTLE_ENDIAN,
@@ -504,6 +1205,12 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
                              bool print_progress) {
     using namespace ply_trianglemesh_reader;
 
+    ply_bulk_io::ReadResult result =
+            ply_bulk_io::ReadTriangleMesh(filename, mesh, print_progress);
+    if (result != ply_bulk_io::ReadResult::Unsupported) {
+        return result == ply_bulk_io::ReadResult::Success;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -590,6 +1297,16 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
         return false;
     }
 
+    write_vertex_normals = write_vertex_normals && mesh.HasVertexNormals();
+    write_vertex_colors = write_vertex_colors && mesh.HasVertexColors();
+    if (!write_ascii && ply_bulk_io::IsLittleEndianHost()) {
+        return ply_bulk_io::WriteBinaryFile(
+                filename, mesh.vertices_,
+                write_vertex_normals ? &mesh.vertex_normals_ : nullptr,
+                write_vertex_colors ? &mesh.vertex_colors_ : nullptr,
+                &mesh.triangles_, print_progress);
+    }
+
     p_ply ply_file = ply_create(filename.c_str(),
                                 write_ascii ? PLY_ASCII : PLY_LITTLE_ENDIAN,
                                 NULL, 0, NULL);
@@ -599,9 +1316,6 @@ bool WriteTriangleMeshToPLY(const std::string &filename,
         return false;
     }
 
-    write_vertex_normals = write_vertex_normals && mesh.HasVertexNormals();
-    write_vertex_colors = write_vertex_colors && mesh.HasVertexColors();
-
     ply_add_comment(ply_file, "Created by Open3D");
     ply_add_element(ply_file, "vertex",
                     static_cast<long>(mesh.vertices_.size()));
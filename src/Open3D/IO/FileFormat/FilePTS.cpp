@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <iterator>
+
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
@@ -52,44 +54,55 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         fclose(file);
         return false;
     }
-    utility::ConsoleProgressBar progress_bar(num_of_pts,
-                                             "Reading PTS: ", print_progress);
-    size_t idx = 0;
-    while (idx < num_of_pts &&
-           fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        if (num_of_fields == 0) {
-            std::vector<std::string> st;
-            utility::SplitString(st, line_buffer, " ");
-            num_of_fields = (int)st.size();
-            if (num_of_fields < 3) {
-                utility::LogWarning(
-                        "Read PTS failed: insufficient data fields.");
-                fclose(file);
-                return false;
-            }
-            pointcloud.points_.resize(num_of_pts);
-            if (num_of_fields >= 7) {
-                // X Y Z I R G B
-                pointcloud.colors_.resize(num_of_pts);
-            }
-        }
-        double x, y, z;
-        int i, r, g, b;
-        if (num_of_fields < 7) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            }
-        } else {
-            if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z, &i,
-                       &r, &g, &b) == 7) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = Eigen::Vector3d(r, g, b) / 255.0;
-            }
-        }
-        idx++;
-        ++progress_bar;
+    // the number of fields is taken from the first point
+    if (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::vector<std::string> st;
+        utility::SplitString(st, line_buffer, " ");
+        num_of_fields = (int)st.size();
     }
     fclose(file);
+    pointcloud.Clear();
+    if (num_of_fields == 0) {
+        return true;
+    }
+    if (num_of_fields < 3) {
+        utility::LogWarning("Read PTS failed: insufficient data fields.");
+        return false;
+    }
+
+    // every line is a point, unparsable lines give a point at the origin
+    const bool has_colors = num_of_fields >= 7;
+    if (!ReadPointCloudFromASCIIFile(
+                filename, "PTS", pointcloud,
+                [has_colors](const char *line_begin, const char *line_end,
+                             geometry::PointCloud &chunk) {
+                    // X Y Z I R G B
+                    double values[7];
+                    size_t num_values = has_colors ? 7 : 3;
+                    Eigen::Vector3d point = Eigen::Vector3d::Zero();
+                    Eigen::Vector3d color = Eigen::Vector3d::Zero();
+                    if (utility::ParseNumbers(line_begin, line_end, values,
+                                              num_values) == num_values) {
+                        point = Eigen::Vector3d(values);
+                        if (has_colors) {
+                            color = Eigen::Vector3d(int(values[4]),
+                                                    int(values[5]),
+                                                    int(values[6])) /
+                                    255.0;
+                        }
+                    }
+                    chunk.points_.push_back(point);
+                    if (has_colors) {
+                        chunk.colors_.push_back(color);
+                    }
+                },
+                1, num_of_pts, print_progress)) {
+        return false;
+    }
+    pointcloud.points_.resize(num_of_pts, Eigen::Vector3d::Zero());
+    if (has_colors) {
+        pointcloud.colors_.resize(num_of_pts, Eigen::Vector3d::Zero());
+    }
     return true;
 }
 
@@ -98,30 +111,25 @@ bool WritePointCloudToPTS(const std::string &filename,
                           bool write_ascii /* = false*/,
                           bool compressed /* = false*/,
                           bool print_progress) {
-    FILE *file = utility::filesystem::FOpen(filename, "w");
-    if (file == NULL) {
-        utility::LogWarning("Write PTS failed: unable to open file.");
-        return false;
-    }
-    fprintf(file, "%zu\r\n", (size_t)pointcloud.points_.size());
-    utility::ConsoleProgressBar progress_bar(
-            static_cast<size_t>(pointcloud.points_.size()),
-            "Writing PTS: ", print_progress);
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        if (pointcloud.HasColors() == false) {
-            fprintf(file, "%.10f %.10f %.10f\r\n", point(0), point(1),
-                    point(2));
-        } else {
-            const auto &color = pointcloud.colors_[i] * 255.0;
-            fprintf(file, "%.10f %.10f %.10f %d %d %d %d\r\n", point(0),
-                    point(1), point(2), 0, (int)color(0), (int)color(1),
-                    (int)(color(2)));
-        }
-        ++progress_bar;
-    }
-    fclose(file);
-    return true;
+    return WritePointCloudToASCIIFile(
+            filename, "PTS", fmt::format("{}\r\n", pointcloud.points_.size()),
+            pointcloud.points_.size(),
+            [&pointcloud](size_t i, std::string &buffer) {
+                const auto &point = pointcloud.points_[i];
+                if (pointcloud.HasColors() == false) {
+                    fmt::format_to(std::back_inserter(buffer),
+                                   "{:.10f} {:.10f} {:.10f}\r\n", point(0),
+                                   point(1), point(2));
+                } else {
+                    const auto &color = pointcloud.colors_[i] * 255.0;
+                    fmt::format_to(std::back_inserter(buffer),
+                                   "{:.10f} {:.10f} {:.10f} {} {} {} {}\r\n",
+                                   point(0), point(1), point(2), 0,
+                                   (int)color(0), (int)color(1),
+                                   (int)(color(2)));
+                }
+            },
+            print_progress);
 }
 
 }  // namespace io
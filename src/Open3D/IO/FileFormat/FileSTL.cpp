@@ -24,7 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <fstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <vector>
 
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
@@ -32,72 +35,134 @@
 #include "Open3D/Utility/FileSystem.h"
 
 namespace open3d {
+
+namespace {
+
+// Binary STL files are read and written in blocks of this many facets, the
+// facets of a block are converted in parallel.
+const size_t kSTLBlockSize = 1 << 18;
+const size_t kSTLHeaderSize = 80;
+const size_t kSTLFacetSize = 50;
+
+void LoadSTLVector(const uint8_t *data, Eigen::Vector3d &vector) {
+    float values[3];
+    memcpy(values, data, sizeof(values));
+    vector = Eigen::Vector3d(values[0], values[1], values[2]);
+}
+
+void StoreSTLVector(const Eigen::Vector3d &vector, uint8_t *data) {
+    float values[3] = {float(vector(0)), float(vector(1)), float(vector(2))};
+    memcpy(data, values, sizeof(values));
+}
+
+/// Returns the size of \p file and leaves the position at \p position.
+bool GetSTLFileSize(FILE *file, uint64_t position, uint64_t &size) {
+#ifdef _WIN32
+    if (_fseeki64(file, 0, SEEK_END) != 0) {
+        return false;
+    }
+    size = uint64_t(_ftelli64(file));
+    return _fseeki64(file, (__int64)position, SEEK_SET) == 0;
+#else
+    if (fseeko(file, 0, SEEK_END) != 0) {
+        return false;
+    }
+    size = uint64_t(ftello(file));
+    return fseeko(file, (off_t)position, SEEK_SET) == 0;
+#endif
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
-    FILE *myFile = utility::filesystem::FOpen(filename.c_str(), "rb");
-
-    if (!myFile) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
         utility::LogWarning("Read STL failed: unable to open file.");
-        fclose(myFile);
         return false;
     }
 
-    int num_of_triangles;
-    if (myFile) {
-        char header[80] = "";
-        fread(header, sizeof(char), 80, myFile);
-        fread(&num_of_triangles, sizeof(unsigned int), 1, myFile);
-    } else {
+    char header[kSTLHeaderSize];
+    uint32_t num_of_triangles = 0;
+    if (fread(header, 1, kSTLHeaderSize, file) != kSTLHeaderSize ||
+        fread(&num_of_triangles, sizeof(uint32_t), 1, file) != 1) {
         utility::LogWarning("Read STL failed: unable to read header.");
-        fclose(myFile);
+        fclose(file);
         return false;
     }
-
     if (num_of_triangles == 0) {
         utility::LogWarning("Read STL failed: empty file.");
-        fclose(myFile);
+        fclose(file);
+        return false;
+    }
+    if (num_of_triangles > uint32_t(std::numeric_limits<int>::max() / 3)) {
+        utility::LogWarning("Read STL failed: too many triangles.");
+        fclose(file);
+        return false;
+    }
+    // the triangle count of a truncated or corrupted header must not be
+    // trusted for the allocation
+    uint64_t file_size = 0;
+    if (!GetSTLFileSize(file, kSTLHeaderSize + sizeof(uint32_t), file_size) ||
+        file_size < kSTLHeaderSize + sizeof(uint32_t) +
+                            uint64_t(num_of_triangles) * kSTLFacetSize) {
+        utility::LogWarning("Read STL failed: not enough triangles.");
+        fclose(file);
         return false;
     }
 
-    mesh.vertices_.clear();
-    mesh.triangles_.clear();
-    mesh.triangle_normals_.clear();
-    mesh.vertices_.resize(num_of_triangles * 3);
+    mesh.Clear();
+    mesh.vertices_.resize(size_t(num_of_triangles) * 3);
     mesh.triangles_.resize(num_of_triangles);
     mesh.triangle_normals_.resize(num_of_triangles);
 
     utility::ConsoleProgressBar progress_bar(num_of_triangles,
                                              "Reading STL: ", print_progress);
-    for (int i = 0; i < num_of_triangles; i++) {
-        char buffer[50];
-        float *float_buffer;
-        if (myFile) {
-            fread(buffer, sizeof(char), 50, myFile);
-            float_buffer = reinterpret_cast<float *>(buffer);
-            mesh.triangle_normals_[i] =
-                    Eigen::Map<Eigen::Vector3f>(float_buffer).cast<double>();
-            for (int j = 0; j < 3; j++) {
-                float_buffer = reinterpret_cast<float *>(buffer + 12 * (j + 1));
-                mesh.vertices_[i * 3 + j] =
-                        Eigen::Map<Eigen::Vector3f>(float_buffer)
-                                .cast<double>();
-            }
-            mesh.triangles_[i] =
-                    Eigen::Vector3i(i * 3 + 0, i * 3 + 1, i * 3 + 2);
-            // ignore buffer[48] and buffer [49] because it is rarely used.
-
-        } else {
+    std::vector<uint8_t> block;
+    for (size_t first = 0; first < num_of_triangles; first += kSTLBlockSize) {
+        const int64_t num = int64_t(
+                std::min(kSTLBlockSize, size_t(num_of_triangles) - first));
+        block.resize(num * kSTLFacetSize);
+        if (fread(block.data(), kSTLFacetSize, size_t(num), file) !=
+            size_t(num)) {
             utility::LogWarning("Read STL failed: not enough triangles.");
-            fclose(myFile);
+            fclose(file);
+            mesh.Clear();
             return false;
         }
-        ++progress_bar;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num; i++) {
+            // ignore the last two bytes of a facet because they are rarely
+            // used.
+            const uint8_t *data = block.data() + i * kSTLFacetSize;
+            const int tidx = int(first + i);
+            LoadSTLVector(data, mesh.triangle_normals_[tidx]);
+            for (int j = 0; j < 3; j++) {
+                LoadSTLVector(data + 12 * (j + 1),
+                              mesh.vertices_[tidx * 3 + j]);
+            }
+            mesh.triangles_[tidx] =
+                    Eigen::Vector3i(tidx * 3 + 0, tidx * 3 + 1, tidx * 3 + 2);
+        }
+        progress_bar += size_t(num);
     }
 
-    fclose(myFile);
+    fclose(file);
+    return true;
+}
+
+bool ReadIndexedTriangleMeshFromSTL(const std::string &filename,
+                                    geometry::TriangleMesh &mesh,
+                                    bool print_progress /* = false*/) {
+    if (!ReadTriangleMeshFromSTL(filename, mesh, print_progress)) {
+        return false;
+    }
+    mesh.RemoveDuplicatedVertices();
     return true;
 }
 
@@ -115,42 +180,73 @@ bool WriteTriangleMeshToSTL(const std::string &filename,
                 "coordinates. Consider using .obj");
     }
 
-    std::ofstream myFile(filename.c_str(), std::ios::out | std::ios::binary);
-
-    if (!myFile) {
-        utility::LogWarning("Write STL failed: unable to open file.");
+    size_t num_of_triangles = mesh.triangles_.size();
+    if (num_of_triangles == 0) {
+        utility::LogWarning("Write STL failed: empty file.");
         return false;
     }
-
-    if (!mesh.HasTriangleNormals()) {
-        utility::LogWarning("Write STL failed: compute normals first.");
+    if (num_of_triangles > std::numeric_limits<uint32_t>::max()) {
+        utility::LogWarning("Write STL failed: too many triangles.");
         return false;
     }
 
-    size_t num_of_triangles = mesh.triangles_.size();
-    if (num_of_triangles == 0) {
-        utility::LogWarning("Write STL failed: empty file.");
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write STL failed: unable to open file.");
         return false;
     }
-    char header[80] = "Created by Open3D";
-    myFile.write(header, 80);
-    myFile.write((char *)(&num_of_triangles), 4);
+
+    // Facet normals that are not stored in the mesh are computed from the
+    // vertices while the blocks are filled.
+    const bool has_triangle_normals = mesh.HasTriangleNormals();
+    char header[kSTLHeaderSize] = "Created by Open3D";
+    const uint32_t num_of_triangles_u32 = uint32_t(num_of_triangles);
+    bool success = fwrite(header, 1, kSTLHeaderSize, file) == kSTLHeaderSize &&
+                   fwrite(&num_of_triangles_u32, sizeof(uint32_t), 1, file) ==
+                           1;
 
     utility::ConsoleProgressBar progress_bar(num_of_triangles,
                                              "Writing STL: ", print_progress);
-    for (size_t i = 0; i < num_of_triangles; i++) {
-        Eigen::Vector3f float_vector3f =
-                mesh.triangle_normals_[i].cast<float>();
-        myFile.write(reinterpret_cast<const char *>(float_vector3f.data()), 12);
-        for (int j = 0; j < 3; j++) {
-            Eigen::Vector3f float_vector3f =
-                    mesh.vertices_[mesh.triangles_[i][j]].cast<float>();
-            myFile.write(reinterpret_cast<const char *>(float_vector3f.data()),
-                         12);
+    std::vector<uint8_t> block;
+    for (size_t first = 0; success && first < num_of_triangles;
+         first += kSTLBlockSize) {
+        const int64_t num =
+                int64_t(std::min(kSTLBlockSize, num_of_triangles - first));
+        block.resize(num * kSTLFacetSize);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < num; i++) {
+            uint8_t *data = block.data() + i * kSTLFacetSize;
+            const Eigen::Vector3i &triangle = mesh.triangles_[first + i];
+            const Eigen::Vector3d &v0 = mesh.vertices_[triangle(0)];
+            const Eigen::Vector3d &v1 = mesh.vertices_[triangle(1)];
+            const Eigen::Vector3d &v2 = mesh.vertices_[triangle(2)];
+            Eigen::Vector3d normal;
+            if (has_triangle_normals) {
+                normal = mesh.triangle_normals_[first + i];
+            } else {
+                normal = (v1 - v0).cross(v2 - v0);
+                double norm = normal.norm();
+                if (norm > 0) {
+                    normal /= norm;
+                }
+            }
+            StoreSTLVector(normal, data);
+            StoreSTLVector(v0, data + 12);
+            StoreSTLVector(v1, data + 24);
+            StoreSTLVector(v2, data + 36);
+            data[48] = 0;
+            data[49] = 0;
         }
-        char blank[2] = {0, 0};
-        myFile.write(blank, 2);
-        ++progress_bar;
+        success = fwrite(block.data(), kSTLFacetSize, size_t(num), file) ==
+                  size_t(num);
+        progress_bar += size_t(num);
+    }
+    if (fclose(file) != 0 || !success) {
+        utility::LogWarning("Write STL failed: unable to write file: {}",
+                            filename);
+        return false;
     }
     return true;
 }
@@ -24,11 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <cstdio>
+#include <iterator>
 
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/Utility/Console.h"
-#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace io {
@@ -36,27 +36,18 @@ namespace io {
 bool ReadPointCloudFromXYZRGB(const std::string &filename,
                               geometry::PointCloud &pointcloud,
                               bool print_progress) {
-    FILE *file = utility::filesystem::FOpen(filename, "r");
-    if (file == NULL) {
-        utility::LogWarning("Read XYZRGB failed: unable to open file: {}",
-                            filename);
-        return false;
-    }
-
-    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-    double x, y, z, r, g, b;
-    pointcloud.Clear();
-
-    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &r, &g,
-                   &b) == 6) {
-            pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            pointcloud.colors_.push_back(Eigen::Vector3d(r, g, b));
-        }
-    }
-
-    fclose(file);
-    return true;
+    return ReadPointCloudFromASCIIFile(
+            filename, "XYZRGB", pointcloud,
+            [](const char *line_begin, const char *line_end,
+               geometry::PointCloud &chunk) {
+                double values[6];
+                if (utility::ParseNumbers(line_begin, line_end, values, 6) ==
+                    6) {
+                    chunk.points_.push_back(Eigen::Vector3d(values));
+                    chunk.colors_.push_back(Eigen::Vector3d(values + 3));
+                }
+            },
+            0, size_t(-1), print_progress);
 }
 
 bool WritePointCloudToXYZRGB(const std::string &filename,
@@ -68,27 +59,18 @@ bool WritePointCloudToXYZRGB(const std::string &filename,
         return false;
     }
 
-    FILE *file = utility::filesystem::FOpen(filename, "w");
-    if (file == NULL) {
-        utility::LogWarning("Write XYZRGB failed: unable to open file: {}",
-                            filename);
-        return false;
-    }
-
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const Eigen::Vector3d &point = pointcloud.points_[i];
-        const Eigen::Vector3d &color = pointcloud.colors_[i];
-        if (fprintf(file, "%.10f %.10f %.10f %.10f %.10f %.10f\n", point(0),
-                    point(1), point(2), color(0), color(1), color(2)) < 0) {
-            utility::LogWarning("Write XYZRGB failed: unable to write file: {}",
-                                filename);
-            fclose(file);
-            return false;  // error happens during writing.
-        }
-    }
-
-    fclose(file);
-    return true;
+    return WritePointCloudToASCIIFile(
+            filename, "XYZRGB", "", pointcloud.points_.size(),
+            [&pointcloud](size_t i, std::string &buffer) {
+                const Eigen::Vector3d &point = pointcloud.points_[i];
+                const Eigen::Vector3d &color = pointcloud.colors_[i];
+                fmt::format_to(std::back_inserter(buffer),
+                               "{:.10f} {:.10f} {:.10f} "
+                               "{:.10f} {:.10f} {:.10f}\n",
+                               point(0), point(1), point(2), color(0),
+                               color(1), color(2));
+            },
+            print_progress);
 }
 
 }  // namespace io
@@ -26,6 +26,8 @@
 
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 
+#include <algorithm>
+#include <limits>
 #include <unordered_set>
 
 #include "Open3D/Geometry/PointCloud.h"
@@ -444,5 +446,98 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                    r(1) * ((1 - r(2)) * f[2] + r(2) * f[6]));
 }
 
+bool ScalableTSDFVolume::GetObservedTSDFAt(const Eigen::Vector3d &p,
+                                           double &tsdf,
+                                           Eigen::Vector3d *color) const {
+    Eigen::Vector3d p_locate =
+            p - Eigen::Vector3d(0.5, 0.5, 0.5) * voxel_length_;
+    Eigen::Vector3i index0 = LocateVolumeUnit(p_locate);
+    auto unit_itr = volume_units_.find(index0);
+    if (unit_itr == volume_units_.end()) {
+        return false;
+    }
+    const auto &volume0 = *unit_itr->second.volume_;
+    Eigen::Vector3i idx0;
+    Eigen::Vector3d p_grid =
+            (p_locate - index0.cast<double>() * volume_unit_length_) /
+            voxel_length_;
+    for (int i = 0; i < 3; i++) {
+        idx0(i) = (int)std::floor(p_grid(i));
+        if (idx0(i) < 0) idx0(i) = 0;
+        if (idx0(i) >= volume_unit_resolution_)
+            idx0(i) = volume_unit_resolution_ - 1;
+    }
+    Eigen::Vector3d r = p_grid - idx0.cast<double>();
+    double observed_weight = 0.0;
+    tsdf = 0.0;
+    if (color != nullptr) {
+        color->setZero();
+    }
+    for (int i = 0; i < 8; i++) {
+        Eigen::Vector3i index1 = index0;
+        Eigen::Vector3i idx1 = idx0 + shift[i];
+        const geometry::TSDFVoxel *voxel;
+        if (idx1(0) < volume_unit_resolution_ &&
+            idx1(1) < volume_unit_resolution_ &&
+            idx1(2) < volume_unit_resolution_) {
+            voxel = &volume0.voxels_[volume0.IndexOf(idx1)];
+        } else {
+            for (int j = 0; j < 3; j++) {
+                if (idx1(j) >= volume_unit_resolution_) {
+                    idx1(j) -= volume_unit_resolution_;
+                    index1(j) += 1;
+                }
+            }
+            auto unit_itr1 = volume_units_.find(index1);
+            if (unit_itr1 == volume_units_.end()) {
+                continue;
+            }
+            const auto &volume1 = *unit_itr1->second.volume_;
+            voxel = &volume1.voxels_[volume1.IndexOf(idx1)];
+        }
+        if (voxel->weight_ == 0.0f) {
+            continue;
+        }
+        double w = 1.0;
+        for (int j = 0; j < 3; j++) {
+            w *= shift[i](j) == 1 ? r(j) : 1.0 - r(j);
+        }
+        observed_weight += w;
+        tsdf += w * voxel->tsdf_;
+        if (color != nullptr) {
+            *color += w * voxel->color_;
+        }
+    }
+    // unobserved voxels are left out, as long as the observed ones carry
+    // most of the interpolation weight
+    if (observed_weight < 0.5) {
+        return false;
+    }
+    tsdf /= observed_weight;
+    if (color != nullptr) {
+        *color /= observed_weight;
+    }
+    return true;
+}
+
+double ScalableTSDFVolume::GetRaycastSkipDistance(
+        const Eigen::Vector3d &p, const Eigen::Vector3d &direction) const {
+    Eigen::Vector3i index = LocateVolumeUnit(p);
+    if (volume_units_.find(index) != volume_units_.end()) {
+        return 0.0;
+    }
+    // skip to where the ray leaves the empty volume unit
+    double skip = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; i++) {
+        if (direction(i) == 0.0) {
+            continue;
+        }
+        double bound = (index(i) + (direction(i) > 0.0 ? 1 : 0)) *
+                       volume_unit_length_;
+        skip = std::min(skip, (bound - p(i)) / direction(i));
+    }
+    return std::max(skip, 0.0) + 0.01 * voxel_length_;
+}
+
 }  // namespace integration
 }  // namespace open3d
@@ -97,8 +97,16 @@ public:
                        utility::hash_eigen::hash<Eigen::Vector3i>>
             volume_units_;
 
+protected:
+    bool GetObservedTSDFAt(const Eigen::Vector3d &p,
+                           double &tsdf,
+                           Eigen::Vector3d *color) const override;
+    double GetRaycastSkipDistance(
+            const Eigen::Vector3d &p,
+            const Eigen::Vector3d &direction) const override;
+
 private:
-    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
+    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) const {
         return Eigen::Vector3i((int)std::floor(point(0) / volume_unit_length_),
                                (int)std::floor(point(1) / volume_unit_length_),
                                (int)std::floor(point(2) / volume_unit_length_));
@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFVolume.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace integration {
+
+std::shared_ptr<TSDFRaycastResult> TSDFVolume::Raycast(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        double depth_min /* = 0.1*/,
+        double depth_max /* = 3.0*/) const {
+    if (intrinsic.width_ <= 0 || intrinsic.height_ <= 0) {
+        utility::LogError("[TSDFVolume::Raycast] Invalid camera intrinsic.");
+    }
+    if (depth_min <= 0.0 || depth_max <= depth_min) {
+        utility::LogError("[TSDFVolume::Raycast] Invalid depth range.");
+    }
+    auto result = std::make_shared<TSDFRaycastResult>();
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    result->depth_.Prepare(width, height, 1, 4);
+    result->vertex_map_.Prepare(width, height, 3, 4);
+    result->normal_map_.Prepare(width, height, 3, 4);
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        result->color_.Prepare(width, height, 3, 1);
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        result->color_.Prepare(width, height, 1, 4);
+    }
+
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+    const Eigen::Matrix4d pose = extrinsic.inverse();
+    const Eigen::Matrix3d R = pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = pose.block<3, 1>(0, 3);
+    const double half_gap = 0.99 * voxel_length_;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            // the ray is parametrized by depth, so a step of s meters along
+            // the ray advances the depth by s / ray_norm
+            Eigen::Vector3d ray =
+                    R * Eigen::Vector3d((u - cx) / fx, (v - cy) / fy, 1.0);
+            const double ray_norm = ray.norm();
+            const Eigen::Vector3d direction = ray / ray_norm;
+            double depth = depth_min;
+            double prev_depth = 0.0;
+            double prev_tsdf = 0.0;
+            bool prev_valid = false;
+            double hit_depth = 0.0;
+            while (depth < depth_max) {
+                Eigen::Vector3d p = origin + depth * ray;
+                double skip = GetRaycastSkipDistance(p, direction);
+                if (skip > 0.0) {
+                    depth += skip / ray_norm;
+                    prev_valid = false;
+                    continue;
+                }
+                // sparsely observed voxels, e.g. at the border of the
+                // integrated frustums, are stepped over without forgetting
+                // the last valid sample
+                double tsdf;
+                if (!GetObservedTSDFAt(p, tsdf, nullptr)) {
+                    depth += voxel_length_ / ray_norm;
+                    prev_valid = prev_valid && depth - prev_depth <
+                                                       sdf_trunc_ / ray_norm;
+                    continue;
+                }
+                if (prev_valid && prev_tsdf > 0.0 && tsdf <= 0.0) {
+                    hit_depth = prev_depth + (depth - prev_depth) * prev_tsdf /
+                                                     (prev_tsdf - tsdf);
+                    break;
+                }
+                prev_depth = depth;
+                prev_tsdf = tsdf;
+                prev_valid = true;
+                // the truncated distance bounds how far the ray can move
+                // without crossing the surface
+                depth += std::max(tsdf * sdf_trunc_, voxel_length_) / ray_norm;
+            }
+            if (hit_depth <= 0.0) {
+                continue;
+            }
+
+            Eigen::Vector3d vertex = origin + hit_depth * ray;
+            double tsdf;
+            Eigen::Vector3d color = Eigen::Vector3d::Zero();
+            if (!GetObservedTSDFAt(vertex, tsdf,
+                                   color_type_ != TSDFVolumeColorType::NoColor
+                                           ? &color
+                                           : nullptr)) {
+                continue;
+            }
+            // central differences of the TSDF, one-sided where the thin band
+            // behind surfaces seen at grazing angles has not been observed
+            Eigen::Vector3d normal;
+            bool is_normal_valid = true;
+            for (int i = 0; i < 3 && is_normal_valid; i++) {
+                Eigen::Vector3d p0 = vertex;
+                p0(i) -= half_gap;
+                Eigen::Vector3d p1 = vertex;
+                p1(i) += half_gap;
+                double f0, f1;
+                bool is_valid0 = GetObservedTSDFAt(p0, f0, nullptr);
+                bool is_valid1 = GetObservedTSDFAt(p1, f1, nullptr);
+                if (is_valid0 && is_valid1) {
+                    normal(i) = (f1 - f0) * 0.5;
+                } else if (is_valid0) {
+                    normal(i) = tsdf - f0;
+                } else if (is_valid1) {
+                    normal(i) = f1 - tsdf;
+                } else {
+                    is_normal_valid = false;
+                }
+            }
+            if (!is_normal_valid || normal.norm() == 0.0) {
+                continue;
+            }
+            normal.normalize();
+
+            *result->depth_.PointerAt<float>(u, v) = float(hit_depth);
+            for (int i = 0; i < 3; i++) {
+                *result->vertex_map_.PointerAt<float>(u, v, i) =
+                        float(vertex(i));
+                *result->normal_map_.PointerAt<float>(u, v, i) =
+                        float(normal(i));
+            }
+            if (color_type_ == TSDFVolumeColorType::RGB8) {
+                for (int i = 0; i < 3; i++) {
+                    *result->color_.PointerAt<uint8_t>(u, v, i) = uint8_t(
+                            std::min(std::max(color(i), 0.0), 255.0) + 0.5);
+                }
+            } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+                *result->color_.PointerAt<float>(u, v) = float(color(0));
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace integration
+}  // namespace open3d
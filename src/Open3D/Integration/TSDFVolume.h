@@ -46,6 +46,25 @@ enum class TSDFVolumeColorType {
     Gray32 = 2,
 };
 
+/// \class TSDFRaycastResult
+///
+/// \brief Images of the surface in a TSDF volume, see TSDFVolume::Raycast.
+///
+/// Pixels whose ray does not hit the surface have zero depth, vertex, normal
+/// and color.
+class TSDFRaycastResult {
+public:
+    /// Depth along the camera z axis in meters, 1 channel float.
+    geometry::Image depth_;
+    /// Surface points in world coordinates, 3 channel float.
+    geometry::Image vertex_map_;
+    /// Unit surface normals in world coordinates, 3 channel float.
+    geometry::Image normal_map_;
+    /// Surface color, 3 channel uint8 for TSDFVolumeColorType::RGB8, 1 channel
+    /// float for TSDFVolumeColorType::Gray32 and empty without color.
+    geometry::Image color_;
+};
+
 /// \class TSDFVolume
 ///
 /// \brief Base class of the Truncated Signed Distance Function (TSDF) volume.
@@ -88,6 +107,46 @@ public:
     /// algorithm. (https://en.wikipedia.org/wiki/Marching_cubes)
     virtual std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() = 0;
 
+    /// \brief Function to render the surface seen from a camera by marching
+    /// rays through the volume.
+    ///
+    /// Every pixel casts a ray that skips unallocated space, steps through
+    /// free space by the truncated distance and stops at the first zero
+    /// crossing from the front, as in the following paper:
+    ///
+    /// R. A. Newcombe et al.
+    /// KinectFusion: Real-time dense surface mapping and tracking
+    /// In ISMAR, 2011
+    ///
+    /// The depth and color of the result can be tracked against with
+    /// odometry, see geometry::RGBDImage::CreateFromColorAndDepth.
+    ///
+    /// \param intrinsic Intrinsic parameters of the rendered camera.
+    /// \param extrinsic Extrinsic parameters of the rendered camera, the same
+    /// world to camera transformation as in Integrate.
+    /// \param depth_min Depth the rays start from.
+    /// \param depth_max Depth the rays stop at.
+    std::shared_ptr<TSDFRaycastResult> Raycast(
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            double depth_min = 0.1,
+            double depth_max = 3.0) const;
+
+protected:
+    /// Trilinearly interpolates the TSDF, and the color if \p color is not
+    /// null, at point \p p over the voxels that have been observed. Returns
+    /// false if those carry less than half of the interpolation weight.
+    virtual bool GetObservedTSDFAt(const Eigen::Vector3d &p,
+                                   double &tsdf,
+                                   Eigen::Vector3d *color) const = 0;
+
+    /// Returns the distance a ray from point \p p along the unit vector \p
+    /// direction can skip because the volume stores nothing there, 0 if \p p
+    /// may be next to observed voxels.
+    virtual double GetRaycastSkipDistance(
+            const Eigen::Vector3d &p,
+            const Eigen::Vector3d &direction) const = 0;
+
 public:
     /// Length of the voxel in meters.
     double voxel_length_;
@@ -26,7 +26,9 @@
 
 #include "Open3D/Integration/UniformTSDFVolume.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <thread>
 #include <unordered_map>
 
@@ -416,5 +418,76 @@ double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
     return tsdf;
 }
 
+bool UniformTSDFVolume::GetObservedTSDFAt(const Eigen::Vector3d &p,
+                                          double &tsdf,
+                                          Eigen::Vector3d *color) const {
+    Eigen::Vector3i idx;
+    Eigen::Vector3d p_grid =
+            (p - origin_) / voxel_length_ - Eigen::Vector3d(0.5, 0.5, 0.5);
+    for (int i = 0; i < 3; i++) {
+        idx(i) = (int)std::floor(p_grid(i));
+        if (idx(i) < 0 || idx(i) + 1 >= resolution_) {
+            return false;
+        }
+    }
+    Eigen::Vector3d r = p_grid - idx.cast<double>();
+    double observed_weight = 0.0;
+    tsdf = 0.0;
+    if (color != nullptr) {
+        color->setZero();
+    }
+    for (int i = 0; i < 8; i++) {
+        const geometry::TSDFVoxel &voxel = voxels_[IndexOf(idx + shift[i])];
+        if (voxel.weight_ == 0.0f) {
+            continue;
+        }
+        double w = 1.0;
+        for (int j = 0; j < 3; j++) {
+            w *= shift[i](j) == 1 ? r(j) : 1.0 - r(j);
+        }
+        observed_weight += w;
+        tsdf += w * voxel.tsdf_;
+        if (color != nullptr) {
+            *color += w * voxel.color_;
+        }
+    }
+    // unobserved voxels are left out, as long as the observed ones carry
+    // most of the interpolation weight
+    if (observed_weight < 0.5) {
+        return false;
+    }
+    tsdf /= observed_weight;
+    if (color != nullptr) {
+        *color /= observed_weight;
+    }
+    return true;
+}
+
+double UniformTSDFVolume::GetRaycastSkipDistance(
+        const Eigen::Vector3d &p, const Eigen::Vector3d &direction) const {
+    // slab test of the ray against the bounding box of the volume
+    double enter = 0.0;
+    double leave = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; i++) {
+        double lower = origin_(i) - p(i);
+        double upper = origin_(i) + length_ - p(i);
+        if (direction(i) == 0.0) {
+            if (lower > 0.0 || upper < 0.0) {
+                return std::numeric_limits<double>::infinity();
+            }
+            continue;
+        }
+        double t0 = lower / direction(i);
+        double t1 = upper / direction(i);
+        if (t0 > t1) std::swap(t0, t1);
+        enter = std::max(enter, t0);
+        leave = std::min(leave, t1);
+    }
+    if (enter > leave) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return enter > 0.0 ? enter + 0.01 * voxel_length_ : 0.0;
+}
+
 }  // namespace integration
 }  // namespace open3d
@@ -103,6 +103,14 @@ public:
     /// Number of voxels present.
     int voxel_num_;
 
+protected:
+    bool GetObservedTSDFAt(const Eigen::Vector3d &p,
+                           double &tsdf,
+                           Eigen::Vector3d *color) const override;
+    double GetRaycastSkipDistance(
+            const Eigen::Vector3d &p,
+            const Eigen::Vector3d &direction) const override;
+
 private:
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
@@ -27,6 +27,7 @@
 #include "Open3D/Odometry/Odometry.h"
 
 #include <Eigen/Dense>
+#include <cmath>
 
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/RGBDImage.h"
@@ -246,14 +247,12 @@ Eigen::Matrix6d CreateInformationMatrix(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
+        const geometry::Image &xyz_t,
         const OdometryOption &option) {
     auto correspondence =
             ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
                                   extrinsic, depth_s, depth_t, option);
 
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
-
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
@@ -270,9 +269,9 @@ Eigen::Matrix6d CreateInformationMatrix(
         for (int row = 0; row < int(correspondence->size()); row++) {
             int u_t = (*correspondence)[row](2);
             int v_t = (*correspondence)[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
@@ -299,15 +298,12 @@ Eigen::Matrix6d CreateInformationMatrix(
     return GTG;
 }
 
-void NormalizeIntensity(geometry::Image &image_s,
-                        geometry::Image &image_t,
-                        CorrespondenceSetPixelWise &correspondence) {
-    if (image_s.width_ != image_t.width_ ||
-        image_s.height_ != image_t.height_) {
-        utility::LogError(
-                "[NormalizeIntensity] Size of two input images should be "
-                "same");
-    }
+/// Intensity scale factors that normalize the mean intensity of the source
+/// and target pixels in correspondence to 0.5.
+std::tuple<double, double> ComputeIntensityScales(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
+        const CorrespondenceSetPixelWise &correspondence) {
     double mean_s = 0.0, mean_t = 0.0;
     for (size_t row = 0; row < correspondence.size(); row++) {
         int u_s = correspondence[row](0);
@@ -319,8 +315,9 @@ void NormalizeIntensity(geometry::Image &image_s,
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
+    // depth-only frames have zero intensity, they are left as they are
+    return std::make_tuple(mean_s > 0.0 ? 0.5 / mean_s : 1.0,
+                           mean_t > 0.0 ? 0.5 / mean_t : 1.0);
 }
 
 inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
@@ -329,6 +326,15 @@ inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
             geometry::RGBDImage(color, depth));
 }
 
+/// The intensity normalization of an image pair is linear, it is applied to
+/// copies of the cached pyramid levels instead of recomputing the pyramids.
+inline std::shared_ptr<geometry::RGBDImage> PackScaledRGBDImage(
+        const geometry::RGBDImage &rgbd_image, double intensity_scale) {
+    auto rgbd_scaled = PackRGBDImage(rgbd_image.color_, rgbd_image.depth_);
+    rgbd_scaled->color_.LinearTransform(intensity_scale, 0.0);
+    return rgbd_scaled;
+}
+
 std::shared_ptr<geometry::Image> PreprocessDepth(
         const geometry::Image &depth_orig, const OdometryOption &option) {
     std::shared_ptr<geometry::Image> depth_processed =
@@ -341,6 +347,15 @@ std::shared_ptr<geometry::Image> PreprocessDepth(
                 *p = std::numeric_limits<float>::quiet_NaN();
         }
     }
+    // depth outside of the valid range is NaN and does not take part in the
+    // smoothing
+    if (option.depth_bilateral_sigma_space_ > 0.0) {
+        const int half_kernel_size =
+                (int)std::ceil(2.0 * option.depth_bilateral_sigma_space_);
+        return depth_processed->FilterBilateral(
+                half_kernel_size, option.depth_bilateral_sigma_space_,
+                option.depth_bilateral_sigma_depth_);
+    }
     return depth_processed;
 }
 
@@ -350,50 +365,30 @@ inline bool CheckImagePair(const geometry::Image &image_s,
             image_s.height_ == image_t.height_);
 }
 
-inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
-                               const geometry::RGBDImage &target) {
-    return (CheckImagePair(source.color_, target.color_) &&
-            CheckImagePair(source.depth_, target.depth_) &&
-            CheckImagePair(source.color_, source.depth_) &&
-            CheckImagePair(target.color_, target.depth_) &&
-            CheckImagePair(source.color_, target.color_) &&
-            source.color_.num_of_channels_ == 1 &&
-            source.depth_.num_of_channels_ == 1 &&
-            target.color_.num_of_channels_ == 1 &&
-            target.depth_.num_of_channels_ == 1 &&
-            source.color_.bytes_per_channel_ == 4 &&
-            target.color_.bytes_per_channel_ == 4 &&
-            source.depth_.bytes_per_channel_ == 4 &&
-            target.depth_.bytes_per_channel_ == 4);
+/// The color image may be empty for depth-only sensors.
+inline bool CheckRGBDImage(const geometry::RGBDImage &rgbd_image) {
+    return ((rgbd_image.color_.IsEmpty() ||
+             (CheckImagePair(rgbd_image.color_, rgbd_image.depth_) &&
+              rgbd_image.color_.num_of_channels_ == 1 &&
+              rgbd_image.color_.bytes_per_channel_ == 4)) &&
+            rgbd_image.depth_.num_of_channels_ == 1 &&
+            rgbd_image.depth_.bytes_per_channel_ == 4);
 }
 
-std::tuple<std::shared_ptr<geometry::RGBDImage>,
-           std::shared_ptr<geometry::RGBDImage>>
-InitializeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &odo_init,
-        const OdometryOption &option) {
-    auto source_gray =
-            source.color_.Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target.color_.Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-
-    auto correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, *correspondence);
+inline bool CheckOdometryFramePair(const OdometryFrame &source,
+                                   const OdometryFrame &target,
+                                   const OdometryOption &option) {
+    size_t num_levels = option.iteration_number_per_pyramid_level_.size();
+    return (!source.IsEmpty() && !target.IsEmpty() &&
+            CheckImagePair(source.image_.color_, target.image_.color_) &&
+            source.pyramid_.size() == num_levels &&
+            target.pyramid_.size() == num_levels);
+}
 
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
-    return std::make_tuple(source_out, target_out);
+inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
+                               const geometry::RGBDImage &target) {
+    return (CheckRGBDImage(source) && CheckRGBDImage(target) &&
+            CheckImagePair(source.depth_, target.depth_));
 }
 
 std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
@@ -442,51 +437,44 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const OdometryFrame &source,
+        const OdometryFrame &target,
+        double intensity_scale_s,
+        double intensity_scale_t,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
     std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
+            CreateCameraMatrixPyramid(source.intrinsic_,
                                       (int)iter_counts.size());
 
     for (int level = num_levels - 1; level >= 0; level--) {
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
 
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
+        const geometry::Image &source_xyz_level = *source.pyramid_xyz_[level];
+        auto source_level = PackScaledRGBDImage(*source.pyramid_[level],
+                                                intensity_scale_s);
+        auto target_level = PackScaledRGBDImage(*target.pyramid_[level],
+                                                intensity_scale_t);
+        auto target_dx_level = PackScaledRGBDImage(*target.pyramid_dx_[level],
+                                                   intensity_scale_t);
+        auto target_dy_level = PackScaledRGBDImage(*target.pyramid_dy_[level],
+                                                   intensity_scale_t);
 
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
                     iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
+                    source_xyz_level, *target_dx_level, *target_dy_level,
                     level_camera_matrix, result_odo, jacobian_method, option);
             result_odo = curr_odo * result_odo;
 
@@ -503,6 +491,51 @@ std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
 
 namespace odometry {
 
+OdometryFrame::OdometryFrame(
+        const geometry::RGBDImage &rgbd_image,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const OdometryOption &option /* = OdometryOption()*/)
+    : intrinsic_(pinhole_camera_intrinsic) {
+    if (!CheckRGBDImage(rgbd_image)) {
+        utility::LogError("[OdometryFrame] Unsupported image format.");
+    }
+    int num_levels = (int)option.iteration_number_per_pyramid_level_.size();
+
+    std::shared_ptr<geometry::Image> gray;
+    if (rgbd_image.color_.IsEmpty()) {
+        // depth-only frame, only depth terms of the Jacobian are meaningful
+        gray = std::make_shared<geometry::Image>();
+        gray->Prepare(rgbd_image.depth_.width_, rgbd_image.depth_.height_, 1,
+                      4);
+    } else {
+        gray = rgbd_image.color_.Filter(
+                geometry::Image::FilterType::Gaussian3);
+    }
+    auto depth = PreprocessDepth(rgbd_image.depth_, option)
+                         ->Filter(geometry::Image::FilterType::Gaussian3);
+    image_ = geometry::RGBDImage(*gray, *depth);
+
+    pyramid_ = image_.CreatePyramid(num_levels);
+    pyramid_dx_.resize(num_levels);
+    pyramid_dy_.resize(num_levels);
+    for (int level = 0; level < num_levels; level++) {
+        auto color_gradients = pyramid_[level]->color_.FilterSobel();
+        auto depth_gradients = pyramid_[level]->depth_.FilterSobel();
+        pyramid_dx_[level] = PackRGBDImage(*color_gradients.first,
+                                           *depth_gradients.first);
+        pyramid_dy_[level] = PackRGBDImage(*color_gradients.second,
+                                           *depth_gradients.second);
+    }
+
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(intrinsic_, num_levels);
+    pyramid_xyz_.resize(num_levels);
+    for (int level = 0; level < num_levels; level++) {
+        pyramid_xyz_[level] = ConvertDepthImageToXYZImage(
+                pyramid_[level]->depth_, pyramid_camera_matrix[level]);
+    }
+}
+
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
@@ -519,21 +552,46 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                                Eigen::Matrix6d::Zero());
     }
 
-    std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
-    std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
+    OdometryFrame source_frame(source, pinhole_camera_intrinsic, option);
+    OdometryFrame target_frame(target, pinhole_camera_intrinsic, option);
+    return ComputeRGBDOdometry(source_frame, target_frame, odo_init,
+                               jacobian_method, option);
+}
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        const OdometryFrame &source,
+        const OdometryFrame &target,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/,
+        const OdometryOption &option /*= OdometryOption()*/) {
+    if (!CheckOdometryFramePair(source, target, option)) {
+        utility::LogWarning(
+                "[RGBDOdometry] Two frames should be same in size and have "
+                "as many pyramid levels as the option.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    auto correspondence = ComputeCorrespondence(
+            source.intrinsic_.intrinsic_matrix_, odo_init,
+            source.image_.depth_, target.image_.depth_, option);
+    double intensity_scale_s, intensity_scale_t;
+    std::tie(intensity_scale_s, intensity_scale_t) = ComputeIntensityScales(
+            source.image_.color_, target.image_.color_, *correspondence);
 
     Eigen::Matrix4d extrinsic;
     bool is_success;
-    std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+    std::tie(is_success, extrinsic) =
+            ComputeMultiscale(source, target, intensity_scale_s,
+                              intensity_scale_t, odo_init, jacobian_method,
+                              option);
 
     if (is_success) {
         Eigen::Matrix4d trans_output = extrinsic;
         Eigen::MatrixXd info_output = CreateInformationMatrix(
-                extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
+                extrinsic, source.intrinsic_, source.image_.depth_,
+                target.image_.depth_, *target.pyramid_xyz_[0], option);
         return std::make_tuple(true, trans_output, info_output);
     } else {
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
@@ -541,5 +599,22 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RGBDOdometryTracker::Track(
+        const geometry::RGBDImage &rgbd_image,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/) {
+    auto frame = std::make_shared<OdometryFrame>(rgbd_image, intrinsic_,
+                                                 option_);
+    std::shared_ptr<OdometryFrame> previous_frame = previous_frame_;
+    previous_frame_ = frame;
+    if (!previous_frame) {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+    return ComputeRGBDOdometry(*previous_frame, *frame, odo_init,
+                               jacobian_method, option_);
+}
+
 }  // namespace odometry
 }  // namespace open3d
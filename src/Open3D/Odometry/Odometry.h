@@ -28,22 +28,65 @@
 
 #include <Eigen/Core>
 #include <iostream>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/OdometryOption.h"
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
 
 namespace open3d {
+namespace odometry {
 
-namespace geometry {
-class RGBDImage;
-}
+/// \class OdometryFrame
+///
+/// \brief RGBD image preprocessed for odometry.
+///
+/// Holds everything ComputeRGBDOdometry derives from a single RGBD image, so
+/// that a frame can be reused as target and as source of consecutive image
+/// pairs. A frame is only valid for odometry with the intrinsic and option
+/// it was created with.
+class OdometryFrame {
+public:
+    /// \brief Default Constructor.
+    OdometryFrame() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param rgbd_image RGBD image with float intensity and float depth.
+    /// The intensity may be empty for depth-only sensors, it is zero then and
+    /// only Jacobians that do not use color, like
+    /// RGBDOdometryJacobianFromPointToPlaneTerm, are meaningful.
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameters, defines the depth range and
+    /// the number of pyramid levels.
+    OdometryFrame(
+            const geometry::RGBDImage &rgbd_image,
+            const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+            const OdometryOption &option = OdometryOption());
+    ~OdometryFrame() {}
 
-namespace odometry {
+public:
+    bool IsEmpty() const { return pyramid_.empty(); }
+
+public:
+    /// Camera intrinsic parameters of the frame.
+    camera::PinholeCameraIntrinsic intrinsic_;
+    /// Gaussian filtered intensity and depth, depth values outside of the
+    /// valid range are set to NaN.
+    geometry::RGBDImage image_;
+    /// Pyramid of image_, the first level has the original resolution.
+    geometry::RGBDImagePyramid pyramid_;
+    /// Sobel x-gradient of each pyramid level.
+    geometry::RGBDImagePyramid pyramid_dx_;
+    /// Sobel y-gradient of each pyramid level.
+    geometry::RGBDImagePyramid pyramid_dy_;
+    /// Back-projected depth (3 float channels) of each pyramid level.
+    std::vector<std::shared_ptr<geometry::Image>> pyramid_xyz_;
+};
 
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
 ///
@@ -64,5 +107,68 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \brief Function to estimate 6D rigid motion from two preprocessed frames.
+///
+/// \param source Source frame.
+/// \param target Target frame.
+/// \param odo_init Initial 4x4 motion matrix estimation.
+/// \param jacobian_method The odometry Jacobian method to use.
+/// \param option Odometry hyper parameteres, both frames have to be created
+/// with this option.
+/// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        const OdometryFrame &source,
+        const OdometryFrame &target,
+        const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+        const RGBDOdometryJacobian &jacobian_method =
+                RGBDOdometryJacobianFromHybridTerm(),
+        const OdometryOption &option = OdometryOption());
+
+/// \class RGBDOdometryTracker
+///
+/// \brief Frame-to-frame odometry for a sequence of RGBD images.
+///
+/// Keeps the preprocessed previous frame, so every image of the sequence is
+/// preprocessed only once.
+class RGBDOdometryTracker {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameteres.
+    RGBDOdometryTracker(const camera::PinholeCameraIntrinsic
+                                &pinhole_camera_intrinsic =
+                                        camera::PinholeCameraIntrinsic(),
+                        const OdometryOption &option = OdometryOption())
+        : intrinsic_(pinhole_camera_intrinsic), option_(option) {}
+    ~RGBDOdometryTracker() {}
+
+public:
+    /// \brief Estimates the motion from the previous image to \p rgbd_image.
+    ///
+    /// The first image only initializes the tracker and returns false.
+    /// \param rgbd_image Next RGBD image of the sequence.
+    /// \param odo_init Initial 4x4 motion matrix estimation.
+    /// \param jacobian_method The odometry Jacobian method to use.
+    /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> Track(
+            const geometry::RGBDImage &rgbd_image,
+            const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+            const RGBDOdometryJacobian &jacobian_method =
+                    RGBDOdometryJacobianFromHybridTerm());
+    /// Forgets the previous frame, the next image starts a new sequence.
+    void Reset() { previous_frame_.reset(); }
+    bool HasPreviousFrame() const { return bool(previous_frame_); }
+    const camera::PinholeCameraIntrinsic &GetIntrinsic() const {
+        return intrinsic_;
+    }
+    const OdometryOption &GetOption() const { return option_; }
+
+private:
+    camera::PinholeCameraIntrinsic intrinsic_;
+    OdometryOption option_;
+    std::shared_ptr<OdometryFrame> previous_frame_;
+};
+
 }  // namespace odometry
 }  // namespace open3d
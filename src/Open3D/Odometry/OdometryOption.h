@@ -46,18 +46,26 @@ public:
     /// are ignored.
     /// \param max_depth Maximum depth above which pixel values are
     /// ignored.
+    /// \param depth_bilateral_sigma_space Spatial standard deviation in
+    /// pixels of the bilateral depth filter, 0 disables the filter.
+    /// \param depth_bilateral_sigma_depth Depth standard deviation of the
+    /// bilateral depth filter.
     OdometryOption(
             const std::vector<int> &iteration_number_per_pyramid_level =
                     {20, 10,
                      5} /* {smaller image size to original image size} */,
             double max_depth_diff = 0.03,
             double min_depth = 0.0,
-            double max_depth = 4.0)
+            double max_depth = 4.0,
+            double depth_bilateral_sigma_space = 0.0,
+            double depth_bilateral_sigma_depth = 0.03)
         : iteration_number_per_pyramid_level_(
                   iteration_number_per_pyramid_level),
           max_depth_diff_(max_depth_diff),
           min_depth_(min_depth),
-          max_depth_(max_depth) {}
+          max_depth_(max_depth),
+          depth_bilateral_sigma_space_(depth_bilateral_sigma_space),
+          depth_bilateral_sigma_depth_(depth_bilateral_sigma_depth) {}
     ~OdometryOption() {}
 
 public:
@@ -73,6 +81,12 @@ public:
     double min_depth_;
     /// Pixels that has larger than specified depth values are ignored.
     double max_depth_;
+    /// Spatial standard deviation in pixels of the bilateral filter applied
+    /// to the depth image while preprocessing a frame. The filter is
+    /// disabled if the value is not positive.
+    double depth_bilateral_sigma_space_;
+    /// Depth standard deviation of the bilateral depth filter.
+    double depth_bilateral_sigma_depth_;
 };
 
 }  // namespace odometry
@@ -26,6 +26,8 @@
 
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 
+#include <Eigen/Geometry>
+
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/Odometry.h"
@@ -153,5 +155,58 @@ void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
     r[1] = r_geo;
 }
 
+void RGBDOdometryJacobianFromPointToPlaneTerm::ComputeJacobianAndResidual(
+        int row,
+        std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+        std::vector<double> &r,
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const geometry::Image &source_xyz,
+        const geometry::RGBDImage &target_dx,
+        const geometry::RGBDImage &target_dy,
+        const Eigen::Matrix3d &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const CorrespondenceSetPixelWise &corresps) const {
+    const double fx = intrinsic(0, 0);
+    const double fy = intrinsic(1, 1);
+    Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
+    Eigen::Vector3d t = extrinsic.block<3, 1>(0, 3);
+
+    int u_s = corresps[row](0);
+    int v_s = corresps[row](1);
+    int u_t = corresps[row](2);
+    int v_t = corresps[row](3);
+    double d_t = *target.depth_.PointerAt<float>(u_t, v_t);
+    double dDdx = SOBEL_SCALE * (*target_dx.depth_.PointerAt<float>(u_t, v_t));
+    double dDdy = SOBEL_SCALE * (*target_dy.depth_.PointerAt<float>(u_t, v_t));
+
+    // the target vertex q = d_t * ray and its tangents along u and v, the
+    // gradients are NaN next to missing depth, where the normal is unknown
+    Eigen::Vector3d ray((u_t - intrinsic(0, 2)) / fx,
+                        (v_t - intrinsic(1, 2)) / fy, 1.0);
+    Eigen::Vector3d q = d_t * ray;
+    Eigen::Vector3d tangent_u = dDdx * ray + Eigen::Vector3d(d_t / fx, 0, 0);
+    Eigen::Vector3d tangent_v = dDdy * ray + Eigen::Vector3d(0, d_t / fy, 0);
+    Eigen::Vector3d normal = tangent_u.cross(tangent_v);
+    double norm = normal.norm();
+    if (std::isnan(norm) || norm == 0.0) {
+        J_r.clear();
+        r.clear();
+        return;
+    }
+    normal /= norm;
+
+    Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
+                            *source_xyz.PointerAt<float>(u_s, v_s, 1),
+                            *source_xyz.PointerAt<float>(u_s, v_s, 2));
+    Eigen::Vector3d p3d_trans = R * p3d_mat + t;
+
+    J_r.resize(1);
+    J_r[0].head<3>() = p3d_trans.cross(normal);
+    J_r[0].tail<3>() = normal;
+    r.resize(1);
+    r[0] = normal.dot(p3d_trans - q);
+}
+
 }  // namespace odometry
 }  // namespace open3d
@@ -138,5 +138,40 @@ public:
             const CorrespondenceSetPixelWise &corresps) const override;
 };
 
+/// \class RGBDOdometryJacobianFromPointToPlaneTerm
+///
+/// \brief Class to compute Jacobian using point-to-plane term of projective
+/// data association. Only depth is used, which suits depth-only sensors.
+///
+/// Energy: (n_q^T (T p - q))^2, where p is the source point, q is the
+/// target point its projection falls on and n_q is the target normal. The
+/// target vertices and normals are computed from the target depth and its
+/// Sobel gradients at every pyramid level.
+/// reference:
+/// R. A. Newcombe, S. Izadi, O. Hilliges, D. Molyneaux, D. Kim, A. J. Davison,
+/// P. Kohli, J. Shotton, S. Hodges and A. Fitzgibbon.
+/// KinectFusion: Real-time dense surface mapping and tracking.
+/// In ISMAR, 2011.
+class RGBDOdometryJacobianFromPointToPlaneTerm : public RGBDOdometryJacobian {
+public:
+    /// \brief Default Constructor.
+    RGBDOdometryJacobianFromPointToPlaneTerm() {}
+    ~RGBDOdometryJacobianFromPointToPlaneTerm() override {}
+
+public:
+    void ComputeJacobianAndResidual(
+            int row,
+            std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+            std::vector<double> &r,
+            const geometry::RGBDImage &source,
+            const geometry::RGBDImage &target,
+            const geometry::Image &source_xyz,
+            const geometry::RGBDImage &target_dx,
+            const geometry::RGBDImage &target_dy,
+            const Eigen::Matrix3d &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const CorrespondenceSetPixelWise &corresps) const override;
+};
+
 }  // namespace odometry
 }  // namespace open3d
@@ -285,6 +285,15 @@ public:
         return *this;
     }
 
+    /// Advances the progress bar by \p count steps at once.
+    ConsoleProgressBar &operator+=(size_t count) {
+        if (count == 0) {
+            return *this;
+        }
+        current_count_ += count - 1;
+        return operator++();
+    }
+
 private:
     const size_t resolution_ = 40;
     size_t expected_count_;
@@ -38,7 +38,9 @@
 #endif
 #else
 #include <dirent.h>
+#include <fcntl.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -217,6 +219,97 @@ FILE *FOpen(const std::string &filename, const std::string &mode) {
     return fp;
 }
 
+MappedFile::MappedFile() : is_mapped_(false), data_(nullptr), size_(0) {}
+
+MappedFile::~MappedFile() { Unmap(); }
+
+bool MappedFile::Map(const std::string &filename) {
+    Unmap();
+#ifdef _WIN32
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(
+            CP_UTF8, 0, filename.c_str(), filename.length(),
+            const_cast<wchar_t *>(filename_w.c_str()), filename.length());
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = NULL;
+    void *data = nullptr;
+    if (size.QuadPart > 0) {
+        mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        data = mapping != NULL ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+                               : NULL;
+        if (data == NULL) {
+            if (mapping != NULL) {
+                CloseHandle(mapping);
+            }
+            CloseHandle(file);
+            return false;
+        }
+    }
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+    data_ = data;
+    size_ = uint64_t(size.QuadPart);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return false;
+    }
+    void *data = nullptr;
+    if (file_stat.st_size > 0) {
+        data = mmap(NULL, size_t(file_stat.st_size), PROT_READ, MAP_SHARED,
+                    fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        // files are mostly scanned front to back, let the kernel read ahead
+        madvise(data, size_t(file_stat.st_size), MADV_SEQUENTIAL);
+    }
+    close(fd);
+    data_ = data;
+    size_ = uint64_t(file_stat.st_size);
+#endif
+    is_mapped_ = true;
+    return true;
+}
+
+void MappedFile::Unmap() {
+    if (!is_mapped_) {
+        return;
+    }
+#ifdef _WIN32
+    if (data_ != nullptr) {
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_handle_);
+    }
+    CloseHandle(file_handle_);
+#else
+    if (data_ != nullptr) {
+        munmap(data_, size_t(size_));
+    }
+#endif
+    is_mapped_ = false;
+    data_ = nullptr;
+    size_ = 0;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -69,6 +70,37 @@ bool ListFilesInDirectoryWithExtension(const std::string &directory,
 // wrapper for fopen that enables unicode paths on Windows
 FILE *FOpen(const std::string &filename, const std::string &mode);
 
+/// \class MappedFile
+///
+/// \brief Read-only memory mapping of a whole file.
+///
+/// The pages are read by the operating system on first access, so that
+/// large files can be scanned without reading them into buffers first.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+    /// Map \p filename, empty files are mapped with a null data pointer.
+    bool Map(const std::string &filename);
+    void Unmap();
+    bool IsMapped() const { return is_mapped_; }
+    const char *GetData() const { return static_cast<const char *>(data_); }
+    uint64_t GetSize() const { return size_; }
+
+private:
+    bool is_mapped_;
+    void *data_;
+    uint64_t size_;
+#ifdef _WIN32
+    void *file_handle_;
+    void *mapping_handle_;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
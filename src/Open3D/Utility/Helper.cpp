@@ -26,7 +26,12 @@
 
 #include "Open3D/Utility/Helper.h"
 
+#include <algorithm>
 #include <cctype>
+#include <clocale>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <random>
 #include <unordered_set>
 
@@ -90,6 +95,158 @@ size_t WordLength(const std::string& doc,
     return length;
 }
 
+namespace {
+
+inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' ||
+           c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Parses the token starting at first, returns begin on failure. std::strtod
+// expects the decimal point of the current C locale, so the decimal point of
+// the token is replaced by it.
+const char* ParseNumberWithStrtod(const char* begin,
+                                  const char* first,
+                                  const char* end,
+                                  double& value) {
+    const char* token_end = first;
+    while (token_end != end && !IsSpace(*token_end)) {
+        token_end++;
+    }
+    const char* decimal_point = std::localeconv()->decimal_point;
+    const size_t decimal_point_size = std::strlen(decimal_point);
+    const size_t token_size = size_t(token_end - first);
+    // tokens almost always fit the buffer on the stack
+    char stack_buffer[64];
+    std::vector<char> heap_buffer;
+    char* buffer = stack_buffer;
+    if (token_size + decimal_point_size + 1 > sizeof(stack_buffer)) {
+        heap_buffer.resize(token_size + decimal_point_size + 1);
+        buffer = heap_buffer.data();
+    }
+    const char* dot = std::find(first, token_end, '.');
+    size_t size = size_t(dot - first);
+    std::memcpy(buffer, first, size);
+    if (dot != token_end) {
+        std::memcpy(buffer + size, decimal_point, decimal_point_size);
+        size += decimal_point_size;
+        std::memcpy(buffer + size, dot + 1, size_t(token_end - dot - 1));
+        size += size_t(token_end - dot - 1);
+    }
+    buffer[size] = '\0';
+    char* parse_end;
+    double parsed = std::strtod(buffer, &parse_end);
+    if (parse_end == buffer) {
+        return begin;
+    }
+    value = parsed;
+    size_t parsed_size = size_t(parse_end - buffer);
+    if (dot != token_end && parsed_size > size_t(dot - first)) {
+        parsed_size -= decimal_point_size - 1;
+    }
+    return first + parsed_size;
+}
+
+}  // unnamed namespace
+
+const char* ParseNumber(const char* begin, const char* end, double& value) {
+    // powers of ten that are exactly representable as double
+    static const double kPowersOfTen[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char* first = begin;
+    while (first != end && IsSpace(*first)) {
+        first++;
+    }
+    const char* p = first;
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    while (p != end && IsDigit(*p)) {
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + uint64_t(*p - '0');
+            num_digits += mantissa > 0 ? 1 : 0;
+        } else {
+            exponent++;
+        }
+        has_digits = true;
+        p++;
+    }
+    if (p != end && *p == '.') {
+        p++;
+        while (p != end && IsDigit(*p)) {
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + uint64_t(*p - '0');
+                num_digits += mantissa > 0 ? 1 : 0;
+                exponent--;
+            }
+            has_digits = true;
+            p++;
+        }
+    }
+    if (!has_digits || (p != end && (*p == 'x' || *p == 'X'))) {
+        // nan, inf and hexadecimal numbers
+        return ParseNumberWithStrtod(begin, first, end, value);
+    }
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool negative_exponent = false;
+        if (q != end && (*q == '-' || *q == '+')) {
+            negative_exponent = *q == '-';
+            q++;
+        }
+        if (q != end && IsDigit(*q)) {
+            int e = 0;
+            while (q != end && IsDigit(*q)) {
+                if (e < 100000) {
+                    e = e * 10 + (*q - '0');
+                }
+                q++;
+            }
+            exponent += negative_exponent ? -e : e;
+            p = q;
+        }
+    }
+    if (num_digits >= 19 || mantissa > (uint64_t(1) << 53) ||
+        exponent < -22 || exponent > 22) {
+        // the fast path below would round twice
+        return ParseNumberWithStrtod(begin, first, end, value);
+    }
+    double result = double(mantissa);
+    if (exponent < 0) {
+        result /= kPowersOfTen[-exponent];
+    } else {
+        result *= kPowersOfTen[exponent];
+    }
+    value = negative ? -result : result;
+    return p;
+}
+
+size_t ParseNumbers(const char* begin,
+                    const char* end,
+                    double* values,
+                    size_t max_count) {
+    size_t count = 0;
+    while (count < max_count) {
+        const char* next = ParseNumber(begin, end, values[count]);
+        if (next == begin) {
+            break;
+        }
+        begin = next;
+        count++;
+    }
+    return count;
+}
+
 void Sleep(int milliseconds) {
 #ifdef _WIN32
     Sleep(milliseconds);
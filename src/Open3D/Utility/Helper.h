@@ -126,6 +126,25 @@ std::string& RightStripString(std::string& str,
 std::string& StripString(std::string& str,
                          const std::string& chars = "\t\n\v\f\r ");
 
+/// \brief Parse a floating point number from [begin, end).
+///
+/// Leading white spaces are skipped. Unlike std::strtod, the decimal point is
+/// always '.' regardless of the locale, and the range does not have to be
+/// null terminated. Numbers whose decimal digits form an integer of at most
+/// 2^53 and whose decimal exponent is at most 22 in magnitude are converted
+/// without calling into the C library, the result is correctly rounded in
+/// all cases.
+/// \return The position after the number, or \p begin if no number was found.
+const char* ParseNumber(const char* begin, const char* end, double& value);
+
+/// Parse up to \p max_count white space separated numbers from [begin, end)
+/// into \p values, similar to sscanf with "%lf %lf ...".
+/// \return The number of parsed values.
+size_t ParseNumbers(const char* begin,
+                    const char* end,
+                    double* values,
+                    size_t max_count);
+
 void Sleep(int milliseconds);
 
 /// Thread-safe function returning a pseudo-random integer.
@@ -0,0 +1,314 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+/// Returns the maximum number of threads used by an OpenMP parallel region,
+/// or 1 if Open3D is compiled without OpenMP.
+inline int GetMaxThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+/// Sorts the elements in the range [first, last) in parallel. The range is
+/// split into one block per thread, the blocks are sorted concurrently with
+/// std::sort and then merged pairwise. Like std::sort, the order of equal
+/// elements is not preserved.
+template <typename RandomIt, typename Compare>
+void ParallelSort(RandomIt first, RandomIt last, Compare comp) {
+    typedef typename std::iterator_traits<RandomIt>::difference_type diff_t;
+    // Blocks smaller than this are not worth the merge overhead.
+    const diff_t min_block_size = 1 << 14;
+    diff_t n = last - first;
+    int n_blocks = int(std::min<diff_t>(GetMaxThreads(), n / min_block_size));
+    if (n_blocks <= 1) {
+        std::sort(first, last, comp);
+        return;
+    }
+    std::vector<diff_t> bounds(n_blocks + 1);
+    for (int b = 0; b <= n_blocks; ++b) {
+        bounds[b] = n / n_blocks * b + std::min<diff_t>(b, n % n_blocks);
+    }
+#pragma omp parallel for schedule(static)
+    for (int b = 0; b < n_blocks; ++b) {
+        std::sort(first + bounds[b], first + bounds[b + 1], comp);
+    }
+    for (int width = 1; width < n_blocks; width *= 2) {
+#pragma omp parallel for schedule(static)
+        for (int b = 0; b < n_blocks; b += 2 * width) {
+            int mid = std::min(b + width, n_blocks);
+            int end = std::min(b + 2 * width, n_blocks);
+            std::inplace_merge(first + bounds[b], first + bounds[mid],
+                               first + bounds[end], comp);
+        }
+    }
+}
+
+template <typename RandomIt>
+void ParallelSort(RandomIt first, RandomIt last) {
+    typedef typename std::iterator_traits<RandomIt>::value_type value_t;
+    ParallelSort(first, last, std::less<value_t>());
+}
+
+/// \class PrefetchQueue
+///
+/// \brief Loads the items [first, num_items) on a pool of worker threads
+/// ahead of the consumer and hands them out in order.
+///
+/// Workers wait while \p window loaded items are waiting to be taken, so
+/// that memory stays bounded. Exceptions thrown by the load function are
+/// rethrown by Pop() for the item that failed. Destroying the queue stops
+/// the workers, items still loading are finished and dropped.
+template <typename T>
+class PrefetchQueue {
+public:
+    typedef std::function<T(size_t)> LoadFunction;
+
+    /// \param num_threads Number of worker threads, the number of hardware
+    /// threads if not positive.
+    PrefetchQueue(size_t first,
+                  size_t num_items,
+                  const LoadFunction &load,
+                  int num_threads,
+                  size_t window)
+        : num_items_(num_items),
+          window_(std::max(window, size_t(1))),
+          load_(load),
+          next_pop_(first),
+          next_load_(first),
+          stop_(false) {
+        if (num_threads <= 0) {
+            num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+        }
+        for (int i = 0; i < num_threads; i++) {
+            workers_.push_back(std::thread(&PrefetchQueue::Work, this));
+        }
+    }
+    ~PrefetchQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+    PrefetchQueue(const PrefetchQueue &) = delete;
+    PrefetchQueue &operator=(const PrefetchQueue &) = delete;
+
+public:
+    /// Index of the item the next Pop() returns.
+    size_t GetNextIndex() const { return next_pop_; }
+    /// Check if all items have been taken.
+    bool IsEmpty() const { return next_pop_ >= num_items_; }
+    /// Blocks until the next item is loaded and returns it. Must not be
+    /// called when the queue is empty.
+    T Pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return loaded_.count(next_pop_) > 0; });
+        auto itr = loaded_.find(next_pop_);
+        T item = std::move(itr->second.first);
+        std::exception_ptr error = itr->second.second;
+        loaded_.erase(itr);
+        next_pop_++;
+        lock.unlock();
+        cv_.notify_all();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return item;
+    }
+
+private:
+    void Work() {
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] {
+                    return stop_ || (next_load_ < num_items_ &&
+                                     next_load_ < next_pop_ + window_);
+                });
+                if (stop_) {
+                    return;
+                }
+                index = next_load_++;
+            }
+            T item = T();
+            std::exception_ptr error;
+            try {
+                item = load_(index);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                loaded_[index] = std::make_pair(std::move(item), error);
+            }
+            cv_.notify_all();
+        }
+    }
+
+private:
+    const size_t num_items_;
+    const size_t window_;
+    LoadFunction load_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<size_t, std::pair<T, std::exception_ptr>> loaded_;
+    size_t next_pop_;
+    size_t next_load_;
+    bool stop_;
+};
+
+/// \class TaskQueue
+///
+/// \brief Runs tasks on a pool of worker threads in the order they are
+/// pushed.
+///
+/// Push() blocks the caller while \p max_queue_size tasks are waiting to be
+/// started, so that a slow consumer throttles the producer instead of
+/// piling up work. Exceptions thrown by a task are stored in its future.
+/// Destroying the queue finishes all tasks that have been pushed.
+class TaskQueue {
+public:
+    /// \param num_threads Number of worker threads, the number of hardware
+    /// threads if not positive.
+    TaskQueue(int num_threads, size_t max_queue_size)
+        : max_queue_size_(std::max(max_queue_size, size_t(1))),
+          num_running_(0),
+          stop_(false) {
+        if (num_threads <= 0) {
+            num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+        }
+        for (int i = 0; i < num_threads; i++) {
+            workers_.push_back(std::thread(&TaskQueue::Work, this));
+        }
+    }
+    ~TaskQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+    TaskQueue(const TaskQueue &) = delete;
+    TaskQueue &operator=(const TaskQueue &) = delete;
+
+public:
+    /// Queues \p task and returns a future for its result. Must not be
+    /// called from a task of the same queue.
+    template <typename F>
+    std::future<typename std::result_of<F()>::type> Push(F task) {
+        typedef typename std::result_of<F()>::type R;
+        auto packaged = std::make_shared<std::packaged_task<R()>>(task);
+        std::future<R> result = packaged->get_future();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock,
+                     [this] { return tasks_.size() < max_queue_size_; });
+            tasks_.push_back([packaged] { (*packaged)(); });
+        }
+        cv_.notify_all();
+        return result;
+    }
+    /// Blocks until all pushed tasks are finished.
+    void Wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock,
+                 [this] { return tasks_.empty() && num_running_ == 0; });
+    }
+    /// Number of tasks that are waiting or running.
+    size_t GetNumPending() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return tasks_.size() + num_running_;
+    }
+
+private:
+    void Work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+                num_running_++;
+            }
+            cv_.notify_all();
+            task();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                num_running_--;
+            }
+            cv_.notify_all();
+        }
+    }
+
+private:
+    const size_t max_queue_size_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    size_t num_running_;
+    bool stop_;
+};
+
+}  // namespace utility
+}  // namespace open3d
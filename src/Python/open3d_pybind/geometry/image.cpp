@@ -47,9 +47,18 @@ static const std::unordered_map<std::string, std::string>
                  "0. The depth values will first be scaled and then "
                  "truncated."},
                 {"filter_type", "The filter type to be applied."},
+                {"guide",
+                 "Color or intensity image of the same size that guides the "
+                 "filter."},
+                {"half_kernel_size", "Radius of the filter window."},
                 {"image", "The Image object."},
                 {"image_pyramid", "The ImagePyramid object"},
                 {"num_of_levels ", "Levels of the image pyramid"},
+                {"sigma_color",
+                 "Standard deviation of the intensity weight."},
+                {"sigma_depth", "Standard deviation of the depth weight."},
+                {"sigma_space",
+                 "Standard deviation of the spatial weight in pixels."},
                 {"with_gaussian_filter",
                  "When ``True``, image in the pyramid will first be filtered "
                  "by a 3x3 Gaussian kernel before downsampling."}};
@@ -177,6 +186,36 @@ void pybind_image(py::module &m) {
                      }
                  },
                  "Function to filter Image", "filter_type"_a)
+            .def("filter_sobel",
+                 [](const geometry::Image &input) {
+                     std::pair<std::shared_ptr<geometry::Image>,
+                               std::shared_ptr<geometry::Image>>
+                             output;
+                     if (input.num_of_channels_ != 1 ||
+                         input.bytes_per_channel_ != 4) {
+                         output = input.CreateFloatImage()->FilterSobel();
+                     } else {
+                         output = input.FilterSobel();
+                     }
+                     return std::make_tuple(*output.first, *output.second);
+                 },
+                 "Function to compute the Sobel x- and y-gradient images in "
+                 "a single pass. Output: (dx, dy).")
+            .def("filter_bilateral", &geometry::Image::FilterBilateral,
+                 "Function to filter a float depth image with a bilateral "
+                 "filter. Invalid depth (<= 0 or NaN) is kept.",
+                 "half_kernel_size"_a, "sigma_space"_a, "sigma_depth"_a)
+            .def("filter_joint_bilateral",
+                 &geometry::Image::FilterJointBilateral,
+                 "Function to filter a float depth image with a bilateral "
+                 "filter guided by a color image. Invalid depth is filled "
+                 "from valid neighbors.",
+                 "guide"_a, "half_kernel_size"_a, "sigma_space"_a,
+                 "sigma_color"_a)
+            .def("filter_median", &geometry::Image::FilterMedian,
+                 "Function to filter a float depth image with a median "
+                 "filter over the valid neighbors.",
+                 "half_kernel_size"_a = 1)
             .def("flip_vertical", &geometry::Image::FlipVertical,
                  "Function to flip image vertically (upside down)")
             .def("flip_horizontal", &geometry::Image::FlipHorizontal,
@@ -210,6 +249,12 @@ void pybind_image(py::module &m) {
 
     docstring::ClassMethodDocInject(m, "Image", "filter",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Image", "filter_bilateral",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Image", "filter_joint_bilateral",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "Image", "filter_median",
+                                    map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "Image", "create_pyramid",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "Image", "filter_pyramid",
@@ -178,7 +178,12 @@ void pybind_pointcloud(py::module &m) {
                  "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
             .def_static(
                     "create_from_depth_image",
-                    &geometry::PointCloud::CreateFromDepthImage,
+                    static_cast<std::shared_ptr<geometry::PointCloud> (*)(
+                            const geometry::Image &,
+                            const camera::PinholeCameraIntrinsic &,
+                            const Eigen::Matrix4d &, double, double, int,
+                            bool)>(
+                            &geometry::PointCloud::CreateFromDepthImage),
                     R"(Factory function to create a pointcloud from a depth image and a
         camera. Given depth value d at (u, v) image coordinate, the corresponding 3d
         point is:
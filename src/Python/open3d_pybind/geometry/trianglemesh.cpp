@@ -102,6 +102,11 @@ void pybind_trianglemesh(py::module &m) {
                  "that references a single vertex multiple times in a single "
                  "triangle. They are usually the product of removing "
                  "duplicated vertices.")
+            .def("clean_mesh", &geometry::TriangleMesh::CleanMesh,
+                 "Function that removes duplicated vertices, degenerate "
+                 "triangles, duplicated triangles and unreferenced vertices "
+                 "with a single final remap of the vertex and triangle "
+                 "indices.")
             .def("remove_non_manifold_edges",
                  &geometry::TriangleMesh::RemoveNonManifoldEdges,
                  "Function that removes all non-manifold edges, by "
@@ -156,6 +161,34 @@ void pybind_trianglemesh(py::module &m) {
                  "shrinkage of the triangle mesh.",
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5, "mu"_a = -0.53,
                  "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+            .def("filter_sharpen_in_place",
+                 &geometry::TriangleMesh::FilterSharpenInPlace,
+                 "In-place version of filter_sharpen that optionally only "
+                 "filters the given vertices.",
+                 "number_of_iterations"_a = 1, "strength"_a = 1,
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "vertex_indices"_a = std::vector<size_t>())
+            .def("filter_smooth_simple_in_place",
+                 &geometry::TriangleMesh::FilterSmoothSimpleInPlace,
+                 "In-place version of filter_smooth_simple that optionally "
+                 "only filters the given vertices.",
+                 "number_of_iterations"_a = 1,
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "vertex_indices"_a = std::vector<size_t>())
+            .def("filter_smooth_laplacian_in_place",
+                 &geometry::TriangleMesh::FilterSmoothLaplacianInPlace,
+                 "In-place version of filter_smooth_laplacian that optionally "
+                 "only filters the given vertices.",
+                 "number_of_iterations"_a = 1, "lambda"_a = 0.5,
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "vertex_indices"_a = std::vector<size_t>())
+            .def("filter_smooth_taubin_in_place",
+                 &geometry::TriangleMesh::FilterSmoothTaubinInPlace,
+                 "In-place version of filter_smooth_taubin that optionally "
+                 "only filters the given vertices.",
+                 "number_of_iterations"_a = 1, "lambda"_a = 0.5, "mu"_a = -0.53,
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All,
+                 "vertex_indices"_a = std::vector<size_t>())
             .def("has_vertices", &geometry::TriangleMesh::HasVertices,
                  "Returns ``True`` if the mesh contains vertices.")
             .def("has_triangles", &geometry::TriangleMesh::HasTriangles,
@@ -248,7 +281,8 @@ void pybind_trianglemesh(py::module &m) {
             .def("sample_points_uniformly",
                  &geometry::TriangleMesh::SamplePointsUniformly,
                  "Function to uniformly sample points from the mesh.",
-                 "number_of_points"_a = 100, "use_triangle_normal"_a = false)
+                 "number_of_points"_a = 100, "use_triangle_normal"_a = false,
+                 "seed"_a = -1)
             .def("sample_points_poisson_disk",
                  &geometry::TriangleMesh::SamplePointsPoissonDisk,
                  "Function to sample points from the mesh, where each point "
@@ -258,7 +292,7 @@ void pybind_trianglemesh(py::module &m) {
                  "noise). Method is based on Yuksel, \"Sample Elimination for "
                  "Generating Poisson Disk Sample Sets\", EUROGRAPHICS, 2015.",
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
-                 "use_triangle_normal"_a = false)
+                 "use_triangle_normal"_a = false, "seed"_a = -1)
             .def("subdivide_midpoint",
                  &geometry::TriangleMesh::SubdivideMidpoint,
                  "Function subdivide mesh using midpoint algorithm.",
@@ -527,6 +561,7 @@ void pybind_trianglemesh(py::module &m) {
                                     "remove_unreferenced_vertices");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "remove_degenerate_triangles");
+    docstring::ClassMethodDocInject(m, "TriangleMesh", "clean_mesh");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "remove_non_manifold_edges");
     docstring::ClassMethodDocInject(
@@ -557,6 +592,38 @@ void pybind_trianglemesh(py::module &m) {
              {"lambda", "Filter parameter."},
              {"mu", "Filter parameter."},
              {"scope", "Mesh property that should be filtered."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "filter_sharpen_in_place",
+            {{"number_of_iterations",
+              " Number of repetitions of this operation"},
+             {"strength", "Filter parameter."},
+             {"scope", "Mesh property that should be filtered."},
+             {"vertex_indices",
+              "Indices of the vertices to filter, all vertices if empty."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "filter_smooth_simple_in_place",
+            {{"number_of_iterations",
+              " Number of repetitions of this operation"},
+             {"scope", "Mesh property that should be filtered."},
+             {"vertex_indices",
+              "Indices of the vertices to filter, all vertices if empty."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "filter_smooth_laplacian_in_place",
+            {{"number_of_iterations",
+              " Number of repetitions of this operation"},
+             {"lambda", "Filter parameter."},
+             {"scope", "Mesh property that should be filtered."},
+             {"vertex_indices",
+              "Indices of the vertices to filter, all vertices if empty."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "filter_smooth_taubin_in_place",
+            {{"number_of_iterations",
+              " Number of repetitions of this operation"},
+             {"lambda", "Filter parameter."},
+             {"mu", "Filter parameter."},
+             {"scope", "Mesh property that should be filtered."},
+             {"vertex_indices",
+              "Indices of the vertices to filter, all vertices if empty."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "select_by_index",
             {{"indices", "Indices of vertices to be selected."}});
@@ -571,7 +638,10 @@ void pybind_trianglemesh(py::module &m) {
               "If True assigns the triangle normals instead of the "
               "interpolated vertex normals to the returned points. The "
               "triangle normals will be computed and added to the mesh if "
-              "necessary."}});
+              "necessary."},
+             {"seed",
+              "Seed value used in the random generator, set to -1 to use a "
+              "random seed value with each function call."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "sample_points_poisson_disk",
             {{"number_of_points", "Number of points that should be sampled."},
@@ -585,7 +655,10 @@ void pybind_trianglemesh(py::module &m) {
               "If True assigns the triangle normals instead of the "
               "interpolated vertex normals to the returned points. The "
               "triangle normals will be computed and added to the mesh if "
-              "necessary."}});
+              "necessary."},
+             {"seed",
+              "Seed value used in the random generator, set to -1 to use a "
+              "random seed value with each function call."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "subdivide_midpoint",
             {{"number_of_iterations",
@@ -28,6 +28,7 @@
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 #include "Open3D/Integration/TSDFVolume.h"
 #include "Open3D/Integration/UniformTSDFVolume.h"
+#include "Open3D/Utility/Console.h"
 
 #include "open3d_pybind/docstring.h"
 #include "open3d_pybind/integration/integration.h"
@@ -71,6 +72,36 @@ void pybind_integration_classes(py::module &m) {
             }),
             py::none(), py::none(), "");
 
+    // open3d.integration.TSDFRaycastResult
+    py::class_<integration::TSDFRaycastResult,
+               std::shared_ptr<integration::TSDFRaycastResult>>
+            raycast_result(m, "TSDFRaycastResult",
+                           "Images of the surface in a TSDF volume rendered "
+                           "by ``TSDFVolume.raycast``. Pixels whose ray does "
+                           "not hit the surface are zero.");
+    raycast_result.def(py::init<>())
+            .def("__repr__",
+                 [](const integration::TSDFRaycastResult &result) {
+                     return fmt::format(
+                             "integration::TSDFRaycastResult of size {}x{}",
+                             result.depth_.width_, result.depth_.height_);
+                 })
+            .def_readwrite("depth", &integration::TSDFRaycastResult::depth_,
+                           "open3d.geometry.Image: Depth along the camera z "
+                           "axis in meters, 1 channel float.")
+            .def_readwrite("vertex_map",
+                           &integration::TSDFRaycastResult::vertex_map_,
+                           "open3d.geometry.Image: Surface points in world "
+                           "coordinates, 3 channel float.")
+            .def_readwrite("normal_map",
+                           &integration::TSDFRaycastResult::normal_map_,
+                           "open3d.geometry.Image: Unit surface normals in "
+                           "world coordinates, 3 channel float.")
+            .def_readwrite("color", &integration::TSDFRaycastResult::color_,
+                           "open3d.geometry.Image: Surface color, 3 channel "
+                           "uint8 for RGB8 volumes, 1 channel float for "
+                           "Gray32 volumes and empty without color.");
+
     // open3d.integration.TSDFVolume
     py::class_<integration::TSDFVolume, PyTSDFVolume<integration::TSDFVolume>>
             tsdfvolume(m, "TSDFVolume", R"(Base class of the Truncated
@@ -95,6 +126,11 @@ In SIGGRAPH, 1996)");
             .def("extract_triangle_mesh",
                  &integration::TSDFVolume::ExtractTriangleMesh,
                  "Function to extract a triangle mesh")
+            .def("raycast", &integration::TSDFVolume::Raycast,
+                 "Function to render the surface seen from a camera by "
+                 "marching rays through the volume",
+                 "intrinsic"_a, "extrinsic"_a, "depth_min"_a = 0.1,
+                 "depth_max"_a = 3.0)
             .def_readwrite("voxel_length",
                            &integration::TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
@@ -111,6 +147,12 @@ In SIGGRAPH, 1996)");
             {{"image", "RGBD image."},
              {"intrinsic", "Pinhole camera intrinsic parameters."},
              {"extrinsic", "Extrinsic parameters."}});
+    docstring::ClassMethodDocInject(
+            m, "TSDFVolume", "raycast",
+            {{"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "Extrinsic parameters."},
+             {"depth_min", "Depth the rays start from."},
+             {"depth_max", "Depth the rays stop at."}});
     docstring::ClassMethodDocInject(m, "TSDFVolume", "reset");
 
     // open3d.integration.UniformTSDFVolume: open3d.integration.TSDFVolume
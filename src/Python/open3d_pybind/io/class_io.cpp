@@ -33,9 +33,13 @@
 #include "Open3D/IO/ClassIO/IJsonConvertibleIO.h"
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/IO/ClassIO/LineSetIO.h"
+#include "Open3D/IO/ClassIO/MappedPointCloudIO.h"
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/PointCloudLODIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/RGBDImageIO.h"
+#include "Open3D/IO/ClassIO/RGBDSequenceIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 
@@ -53,9 +57,13 @@ using namespace open3d;
 static const std::unordered_map<std::string, std::string>
         map_shared_argument_docstrings = {
                 {"filename", "Path to file."},
+                {"directory", "Path to the directory of the octree files."},
                 // Write options
                 {"compressed",
                  "Set to ``True`` to write in compressed format."},
+                {"max_depth",
+                 "Only the nodes up to this depth are read, -1 reads all."},
+                {"option", "The ``PointCloudLODOption`` of the octree."},
                 {"format",
                  "The format of the input file. When not specified or set as "
                  "``auto``, the format is inferred from file extension name."},
@@ -65,6 +73,8 @@ static const std::unordered_map<std::string, std::string>
                 {"remove_infinite_points",
                  "If true, all points that include an infinite value are "
                  "removed from the PointCloud."},
+                {"position_precision",
+                 "Maximum error of the stored positions."},
                 {"quality", "Quality of the output file."},
                 {"write_ascii",
                  "Set to ``True`` to output in ascii format, otherwise binary "
@@ -76,6 +86,7 @@ static const std::unordered_map<std::string, std::string>
                  "Set to ``False`` to not write any vertex colors, even if "
                  "present on the mesh"},
                 // Entities
+                {"bbox", "The ``AxisAlignedBoundingBox`` to crop with."},
                 {"config", "AzureKinectSensor's config file."},
                 {"pointcloud", "The ``PointCloud`` object for I/O"},
                 {"mesh", "The ``TriangleMesh`` object for I/O"},
@@ -169,6 +180,36 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_point_cloud",
                                  map_shared_argument_docstrings);
 
+    m_io.def("write_quantized_point_cloud",
+             [](const std::string &filename,
+                const geometry::PointCloud &pointcloud,
+                double position_precision, bool print_progress) {
+                 return io::WriteQuantizedPointCloudToO3DPC(
+                         filename, pointcloud, position_precision,
+                         print_progress);
+             },
+             "Function to write PointCloud to a compressed o3dpc file with "
+             "quantized positions",
+             "filename"_a, "pointcloud"_a, "position_precision"_a,
+             "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "write_quantized_point_cloud",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("crop_point_cloud",
+             [](const std::string &filename,
+                const geometry::AxisAlignedBoundingBox &bbox,
+                bool print_progress) {
+                 geometry::PointCloud pcd;
+                 io::CropPointCloudFromO3DPC(filename, bbox, pcd,
+                                             print_progress);
+                 return pcd;
+             },
+             "Function to read the points of an o3dpc file inside a bounding "
+             "box, chunks outside of the box are not decoded",
+             "filename"_a, "bbox"_a, "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "crop_point_cloud",
+                                 map_shared_argument_docstrings);
+
     // open3d::geometry::TriangleMesh
     m_io.def("read_triangle_mesh",
              [](const std::string &filename, bool print_progress) {
@@ -327,6 +368,279 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_pose_graph",
                                  map_shared_argument_docstrings);
 
+    // open3d::io::RGBDSequenceWriter
+    py::class_<io::RGBDSequenceWriter> rgbd_sequence_writer(
+            m_io, "RGBDSequenceWriter",
+            "Writer of recorded RGBD sequences, a sensor agnostic container "
+            "of compressed depth and color frames.");
+    rgbd_sequence_writer.def(py::init([]() {
+        return new io::RGBDSequenceWriter();
+    }));
+    rgbd_sequence_writer
+            .def("open", &io::RGBDSequenceWriter::Open,
+                 "Create a recording file.", "filename"_a)
+            .def("is_opened", &io::RGBDSequenceWriter::IsOpened,
+                 "Check if a recording file is opened.")
+            .def("write_frame", &io::RGBDSequenceWriter::WriteFrame,
+                 "Compress and append one frame.", "rgbd"_a)
+            .def("close", &io::RGBDSequenceWriter::Close,
+                 "Write the frame index and close the file.")
+            .def("get_num_frames", &io::RGBDSequenceWriter::GetNumFrames,
+                 "Number of frames written to the opened file.");
+    docstring::ClassMethodDocInject(m_io, "RGBDSequenceWriter", "open",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m_io, "RGBDSequenceWriter", "write_frame",
+                                    {{"rgbd", "The frame to append."}});
+
+    // open3d::io::RGBDSequenceReader
+    py::class_<io::RGBDSequenceReader> rgbd_sequence_reader(
+            m_io, "RGBDSequenceReader",
+            "Reader of recorded RGBD sequences, frames ahead of the playback "
+            "position are decoded on background threads.");
+    rgbd_sequence_reader.def(
+            py::init([](int num_threads, size_t max_prefetched_frames) {
+                return new io::RGBDSequenceReader(num_threads,
+                                                  max_prefetched_frames);
+            }),
+            "num_threads"_a = -1, "max_prefetched_frames"_a = 8);
+    rgbd_sequence_reader
+            .def("open", &io::RGBDSequenceReader::Open,
+                 "Open a recording and start prefetching.", "filename"_a)
+            .def("is_opened", &io::RGBDSequenceReader::IsOpened,
+                 "Check if a recording is opened.")
+            .def("close", &io::RGBDSequenceReader::Close,
+                 "Stop prefetching and close the recording.")
+            .def("get_num_frames", &io::RGBDSequenceReader::GetNumFrames,
+                 "Number of frames in the recording.")
+            .def("is_eof", &io::RGBDSequenceReader::IsEOF,
+                 "Check if all frames have been played back.")
+            .def("seek_frame", &io::RGBDSequenceReader::SeekFrame,
+                 "Move the playback position.", "index"_a)
+            .def("next_frame", &io::RGBDSequenceReader::NextFrame,
+                 "Get the frame at the playback position and advance it.")
+            .def("read_frame", &io::RGBDSequenceReader::ReadFrame,
+                 "Read and decode one frame independently of the playback "
+                 "position.",
+                 "index"_a);
+    docstring::ClassMethodDocInject(m_io, "RGBDSequenceReader", "open",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m_io, "RGBDSequenceReader", "seek_frame",
+                                    {{"index", "Index of the frame."}});
+    docstring::ClassMethodDocInject(m_io, "RGBDSequenceReader", "read_frame",
+                                    {{"index", "Index of the frame."}});
+
+    // open3d::io::RGBDImageLoader
+    m_io.def("read_rgbd_association_file",
+             [](const std::string &filename) {
+                 std::vector<std::string> color_paths, depth_paths;
+                 io::ReadRGBDAssociationFile(filename, color_paths,
+                                             depth_paths);
+                 return std::make_tuple(color_paths, depth_paths);
+             },
+             "Function to read the color and depth image paths of an RGBD "
+             "dataset from an association file",
+             "filename"_a);
+    docstring::FunctionDocInject(m_io, "read_rgbd_association_file",
+                                 map_shared_argument_docstrings);
+
+    py::class_<io::RGBDImageLoader> rgbd_image_loader(
+            m_io, "RGBDImageLoader",
+            "Loader of RGBD datasets stored as image files, the next frames "
+            "are decoded on background threads.");
+    rgbd_image_loader.def(
+            py::init([](const std::vector<std::string> &color_paths,
+                        const std::vector<std::string> &depth_paths,
+                        double depth_scale, double depth_trunc,
+                        bool convert_rgb_to_intensity, int num_threads,
+                        size_t readahead) {
+                return new io::RGBDImageLoader(
+                        color_paths, depth_paths, depth_scale, depth_trunc,
+                        convert_rgb_to_intensity, num_threads, readahead);
+            }),
+            "color_paths"_a, "depth_paths"_a, "depth_scale"_a = 1000.0,
+            "depth_trunc"_a = 3.0, "convert_rgb_to_intensity"_a = true,
+            "num_threads"_a = -1, "readahead"_a = 8);
+    rgbd_image_loader
+            .def("get_num_frames", &io::RGBDImageLoader::GetNumFrames,
+                 "Number of frames in the dataset.")
+            .def("is_eof", &io::RGBDImageLoader::IsEOF,
+                 "Check if all frames have been loaded.")
+            .def("seek_frame", &io::RGBDImageLoader::SeekFrame,
+                 "Move the loading position.", "index"_a)
+            .def("next_frame", &io::RGBDImageLoader::NextFrame,
+                 "Get the frame at the loading position and advance it.")
+            .def("read_frame", &io::RGBDImageLoader::ReadFrame,
+                 "Load one frame independently of the loading position.",
+                 "index"_a);
+    docstring::ClassMethodDocInject(m_io, "RGBDImageLoader", "seek_frame",
+                                    {{"index", "Index of the frame."}});
+    docstring::ClassMethodDocInject(m_io, "RGBDImageLoader", "read_frame",
+                                    {{"index", "Index of the frame."}});
+
+    // open3d::io::MappedPointCloud
+    py::class_<io::MappedPointCloud> mapped_point_cloud(
+            m_io, "MappedPointCloud",
+            "Point cloud stored in a memory mapped binary PLY or PCD file, "
+            "points are converted one chunk at a time.");
+    mapped_point_cloud.def(py::init([](size_t chunk_size) {
+                               return new io::MappedPointCloud(chunk_size);
+                           }),
+                           "chunk_size"_a = 1 << 20);
+    mapped_point_cloud
+            .def("open", &io::MappedPointCloud::Open,
+                 "Map a point cloud file.", "filename"_a)
+            .def("close", &io::MappedPointCloud::Close, "Unmap the file.")
+            .def("is_opened", &io::MappedPointCloud::IsOpened,
+                 "Check if a file is mapped.")
+            .def("get_num_points", &io::MappedPointCloud::GetNumPoints,
+                 "Number of points in the file.")
+            .def("has_normals", &io::MappedPointCloud::HasNormals,
+                 "Returns ``True`` if the file has normals.")
+            .def("has_colors", &io::MappedPointCloud::HasColors,
+                 "Returns ``True`` if the file has colors.")
+            .def("read_chunk",
+                 [](const io::MappedPointCloud &mapped, size_t first,
+                    size_t count) {
+                     geometry::PointCloud chunk;
+                     mapped.ReadChunk(first, count, chunk);
+                     return chunk;
+                 },
+                 "Convert a range of points.", "first"_a, "count"_a)
+            .def("get_axis_aligned_bounding_box",
+                 &io::MappedPointCloud::GetAxisAlignedBoundingBox,
+                 "Compute the bounding box in one pass over the file.")
+            .def("crop", &io::MappedPointCloud::Crop,
+                 "Keep the points in the bounding box in one pass over the "
+                 "file.",
+                 "bounding_box"_a)
+            .def("voxel_down_sample", &io::MappedPointCloud::VoxelDownSample,
+                 "Downsample the points with a voxel in two passes over the "
+                 "file.",
+                 "voxel_size"_a);
+    docstring::ClassMethodDocInject(m_io, "MappedPointCloud", "open",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(
+            m_io, "MappedPointCloud", "read_chunk",
+            {{"first", "Index of the first point."},
+             {"count", "Number of points, clipped to the end of the file."}});
+    docstring::ClassMethodDocInject(
+            m_io, "MappedPointCloud", "crop",
+            {{"bounding_box", "AxisAlignedBoundingBox to crop points"}});
+    docstring::ClassMethodDocInject(
+            m_io, "MappedPointCloud", "voxel_down_sample",
+            {{"voxel_size", "Voxel size to downsample into."}});
+
+    // open3d::io::PointCloudLODOption
+    py::class_<io::PointCloudLODOption> lod_option(
+            m_io, "PointCloudLODOption", "Option for write_point_cloud_lod.");
+    py::detail::bind_copy_functions<io::PointCloudLODOption>(lod_option);
+    lod_option
+            .def(py::init([](size_t max_node_points, int sampling_resolution,
+                             int max_depth, size_t max_chunk_points,
+                             const std::string &format) {
+                     return new io::PointCloudLODOption(
+                             max_node_points, sampling_resolution, max_depth,
+                             max_chunk_points, format);
+                 }),
+                 "max_node_points"_a = 20000, "sampling_resolution"_a = 128,
+                 "max_depth"_a = 16, "max_chunk_points"_a = 1 << 22,
+                 "format"_a = "ply")
+            .def_readwrite("max_node_points",
+                           &io::PointCloudLODOption::max_node_points_,
+                           "int: A node with at most this many points is a "
+                           "leaf and keeps all of them.")
+            .def_readwrite("sampling_resolution",
+                           &io::PointCloudLODOption::sampling_resolution_,
+                           "int: Number of sampling cells along each side of "
+                           "an internal node.")
+            .def_readwrite("max_depth", &io::PointCloudLODOption::max_depth_,
+                           "int: Nodes at this depth are leaves.")
+            .def_readwrite("max_chunk_points",
+                           &io::PointCloudLODOption::max_chunk_points_,
+                           "int: Maximum number of points held in memory by "
+                           "one thread.")
+            .def_readwrite("format", &io::PointCloudLODOption::format_,
+                           "str: Extension of the node files.");
+
+    // open3d::io::PointCloudLODNode
+    py::class_<io::PointCloudLODNode> lod_node(
+            m_io, "PointCloudLODNode", "Node of a level of detail octree.");
+    lod_node.def_readonly("name", &io::PointCloudLODNode::name_,
+                          "str: Path from the root to the node.")
+            .def_readonly("num_points", &io::PointCloudLODNode::num_points_,
+                          "int: Number of points stored in the node file.");
+
+    // open3d::io::PointCloudLODIndex
+    py::class_<io::PointCloudLODIndex> lod_index(
+            m_io, "PointCloudLODIndex",
+            "Hierarchy of a point cloud written as a level of detail octree.");
+    py::detail::bind_default_constructor<io::PointCloudLODIndex>(lod_index);
+    lod_index
+            .def_readonly("origin", &io::PointCloudLODIndex::origin_,
+                          "Minimum corner of the root cube.")
+            .def_readonly("size", &io::PointCloudLODIndex::size_,
+                          "float: Side length of the root cube.")
+            .def_readonly("format", &io::PointCloudLODIndex::format_,
+                          "str: Extension of the node files.")
+            .def_readonly("num_points", &io::PointCloudLODIndex::num_points_,
+                          "int: Number of points of the point cloud.")
+            .def_readonly("nodes", &io::PointCloudLODIndex::nodes_,
+                          "List of nodes in breadth first order.")
+            .def("get_node_bounding_box",
+                 &io::PointCloudLODIndex::GetNodeBoundingBox,
+                 "Returns the cube of a node.", "name"_a)
+            .def("get_node_spacing", &io::PointCloudLODIndex::GetNodeSpacing,
+                 "Returns the sampling cell size of a node.", "name"_a)
+            .def("get_node_file_name",
+                 &io::PointCloudLODIndex::GetNodeFileName,
+                 "Returns the file name of a node, relative to the index.",
+                 "name"_a);
+
+    m_io.def("write_point_cloud_lod",
+             [](const std::string &directory,
+                const geometry::PointCloud &pointcloud,
+                const io::PointCloudLODOption &option, bool print_progress) {
+                 return io::WritePointCloudLOD(directory, pointcloud, option,
+                                               print_progress);
+             },
+             "Function to write PointCloud as a level of detail octree",
+             "directory"_a, "pointcloud"_a,
+             "option"_a = io::PointCloudLODOption(),
+             "print_progress"_a = false);
+    m_io.def("write_point_cloud_lod",
+             [](const std::string &directory,
+                const io::MappedPointCloud &pointcloud,
+                const io::PointCloudLODOption &option, bool print_progress) {
+                 return io::WritePointCloudLOD(directory, pointcloud, option,
+                                               print_progress);
+             },
+             "Function to write MappedPointCloud as a level of detail octree",
+             "directory"_a, "pointcloud"_a,
+             "option"_a = io::PointCloudLODOption(),
+             "print_progress"_a = false);
+
+    m_io.def("read_point_cloud_lod_index",
+             [](const std::string &directory) {
+                 io::PointCloudLODIndex index;
+                 io::ReadPointCloudLODIndex(directory, index);
+                 return index;
+             },
+             "Function to read the index of a level of detail octree",
+             "directory"_a);
+    docstring::FunctionDocInject(m_io, "read_point_cloud_lod_index",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("read_point_cloud_lod",
+             [](const std::string &directory, int max_depth) {
+                 geometry::PointCloud pcd;
+                 io::ReadPointCloudLOD(directory, pcd, max_depth);
+                 return pcd;
+             },
+             "Function to read the nodes of a level of detail octree",
+             "directory"_a, "max_depth"_a = -1);
+    docstring::FunctionDocInject(m_io, "read_point_cloud_lod",
+                                 map_shared_argument_docstrings);
+
 #ifdef BUILD_AZURE_KINECT
     m_io.def("read_azure_kinect_sensor_config",
              [](const std::string &filename) {
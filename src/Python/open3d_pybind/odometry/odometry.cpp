@@ -66,15 +66,20 @@ void pybind_odometry_classes(py::module &m) {
             .def(py::init(
                          [](std::vector<int> iteration_number_per_pyramid_level,
                             double max_depth_diff, double min_depth,
-                            double max_depth) {
+                            double max_depth,
+                            double depth_bilateral_sigma_space,
+                            double depth_bilateral_sigma_depth) {
                              return new odometry::OdometryOption(
                                      iteration_number_per_pyramid_level,
-                                     max_depth_diff, min_depth, max_depth);
+                                     max_depth_diff, min_depth, max_depth,
+                                     depth_bilateral_sigma_space,
+                                     depth_bilateral_sigma_depth);
                          }),
                  "iteration_number_per_pyramid_level"_a =
                          std::vector<int>{20, 10, 5},
                  "max_depth_diff"_a = 0.03, "min_depth"_a = 0.0,
-                 "max_depth"_a = 4.0)
+                 "max_depth"_a = 4.0, "depth_bilateral_sigma_space"_a = 0.0,
+                 "depth_bilateral_sigma_depth"_a = 0.03)
             .def_readwrite("iteration_number_per_pyramid_level",
                            &odometry::OdometryOption::
                                    iteration_number_per_pyramid_level_,
@@ -97,6 +102,16 @@ void pybind_odometry_classes(py::module &m) {
             .def_readwrite("max_depth", &odometry::OdometryOption::max_depth_,
                            "Pixels that has larger than specified depth values "
                            "are ignored.")
+            .def_readwrite("depth_bilateral_sigma_space",
+                           &odometry::OdometryOption::
+                                   depth_bilateral_sigma_space_,
+                           "Spatial standard deviation in pixels of the "
+                           "bilateral depth filter, 0 disables the filter.")
+            .def_readwrite("depth_bilateral_sigma_depth",
+                           &odometry::OdometryOption::
+                                   depth_bilateral_sigma_depth_,
+                           "Depth standard deviation of the bilateral depth "
+                           "filter.")
             .def("__repr__", [](const odometry::OdometryOption &c) {
                 int num_pyramid_level =
                         (int)c.iteration_number_per_pyramid_level_.size();
@@ -117,7 +132,11 @@ void pybind_odometry_classes(py::module &m) {
                        std::string("\nmin_depth = ") +
                        std::to_string(c.min_depth_) +
                        std::string("\nmax_depth = ") +
-                       std::to_string(c.max_depth_);
+                       std::to_string(c.max_depth_) +
+                       std::string("\ndepth_bilateral_sigma_space = ") +
+                       std::to_string(c.depth_bilateral_sigma_space_) +
+                       std::string("\ndepth_bilateral_sigma_depth = ") +
+                       std::to_string(c.depth_bilateral_sigma_depth_);
             });
 
     // open3d.odometry.RGBDOdometryJacobian
@@ -178,10 +197,99 @@ Anonymous submission.)");
             [](const odometry::RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.RGBDOdometryJacobianFromPointToPlaneTerm:
+    // RGBDOdometryJacobian
+    py::class_<odometry::RGBDOdometryJacobianFromPointToPlaneTerm,
+               PyRGBDOdometryJacobian<
+                       odometry::RGBDOdometryJacobianFromPointToPlaneTerm>,
+               odometry::RGBDOdometryJacobian>
+            jacobian_point_to_plane(
+                    m, "RGBDOdometryJacobianFromPointToPlaneTerm",
+                    R"(Class to compute Jacobian using point-to-plane term of projective data association. Only depth is used, the color of the RGBD images may be empty.
+
+Energy: :math:`(n_q^T(Tp-q))^2`
+
+Reference:
+
+R. A. Newcombe, S. Izadi, O. Hilliges, D. Molyneaux, D. Kim, A. J. Davison, P. Kohli, J. Shotton, S. Hodges and A. Fitzgibbon.
+
+KinectFusion: Real-time dense surface mapping and tracking.
+
+In ISMAR, 2011.)");
+    py::detail::bind_default_constructor<
+            odometry::RGBDOdometryJacobianFromPointToPlaneTerm>(
+            jacobian_point_to_plane);
+    py::detail::bind_copy_functions<
+            odometry::RGBDOdometryJacobianFromPointToPlaneTerm>(
+            jacobian_point_to_plane);
+    jacobian_point_to_plane.def(
+            "__repr__",
+            [](const odometry::RGBDOdometryJacobianFromPointToPlaneTerm &te) {
+                return std::string("RGBDOdometryJacobianFromPointToPlaneTerm");
+            });
+
+    // open3d.odometry.OdometryFrame
+    py::class_<odometry::OdometryFrame,
+               std::shared_ptr<odometry::OdometryFrame>>
+            odometry_frame(m, "OdometryFrame",
+                           "RGBD image preprocessed for odometry, can be "
+                           "reused for several image pairs.");
+    py::detail::bind_default_constructor<odometry::OdometryFrame>(
+            odometry_frame);
+    py::detail::bind_copy_functions<odometry::OdometryFrame>(odometry_frame);
+    odometry_frame
+            .def(py::init<const geometry::RGBDImage &,
+                          const camera::PinholeCameraIntrinsic &,
+                          const odometry::OdometryOption &>(),
+                 "rgbd_image"_a, "pinhole_camera_intrinsic"_a,
+                 "option"_a = odometry::OdometryOption())
+            .def("is_empty", &odometry::OdometryFrame::IsEmpty,
+                 "Returns ``True`` if the frame holds no pyramid.")
+            .def_readonly("intrinsic", &odometry::OdometryFrame::intrinsic_,
+                          "Camera intrinsic parameters of the frame.")
+            .def_readonly("image", &odometry::OdometryFrame::image_,
+                          "Filtered intensity and preprocessed depth.")
+            .def("__repr__", [](const odometry::OdometryFrame &frame) {
+                return std::string("odometry::OdometryFrame with ") +
+                       std::to_string(frame.pyramid_.size()) +
+                       " pyramid levels.";
+            });
+
+    // open3d.odometry.RGBDOdometryTracker
+    py::class_<odometry::RGBDOdometryTracker> tracker(
+            m, "RGBDOdometryTracker",
+            "Frame-to-frame odometry for a sequence of RGBD images. The "
+            "preprocessing of the previous image is kept.");
+    tracker.def(py::init<const camera::PinholeCameraIntrinsic &,
+                         const odometry::OdometryOption &>(),
+                "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+                "option"_a = odometry::OdometryOption())
+            .def("track", &odometry::RGBDOdometryTracker::Track,
+                 "Estimates the motion from the previous image to the given "
+                 "one. The first image only initializes the tracker. Output: "
+                 "(is_success, 4x4 motion matrix, 6x6 information matrix).",
+                 "rgbd_image"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+                 "jacobian"_a = odometry::RGBDOdometryJacobianFromHybridTerm())
+            .def("reset", &odometry::RGBDOdometryTracker::Reset,
+                 "Forgets the previous image.")
+            .def("has_previous_frame",
+                 &odometry::RGBDOdometryTracker::HasPreviousFrame,
+                 "Returns ``True`` if the tracker holds a previous image.")
+            .def("__repr__", [](const odometry::RGBDOdometryTracker &tracker) {
+                return std::string("odometry::RGBDOdometryTracker");
+            });
 }
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("compute_rgbd_odometry", &odometry::ComputeRGBDOdometry,
+    m.def("compute_rgbd_odometry",
+          static_cast<std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> (*)(
+                  const geometry::RGBDImage &, const geometry::RGBDImage &,
+                  const camera::PinholeCameraIntrinsic &,
+                  const Eigen::Matrix4d &,
+                  const odometry::RGBDOdometryJacobian &,
+                  const odometry::OdometryOption &)>(
+                  &odometry::ComputeRGBDOdometry),
           "Function to estimate 6D rigid motion from two RGBD image pairs. "
           "Output: (is_success, 4x4 motion matrix, 6x6 information matrix).",
           "rgbd_source"_a, "rgbd_target"_a,
@@ -202,6 +310,33 @@ void pybind_odometry_methods(py::module &m) {
                      "``odometry::RGBDOdometryJacobianFromColorTerm().``"},
                     {"option", "Odometry hyper parameteres."},
             });
+    m.def("compute_rgbd_odometry_from_frames",
+          static_cast<std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> (*)(
+                  const odometry::OdometryFrame &,
+                  const odometry::OdometryFrame &, const Eigen::Matrix4d &,
+                  const odometry::RGBDOdometryJacobian &,
+                  const odometry::OdometryOption &)>(
+                  &odometry::ComputeRGBDOdometry),
+          "Function to estimate 6D rigid motion from two preprocessed "
+          "frames. Output: (is_success, 4x4 motion matrix, 6x6 information "
+          "matrix).",
+          "source"_a, "target"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+          "jacobian"_a = odometry::RGBDOdometryJacobianFromHybridTerm(),
+          "option"_a = odometry::OdometryOption());
+    docstring::FunctionDocInject(
+            m, "compute_rgbd_odometry_from_frames",
+            {
+                    {"source", "Source OdometryFrame."},
+                    {"target", "Target OdometryFrame."},
+                    {"odo_init", "Initial 4x4 motion matrix estimation."},
+                    {"jacobian",
+                     "The odometry Jacobian method to use. Can be "
+                     "``odometry::RGBDOdometryJacobianFromHybridTerm()`` or "
+                     "``odometry::RGBDOdometryJacobianFromColorTerm().``"},
+                    {"option",
+                     "Odometry hyper parameteres, the frames have to be "
+                     "created with the same option."},
+            });
 }
 
 void pybind_odometry(py::module &m) {
@@ -754,6 +754,196 @@ TEST(Image, Filter_Sobel3Dy) {
     TEST_Filter(ref, FilterType::Sobel3Dy);
 }
 
+TEST(Image, FilterSeparableBlocks) {
+    geometry::Image image;
+    image.Prepare(37, 70, 1, 4);
+    Rand(image.data_, 0, 255, 0);
+    auto float_image = image.CreateFloatImage();
+
+    // the blocked filter matches filtering each direction on its own
+    vector<double> dx = {0.1, 0.2, 0.4, 0.2, 0.1};
+    vector<double> dy = {-1.0, 0.0, 1.0};
+    auto output = float_image->Filter(dx, dy);
+    auto ref = float_image->FilterHorizontal(dx)
+                       ->Transpose()
+                       ->FilterHorizontal(dy)
+                       ->Transpose();
+    EXPECT_EQ(ref->width_, output->width_);
+    EXPECT_EQ(ref->height_, output->height_);
+    ExpectEQ(ref->data_, output->data_);
+}
+
+TEST(Image, FilterSobel) {
+    geometry::Image image;
+    image.Prepare(37, 70, 1, 4);
+    Rand(image.data_, 0, 255, 0);
+    auto float_image = image.CreateFloatImage();
+
+    auto gradients = float_image->FilterSobel();
+    ExpectEQ(float_image->Filter(FilterType::Sobel3Dx)->data_,
+             gradients.first->data_);
+    ExpectEQ(float_image->Filter(FilterType::Sobel3Dy)->data_,
+             gradients.second->data_);
+}
+
+namespace {
+
+/// Double precision reference of Image::FilterBilateral and
+/// Image::FilterJointBilateral, guide is the depth image itself for the
+/// plain bilateral filter.
+geometry::Image BilateralReference(const geometry::Image &depth,
+                                   const geometry::Image &guide,
+                                   int half_kernel_size,
+                                   double sigma_space,
+                                   double sigma_range,
+                                   bool fill_holes) {
+    geometry::Image output = depth;
+    for (int y = 0; y < depth.height_; y++) {
+        for (int x = 0; x < depth.width_; x++) {
+            double d = *depth.PointerAt<float>(x, y);
+            double g = *guide.PointerAt<float>(x, y);
+            if (!(d > 0) && !fill_holes) continue;
+            double sum = 0.0, sum_weights = 0.0;
+            for (int dy = -half_kernel_size; dy <= half_kernel_size; dy++) {
+                for (int dx = -half_kernel_size; dx <= half_kernel_size;
+                     dx++) {
+                    if (!depth.TestImageBoundary(x + dx, y + dy)) continue;
+                    double v = *depth.PointerAt<float>(x + dx, y + dy);
+                    double h = *guide.PointerAt<float>(x + dx, y + dy);
+                    if (!(v > 0)) continue;
+                    double w = exp(-(dx * dx + dy * dy) /
+                                   (2.0 * sigma_space * sigma_space)) *
+                               exp(-(h - g) * (h - g) /
+                                   (2.0 * sigma_range * sigma_range));
+                    sum += w * v;
+                    sum_weights += w;
+                }
+            }
+            if (sum_weights > 0) {
+                *output.PointerAt<float>(x, y) = float(sum / sum_weights);
+            }
+        }
+    }
+    return output;
+}
+
+geometry::Image CreateStepDepthImage() {
+    geometry::Image depth;
+    depth.Prepare(24, 20, 1, 4);
+    vector<uint8_t> noise(24 * 20);
+    Rand(noise, 0, 255, 0);
+    for (int y = 0; y < depth.height_; y++) {
+        for (int x = 0; x < depth.width_; x++) {
+            *depth.PointerAt<float>(x, y) = (x < 12 ? 1.0f : 2.0f) +
+                                            0.01f * noise[y * 24 + x] / 255.0f;
+        }
+    }
+    *depth.PointerAt<float>(3, 4) = 0.0f;
+    *depth.PointerAt<float>(7, 15) = numeric_limits<float>::quiet_NaN();
+    return depth;
+}
+
+}  // unnamed namespace
+
+TEST(Image, FilterBilateral) {
+    geometry::Image depth = CreateStepDepthImage();
+    auto output = depth.FilterBilateral(2, 1.5, 0.05);
+    auto ref = BilateralReference(depth, depth, 2, 1.5, 0.05, false);
+    ASSERT_EQ(depth.width_, output->width_);
+    ASSERT_EQ(depth.height_, output->height_);
+
+    // invalid pixels are kept
+    EXPECT_EQ(0.0f, *output->PointerAt<float>(3, 4));
+    EXPECT_TRUE(std::isnan(*output->PointerAt<float>(7, 15)));
+    for (int y = 0; y < depth.height_; y++) {
+        for (int x = 0; x < depth.width_; x++) {
+            float v = *ref.PointerAt<float>(x, y);
+            if (!(v > 0)) continue;
+            EXPECT_NEAR(v, *output->PointerAt<float>(x, y), 1e-5);
+            // the depth edge is preserved
+            EXPECT_NEAR(x < 12 ? 1.005 : 2.005,
+                        *output->PointerAt<float>(x, y), 0.006);
+        }
+    }
+
+    EXPECT_ANY_THROW(depth.FilterBilateral(2, 0.0, 0.05));
+    EXPECT_ANY_THROW(depth.FilterBilateral(-1, 1.0, 0.05));
+    geometry::Image color;
+    color.Prepare(4, 4, 3, 1);
+    EXPECT_ANY_THROW(color.FilterBilateral(1, 1.0, 0.05));
+}
+
+TEST(Image, FilterJointBilateral) {
+    geometry::Image depth = CreateStepDepthImage();
+    geometry::Image guide;
+    guide.Prepare(24, 20, 3, 1);
+    for (int y = 0; y < guide.height_; y++) {
+        for (int x = 0; x < guide.width_; x++) {
+            for (int c = 0; c < 3; c++) {
+                *guide.PointerAt<uint8_t>(x, y, c) = x < 12 ? 40 : 200;
+            }
+        }
+    }
+    auto output = depth.FilterJointBilateral(guide, 2, 1.5, 0.05);
+    auto ref = BilateralReference(depth, *guide.CreateFloatImage(), 2, 1.5,
+                                  0.05, true);
+
+    // holes are filled from the valid neighbors on the same side of the
+    // color edge
+    EXPECT_NEAR(1.005, *output->PointerAt<float>(3, 4), 0.006);
+    EXPECT_NEAR(1.005, *output->PointerAt<float>(7, 15), 0.006);
+    for (int y = 0; y < depth.height_; y++) {
+        for (int x = 0; x < depth.width_; x++) {
+            EXPECT_NEAR(*ref.PointerAt<float>(x, y),
+                        *output->PointerAt<float>(x, y), 1e-5);
+        }
+    }
+
+    geometry::Image small_guide;
+    small_guide.Prepare(4, 4, 1, 4);
+    EXPECT_ANY_THROW(depth.FilterJointBilateral(small_guide, 2, 1.5, 0.05));
+}
+
+TEST(Image, FilterMedian) {
+    geometry::Image depth;
+    depth.Prepare(5, 4, 1, 4);
+    vector<float> values = {1, 2, 3, 4, 5,     //
+                            6, 100, 8, 0, 10,  //
+                            11, 12, 13, 0, 15, //
+                            0, 0, 0, 0, 0};
+    memcpy(depth.data_.data(), values.data(), values.size() * sizeof(float));
+
+    auto output = depth.FilterMedian(1);
+    // outlier removed: median of {1, 2, 3, 6, 100, 8, 11, 12, 13}
+    EXPECT_EQ(8.0f, *output->PointerAt<float>(1, 1));
+    // hole filled: median of {3, 4, 5, 8, 10, 13, 15}
+    EXPECT_EQ(8.0f, *output->PointerAt<float>(3, 1));
+    // border: median of {11, 12, 13}
+    EXPECT_EQ(12.0f, *output->PointerAt<float>(1, 3));
+    // hole with a single valid neighbor
+    EXPECT_EQ(15.0f, *output->PointerAt<float>(4, 3));
+
+    depth.Prepare(3, 3, 1, 4);
+    std::fill(depth.data_.begin(), depth.data_.end(), 0);
+    ExpectEQ(depth.data_, depth.FilterMedian(1)->data_);
+    ExpectEQ(depth.data_, depth.FilterMedian(0)->data_);
+}
+
+TEST(Image, FilterAndDownsample) {
+    geometry::Image image;
+    image.Prepare(37, 71, 1, 4);
+    Rand(image.data_, 0, 255, 0);
+    auto float_image = image.CreateFloatImage();
+
+    for (auto type : {FilterType::Gaussian3, FilterType::Gaussian7}) {
+        auto output = float_image->FilterAndDownsample(type);
+        auto ref = float_image->Filter(type)->Downsample();
+        EXPECT_EQ(18, output->width_);
+        EXPECT_EQ(35, output->height_);
+        ExpectEQ(ref->data_, output->data_);
+    }
+}
+
 TEST(Image, FilterHorizontal) {
     // reference data used to validate the filtering of an image
     vector<uint8_t> ref = {
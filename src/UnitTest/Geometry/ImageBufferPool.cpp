@@ -0,0 +1,217 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <thread>
+
+#include "Open3D/Geometry/ImageBufferPool.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+TEST(ImageBufferPool, DisabledByDefault) {
+    auto &pool = geometry::ImageBufferPool::GetInstance();
+    EXPECT_FALSE(pool.IsEnabled());
+    {
+        geometry::Image image;
+        image.Prepare(8, 4, 1, 4);
+    }
+    EXPECT_EQ(0u, pool.GetNumCachedBuffers());
+}
+
+TEST(ImageBufferPool, RecycleBuffer) {
+    auto &pool = geometry::ImageBufferPool::GetInstance();
+    pool.SetEnabled(true);
+    pool.ResetStatistics();
+
+    const uint8_t *buffer;
+    {
+        geometry::Image image;
+        image.Prepare(16, 8, 1, 4);
+        Rand(image.data_, 1, 255, 0);
+        buffer = image.data_.data();
+    }
+    EXPECT_EQ(1u, pool.GetNumCachedBuffers());
+    EXPECT_EQ(16u * 8u * 4u, pool.GetCachedBytes());
+    EXPECT_EQ(1u, pool.GetNumAllocated());
+
+    // buffers are matched by size and zero filled when reused
+    geometry::Image image;
+    image.Prepare(32, 4, 4, 1);
+    EXPECT_EQ(buffer, image.data_.data());
+    EXPECT_EQ(1u, pool.GetNumReused());
+    EXPECT_EQ(0u, pool.GetNumCachedBuffers());
+    ExpectEQ(vector<uint8_t>(16 * 8 * 4, 0), image.data_);
+
+    // the content is kept if the size does not change
+    image.data_[0] = 42;
+    image.Prepare(4, 32, 1, 4);
+    EXPECT_EQ(buffer, image.data_.data());
+    EXPECT_EQ(42, image.data_[0]);
+
+    // copies take their buffer from the pool as well
+    Rand(image.data_, 0, 255, 0);
+    geometry::Image cached;
+    cached.Prepare(8, 8, 1, 1);
+    cached.Clear();
+    EXPECT_EQ(1u, pool.GetNumCachedBuffers());
+    geometry::Image copy;
+    copy.Prepare(8, 8, 1, 1);
+    copy = image;
+    EXPECT_EQ(4, copy.width_);
+    EXPECT_EQ(32, copy.height_);
+    ExpectEQ(image.data_, copy.data_);
+    EXPECT_EQ(1u, pool.GetNumCachedBuffers());
+
+    pool.SetEnabled(false);
+    EXPECT_EQ(0u, pool.GetNumCachedBuffers());
+}
+
+TEST(ImageBufferPool, MoveImage) {
+    auto &pool = geometry::ImageBufferPool::GetInstance();
+    pool.SetEnabled(true);
+    pool.ResetStatistics();
+
+    geometry::Image image;
+    image.Prepare(16, 8, 1, 4);
+    Rand(image.data_, 0, 255, 0);
+    const vector<uint8_t> data = image.data_;
+    const uint8_t *buffer = image.data_.data();
+    EXPECT_EQ(1u, pool.GetNumAllocated());
+
+    // moves take the buffer over without allocating
+    geometry::Image moved(std::move(image));
+    EXPECT_EQ(buffer, moved.data_.data());
+    EXPECT_EQ(16, moved.width_);
+    EXPECT_TRUE(image.IsEmpty());
+    vector<geometry::Image> images;
+    images.push_back(std::move(moved));
+    for (int i = 0; i < 8; i++) {
+        images.push_back(geometry::Image());
+    }
+    EXPECT_EQ(buffer, images[0].data_.data());
+    EXPECT_EQ(1u, pool.GetNumAllocated());
+    EXPECT_EQ(0u, pool.GetNumReused());
+
+    // move assignment returns the old buffer to the pool
+    geometry::Image target;
+    target.Prepare(8, 8, 1, 1);
+    EXPECT_EQ(2u, pool.GetNumAllocated());
+    target = std::move(images[0]);
+    EXPECT_EQ(buffer, target.data_.data());
+    EXPECT_EQ(8, target.height_);
+    ExpectEQ(data, target.data_);
+    EXPECT_EQ(1u, pool.GetNumCachedBuffers());
+    EXPECT_EQ(2u, pool.GetNumAllocated());
+
+    pool.SetEnabled(false);
+}
+
+TEST(ImageBufferPool, MaxCachedBytes) {
+    auto &pool = geometry::ImageBufferPool::GetInstance();
+    pool.SetEnabled(true);
+    const size_t max_cached_bytes = pool.GetMaxCachedBytes();
+    {
+        vector<geometry::Image> images(4);
+        for (auto &image : images) {
+            image.Prepare(10, 10, 1, 1);
+        }
+    }
+    EXPECT_EQ(4u, pool.GetNumCachedBuffers());
+
+    pool.SetMaxCachedBytes(250);
+    EXPECT_EQ(2u, pool.GetNumCachedBuffers());
+    EXPECT_EQ(200u, pool.GetCachedBytes());
+    {
+        geometry::Image image;
+        image.Prepare(100, 1, 1, 1);
+        geometry::Image large;
+        large.Prepare(100, 1, 1, 4);
+    }
+    EXPECT_EQ(2u, pool.GetNumCachedBuffers());
+
+    pool.SetMaxCachedBytes(max_cached_bytes);
+    pool.SetEnabled(false);
+}
+
+TEST(ImageBufferPool, SteadyStateRGBDPipeline) {
+    auto &pool = geometry::ImageBufferPool::GetInstance();
+    pool.SetEnabled(true);
+
+    geometry::Image color, depth;
+    color.Prepare(64, 48, 3, 1);
+    depth.Prepare(64, 48, 1, 2);
+    Rand(color.data_, 0, 255, 0);
+    Rand(depth.data_, 0, 255, 1);
+
+    auto process_frame = [&]() {
+        auto rgbd = geometry::RGBDImage::CreateFromColorAndDepth(color, depth);
+        auto pyramid = rgbd->CreatePyramid(3);
+        auto gradients = pyramid[0]->color_.FilterSobel();
+        return pyramid.back()->depth_.data_;
+    };
+
+    auto first = process_frame();
+    pool.ResetStatistics();
+    auto second = process_frame();
+    EXPECT_EQ(0u, pool.GetNumAllocated());
+    EXPECT_LT(0u, pool.GetNumReused());
+    ExpectEQ(first, second);
+
+    pool.SetEnabled(false);
+}
+
+TEST(ImageBufferPool, MultipleThreads) {
+    auto &pool = geometry::ImageBufferPool::GetInstance();
+    pool.SetEnabled(true);
+    pool.ResetStatistics();
+
+    const int num_threads = 4;
+    const int num_iterations = 200;
+    vector<thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < num_iterations; i++) {
+                geometry::Image image;
+                image.Prepare(16 + (i + t) % 3, 16, 1, 4);
+                *image.PointerAt<float>(0, 0) = float(i);
+                auto filtered = image.Filter(
+                        geometry::Image::FilterType::Gaussian3);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(size_t(2 * num_threads * num_iterations),
+              pool.GetNumAllocated() + pool.GetNumReused());
+    EXPECT_GE(size_t(2 * num_threads * 3), pool.GetNumCachedBuffers());
+
+    pool.SetEnabled(false);
+}
@@ -0,0 +1,227 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+#include <type_traits>
+
+#include "Open3D/Geometry/ImageView.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace Eigen;
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+using FilterType = geometry::Image::FilterType;
+
+TEST(ImageView, ConstructFromImage) {
+    geometry::Image image;
+    image.Prepare(5, 3, 3, 2);
+    Rand(image.data_, 0, 255, 0);
+
+    geometry::ImageView view(image);
+    EXPECT_FALSE(view.IsEmpty());
+    EXPECT_TRUE(view.IsContiguous());
+    EXPECT_FALSE(view.OwnsBuffer());
+    EXPECT_EQ(image.BytesPerLine(), view.stride_);
+    EXPECT_EQ(image.PointerAt<uint16_t>(4, 2, 1),
+              view.PointerAt<uint16_t>(4, 2, 1));
+    EXPECT_TRUE(geometry::ImageView().IsEmpty());
+
+    // views are read-only, so they can be created from const images
+    const geometry::Image &const_image = image;
+    geometry::ImageView const_view(const_image);
+    static_assert(std::is_same<decltype(const_view.PointerAt<float>(0, 0)),
+                               const float *>::value,
+                  "ImageView must not give write access to the pixels.");
+    static_assert(std::is_same<decltype(const_view.RowAt<float>(0)),
+                               const float *>::value,
+                  "ImageView must not give write access to the pixels.");
+    static_assert(!std::is_convertible<const geometry::Image &,
+                                       geometry::ImageView>::value,
+                  "Images must not silently become views.");
+}
+
+TEST(ImageView, Crop) {
+    geometry::Image image;
+    image.Prepare(10, 8, 1, 4);
+    for (int v = 0; v < image.height_; v++) {
+        for (int u = 0; u < image.width_; u++) {
+            *image.PointerAt<float>(u, v) = float(v * 100 + u);
+        }
+    }
+
+    auto roi = geometry::ImageView(image).Crop(2, 3, 5, 4);
+    EXPECT_EQ(5, roi.width_);
+    EXPECT_EQ(4, roi.height_);
+    EXPECT_FALSE(roi.IsContiguous());
+    EXPECT_EQ(305.0f, *roi.PointerAt<float>(3, 0));
+    EXPECT_EQ(402.0f, *roi.RowAt<float>(1));
+
+    auto nested = roi.Crop(1, 1, 2, 2);
+    EXPECT_EQ(403.0f, *nested.PointerAt<float>(0, 0));
+    EXPECT_EQ(504.0f, *nested.PointerAt<float>(1, 1));
+
+    geometry::Image copy;
+    roi.CopyTo(copy);
+    EXPECT_EQ(5, copy.width_);
+    EXPECT_EQ(4, copy.height_);
+    for (int v = 0; v < copy.height_; v++) {
+        for (int u = 0; u < copy.width_; u++) {
+            EXPECT_EQ(*roi.PointerAt<float>(u, v),
+                      *copy.PointerAt<float>(u, v));
+        }
+    }
+
+    EXPECT_ANY_THROW(roi.Crop(1, 1, 5, 1));
+    EXPECT_ANY_THROW(roi.Crop(-1, 0, 1, 1));
+}
+
+TEST(ImageView, ExternalBuffer) {
+    int num_releases = 0;
+    {
+        // rows of 3 uint16_t pixels padded to 8 bytes
+        uint8_t *buffer = new uint8_t[8 * 2];
+        uint16_t values[2][4] = {{1000, 2000, 4000, 0}, {0, 500, 3000, 0}};
+        memcpy(buffer, values, sizeof(values));
+        geometry::ImageView roi;
+        {
+            geometry::ImageView view(buffer, 3, 2, 1, 2, 8,
+                                     [&num_releases](uint8_t *data) {
+                                         delete[] data;
+                                         num_releases++;
+                                     });
+            EXPECT_TRUE(view.OwnsBuffer());
+            EXPECT_FALSE(view.IsContiguous());
+            roi = view.Crop(1, 0, 2, 2);
+        }
+        EXPECT_EQ(0, num_releases);
+
+        geometry::Image depth;
+        roi.ConvertDepthToFloatImage(depth, 1000.0, 3.0);
+        EXPECT_EQ(2, depth.width_);
+        EXPECT_EQ(2, depth.height_);
+        EXPECT_EQ(2.0f, *depth.PointerAt<float>(0, 0));
+        EXPECT_EQ(0.0f, *depth.PointerAt<float>(1, 0));
+        EXPECT_EQ(0.5f, *depth.PointerAt<float>(0, 1));
+        // truncated at depth_trunc
+        EXPECT_EQ(0.0f, *depth.PointerAt<float>(1, 1));
+    }
+    EXPECT_EQ(1, num_releases);
+
+    // the stride must cover a row
+    EXPECT_ANY_THROW(geometry::ImageView(nullptr, 4, 2, 1, 2, 6));
+}
+
+TEST(ImageView, OperatorsOnCrop) {
+    geometry::Image image;
+    image.Prepare(53, 47, 3, 1);
+    Rand(image.data_, 0, 255, 0);
+    auto roi = geometry::ImageView(image).Crop(3, 5, 41, 37);
+    geometry::Image roi_copy;
+    roi.CopyTo(roi_copy);
+
+    geometry::Image output;
+    roi.CreateFloatImage(output);
+    auto ref = roi_copy.CreateFloatImage();
+    ExpectEQ(ref->data_, output.data_);
+
+    roi.FlipVertical(output);
+    ExpectEQ(roi_copy.FlipVertical()->data_, output.data_);
+    roi.FlipHorizontal(output);
+    ExpectEQ(roi_copy.FlipHorizontal()->data_, output.data_);
+    roi.Transpose(output);
+    ExpectEQ(roi_copy.Transpose()->data_, output.data_);
+
+    // float operators on a crop of a float image
+    auto float_image = image.CreateFloatImage();
+    auto float_roi = geometry::ImageView(*float_image).Crop(3, 5, 41, 37);
+    geometry::Image float_copy;
+    float_roi.CopyTo(float_copy);
+
+    float_roi.Filter(output, FilterType::Gaussian5);
+    ExpectEQ(float_copy.Filter(FilterType::Gaussian5)->data_, output.data_);
+    geometry::Image dx, dy;
+    float_roi.FilterSobel(dx, dy);
+    ExpectEQ(float_copy.Filter(FilterType::Sobel3Dx)->data_, dx.data_);
+    ExpectEQ(float_copy.Filter(FilterType::Sobel3Dy)->data_, dy.data_);
+    float_roi.Downsample(output);
+    ExpectEQ(float_copy.Downsample()->data_, output.data_);
+    float_roi.FilterAndDownsample(output, FilterType::Gaussian3);
+    ExpectEQ(float_copy.FilterAndDownsample(FilterType::Gaussian3)->data_,
+             output.data_);
+}
+
+TEST(ImageView, OutputReuse) {
+    geometry::Image image;
+    image.Prepare(32, 24, 1, 4);
+    Rand(image.data_, 0, 255, 0);
+
+    geometry::Image output;
+    geometry::ImageView(image).Filter(output, FilterType::Gaussian3);
+    const uint8_t *buffer = output.data_.data();
+    geometry::ImageView(image).Filter(output, FilterType::Gaussian7);
+    EXPECT_EQ(buffer, output.data_.data());
+    ExpectEQ(image.Filter(FilterType::Gaussian7)->data_, output.data_);
+
+    // the output must not hold the input
+    EXPECT_ANY_THROW(geometry::ImageView(image).Filter(image,
+                                                       FilterType::Gaussian3));
+}
+
+TEST(ImageView, CreatePointCloudFromDepthView) {
+    geometry::Image depth;
+    depth.Prepare(16, 12, 1, 2);
+    Rand(depth.data_, 0, 255, 0);
+    camera::PinholeCameraIntrinsic intrinsic(16, 12, 10.0, 10.0, 0.0, 0.0);
+    camera::PinholeCameraIntrinsic roi_intrinsic(8, 6, 10.0, 10.0, -4.0,
+                                                 -2.0);
+
+    // a crop at (4, 2) back-projects like the full image with a shifted
+    // principal point
+    auto roi = geometry::ImageView(depth).Crop(4, 2, 8, 6);
+    auto pc = geometry::PointCloud::CreateFromDepthImage(
+            roi, roi_intrinsic, Matrix4d::Identity(), 1000.0, 1000.0, 1,
+            false);
+    auto full = geometry::PointCloud::CreateFromDepthImage(
+            depth, intrinsic, Matrix4d::Identity(), 1000.0, 1000.0, 1, false);
+    ASSERT_EQ(48u, pc->points_.size());
+    for (int v = 0; v < 6; v++) {
+        for (int u = 0; u < 8; u++) {
+            const Vector3d &p = pc->points_[v * 8 + u];
+            const Vector3d &q = full->points_[(v + 2) * 16 + u + 4];
+            for (int i = 0; i < 3; i++) {
+                if (std::isnan(q(i))) {
+                    EXPECT_TRUE(std::isnan(p(i)));
+                } else {
+                    EXPECT_NEAR(q(i), p(i), 1e-12);
+                }
+            }
+        }
+    }
+}
@@ -915,6 +915,58 @@ TEST(PointCloud, CreatePointCloudFromDepthImage) {
     ExpectEQ(ref, output_pc->points_);
 }
 
+TEST(PointCloud, CreateFromDepthImageStride) {
+    geometry::Image image;
+    image.Prepare(7, 5, 1, 2);
+    Rand(image.data_, 0, 255, 0);
+    Matrix4d extrinsic = Matrix4d::Identity();
+    extrinsic.block<3, 3>(0, 0) =
+            AngleAxisd(0.3, Vector3d(1, 2, 3).normalized()).toRotationMatrix();
+    extrinsic.block<3, 1>(0, 3) = Vector3d(0.5, -1.0, 2.0);
+    camera::PinholeCameraIntrinsic intrinsic(7, 5, 5.0, 6.0, 3.0, 2.0);
+
+    // uint16_t depth is read directly, the float conversion gives the same
+    auto float_depth = image.ConvertDepthToFloatImage(100.0, 400.0);
+    auto pc = geometry::PointCloud::CreateFromDepthImage(
+            image, intrinsic, extrinsic, 100.0, 400.0, 2, false);
+    auto pc_float = geometry::PointCloud::CreateFromDepthImage(
+            *float_depth, intrinsic, extrinsic, 100.0, 400.0, 2, false);
+    EXPECT_EQ(12u, pc->points_.size());
+    EXPECT_EQ(12u, pc_float->points_.size());
+    for (size_t i = 0; i < pc->points_.size(); i++) {
+        if (std::isnan(pc->points_[i](0))) {
+            EXPECT_TRUE(std::isnan(pc_float->points_[i](0)));
+        } else {
+            ExpectEQ(pc_float->points_[i], pc->points_[i]);
+        }
+    }
+
+    // compare against the pinhole model
+    Matrix4d pose = extrinsic.inverse();
+    for (int v = 0, idx = 0; v < 5; v += 2) {
+        for (int u = 0; u < 7; u += 2, idx++) {
+            double z = *float_depth->PointerAt<float>(u, v);
+            if (z > 0) {
+                Vector4d point = pose * Vector4d((u - 3.0) * z / 5.0,
+                                                 (v - 2.0) * z / 6.0, z, 1.0);
+                ExpectEQ(Vector3d(point.head<3>()), pc->points_[idx]);
+            } else {
+                EXPECT_TRUE(std::isnan(pc->points_[idx](0)));
+            }
+        }
+    }
+
+    auto pc_valid = geometry::PointCloud::CreateFromDepthImage(
+            image, intrinsic, extrinsic, 100.0, 400.0, 2, true);
+    auto points_float = geometry::PointCloud::CreateFloatPointsFromDepthImage(
+            image, intrinsic, extrinsic, 100.0, 400.0, 2, true);
+    EXPECT_EQ(pc_valid->points_.size(), points_float.size());
+    for (size_t i = 0; i < points_float.size(); i++) {
+        ExpectEQ(pc_valid->points_[i], Vector3d(points_float[i].cast<double>()),
+                 1e-6 * pc_valid->points_[i].norm());
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Test CreatePointCloudFromRGBDImage for the following configurations:
 // index | color_num_of_channels | color_bytes_per_channel
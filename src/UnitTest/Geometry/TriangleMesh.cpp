@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cmath>
+#include <limits>
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -640,6 +643,43 @@ TEST(TriangleMesh, Purge) {
     ExpectEQ(ref_triangle_normals, tm.triangle_normals_);
 }
 
+TEST(TriangleMesh, CleanMesh) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0},
+                      {1, 0, 0}, {5, 5, 5}, {1, 1, 0}};
+    mesh.vertex_colors_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0},
+                           {0, 0, 1}, {1, 1, 1}, {1, 1, 0}};
+    // Triangle 1 duplicates triangle 0 after merging vertex 3 into vertex 1,
+    // triangle 2 becomes degenerate and triangle 4 is a rotation of
+    // triangle 3. Vertex 4 is unreferenced.
+    mesh.triangles_ = {{0, 1, 2}, {3, 2, 0}, {1, 3, 2}, {1, 5, 2}, {2, 1, 5}};
+    mesh.triangle_material_ids_ = {0, 1, 2, 3, 4};
+    for (int tidx = 0; tidx < 5; ++tidx) {
+        for (int i = 0; i < 3; ++i) {
+            mesh.triangle_uvs_.push_back(Eigen::Vector2d(tidx, i));
+        }
+    }
+    mesh.ComputeAdjacencyList();
+
+    geometry::TriangleMesh ref = mesh;
+    ref.RemoveDuplicatedVertices();
+    ref.RemoveDegenerateTriangles();
+    ref.RemoveDuplicatedTriangles();
+    ref.RemoveUnreferencedVertices();
+
+    mesh.CleanMesh();
+    ExpectEQ(mesh.vertices_, ref.vertices_);
+    ExpectEQ(mesh.vertex_colors_, ref.vertex_colors_);
+    EXPECT_EQ(mesh.vertex_colors_.size(), 4u);
+    ExpectEQ(mesh.triangles_, ref.triangles_);
+    EXPECT_EQ(mesh.triangles_.size(), 2u);
+    EXPECT_EQ(mesh.adjacency_list_, ref.adjacency_list_);
+    ExpectEQ(mesh.triangle_material_ids_, std::vector<int>({0, 3}));
+    ExpectEQ(mesh.triangle_uvs_,
+             std::vector<Eigen::Vector2d>({{0, 0}, {0, 1}, {0, 2},
+                                           {3, 0}, {3, 1}, {3, 2}}));
+}
+
 TEST(TriangleMesh, MergeCloseVertices) {
     geometry::TriangleMesh mesh;
     mesh.vertices_ = {{0.000000, 0.000000, 0.000000},
@@ -693,6 +733,43 @@ TEST(TriangleMesh, MergeCloseVertices) {
     ExpectEQ(mesh, ref);
 }
 
+TEST(TriangleMesh, MergeCloseVerticesNotTransitive) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {0.6, 0, 0}, {1.2, 0, 0}, {1.2, 0.1, 0}};
+    mesh.triangles_ = {{0, 1, 3}, {1, 2, 3}};
+    mesh.ComputeAdjacencyList();
+
+    // Vertex 1 is merged into vertex 0, vertex 2 is too far from vertex 0
+    // and absorbs vertex 3 instead.
+    mesh.MergeCloseVertices(1);
+    std::vector<Eigen::Vector3d> ref_vertices = {{0.3, 0, 0}, {1.2, 0.05, 0}};
+    std::vector<Eigen::Vector3i> ref_triangles = {{0, 0, 1}, {0, 1, 1}};
+    ExpectEQ(mesh.vertices_, ref_vertices);
+    ExpectEQ(mesh.triangles_, ref_triangles);
+    EXPECT_EQ(mesh.adjacency_list_.size(), 2u);
+}
+
+TEST(TriangleMesh, MergeCloseVerticesNonFinite) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0},   {nan, 0, 0},  {0.1, 0, 0}, {nan, 0, 0},
+                      {inf, 0, 0}, {1e300, 0, 0}, {1e300, 0, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {3, 4, 5}, {6, 0, 1}};
+
+    // non-finite vertices are never merged, far vertices still are
+    mesh.MergeCloseVertices(0.5);
+    ASSERT_EQ(mesh.vertices_.size(), 5u);
+    ExpectEQ(mesh.vertices_[0], Eigen::Vector3d(0.05, 0, 0));
+    EXPECT_TRUE(std::isnan(mesh.vertices_[1](0)));
+    EXPECT_TRUE(std::isnan(mesh.vertices_[2](0)));
+    EXPECT_EQ(mesh.vertices_[3](0), inf);
+    EXPECT_EQ(mesh.vertices_[4](0), 1e300);
+    std::vector<Eigen::Vector3i> ref_triangles = {
+            {0, 1, 0}, {2, 3, 4}, {4, 0, 1}};
+    ExpectEQ(mesh.triangles_, ref_triangles);
+}
+
 TEST(TriangleMesh, SamplePointsUniformly) {
     auto mesh_empty = geometry::TriangleMesh();
     EXPECT_THROW(mesh_empty.SamplePointsUniformly(100), std::runtime_error);
@@ -751,6 +828,52 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+TEST(TriangleMesh, SamplePointsUniformlySeed) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    size_t n_points = 1000;
+
+    auto pcd0 = mesh->SamplePointsUniformly(n_points, false, 42);
+    auto pcd1 = mesh->SamplePointsUniformly(n_points, false, 42);
+    auto pcd2 = mesh->SamplePointsUniformly(n_points, false, 43);
+    EXPECT_EQ(pcd0->points_.size(), n_points);
+    ExpectEQ(pcd0->points_, pcd1->points_);
+    EXPECT_NE(pcd0->points_[0], pcd2->points_[0]);
+    for (const Vector3d &point : pcd0->points_) {
+        EXPECT_LE(point.norm(), 1.0 + 1e-9);
+    }
+}
+
+TEST(TriangleMesh, SamplePointsPoissonDisk) {
+    auto mesh_empty = geometry::TriangleMesh();
+    EXPECT_THROW(mesh_empty.SamplePointsPoissonDisk(100), std::runtime_error);
+
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    size_t n_points = 500;
+    auto pcd0 = mesh->SamplePointsPoissonDisk(n_points, 5, nullptr, false, 7);
+    auto pcd1 = mesh->SamplePointsPoissonDisk(n_points, 5, nullptr, false, 7);
+    EXPECT_EQ(pcd0->points_.size(), n_points);
+    ExpectEQ(pcd0->points_, pcd1->points_);
+
+    // blue noise has a larger minimal point distance than white noise
+    auto MinDistance = [](const geometry::PointCloud &pcd) {
+        double min_dist2 = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < pcd.points_.size(); ++i) {
+            for (size_t j = i + 1; j < pcd.points_.size(); ++j) {
+                min_dist2 = std::min(
+                        min_dist2,
+                        (pcd.points_[i] - pcd.points_[j]).squaredNorm());
+            }
+        }
+        return std::sqrt(min_dist2);
+    };
+    auto pcd_uniform = mesh->SamplePointsUniformly(n_points, false, 7);
+    EXPECT_GT(MinDistance(*pcd0), 2 * MinDistance(*pcd_uniform));
+
+    // pcl_init with as many points as requested is returned unchanged
+    auto pcd_init = mesh->SamplePointsPoissonDisk(n_points, 1, pcd0);
+    ExpectEQ(pcd_init->points_, pcd0->points_);
+}
+
 TEST(TriangleMesh, FilterSharpen) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -833,6 +956,43 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2);
 }
 
+TEST(TriangleMesh, FilterSmoothSimpleInPlace) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}};
+
+    auto ref = mesh.FilterSmoothSimple(3);
+    mesh.FilterSmoothSimpleInPlace(3);
+    ExpectEQ(mesh.vertices_, ref->vertices_);
+
+    // Only vertex 1 is filtered, its neighbours 0, 2, 4 stay fixed.
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    mesh.FilterSmoothSimpleInPlace(1, geometry::MeshBase::FilterScope::All,
+                                   {1});
+    std::vector<Eigen::Vector3d> ref1 = {
+            {0, 0, 0}, {0.25, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    ExpectEQ(mesh.vertices_, ref1);
+}
+
+TEST(TriangleMesh, FilterSmoothTaubinInPlace) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}};
+    mesh.vertex_colors_ = {
+            {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 0}, {0, 1, 1}};
+    auto colors = mesh.vertex_colors_;
+
+    mesh.FilterSmoothTaubinInPlace(1, 0.5, -0.53,
+                                   geometry::MeshBase::FilterScope::Vertex);
+    std::vector<Eigen::Vector3d> ref1 = {{0, 0, 0},
+                                         {0.765, 0, 0},
+                                         {0, 0.765, 0},
+                                         {-0.765, 0, 0},
+                                         {0, -0.765, 0}};
+    ExpectEQ(mesh.vertices_, ref1);
+    ExpectEQ(mesh.vertex_colors_, colors);
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1125,6 +1285,28 @@ TEST(TriangleMesh, ClusterConnectedTriangles) {
     EXPECT_EQ(cluster_area, gt_cluster_area);
 }
 
+TEST(TriangleMesh, ClusterConnectedTrianglesInterleaved) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_.resize(10);
+    for (size_t vidx = 0; vidx < mesh.vertices_.size(); ++vidx) {
+        mesh.vertices_[vidx] = Vector3d(double(vidx % 3), double(vidx / 3), 0);
+    }
+    // triangles 0 and 1 are only connected through triangle 3
+    mesh.triangles_ = {{0, 1, 2}, {2, 3, 5}, {7, 8, 9},
+                       {1, 2, 3}, {8, 9, 4}, {6, 7, 9}};
+
+    std::vector<int> clusters;
+    std::vector<size_t> cluster_n_triangles;
+    std::vector<double> cluster_area;
+    std::tie(clusters, cluster_n_triangles, cluster_area) =
+            mesh.ClusterConnectedTriangles();
+
+    EXPECT_EQ(clusters, std::vector<int>({0, 0, 1, 0, 1, 1}));
+    EXPECT_EQ(cluster_n_triangles, std::vector<size_t>({3, 3}));
+    EXPECT_NEAR(cluster_area[0] + cluster_area[1], mesh.GetSurfaceArea(),
+                1e-12);
+}
+
 TEST(TriangleMesh, RemoveTrianglesByMask) {
     geometry::TriangleMesh mesh_in;
     geometry::TriangleMesh mesh_gt;
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/AsyncWriter.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(AsyncWriter, WriteGeometries) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    Rand(pcd.points_, Zero3d, Eigen::Vector3d(1, 1, 1), 0);
+    pcd.colors_.resize(1000);
+    Rand(pcd.colors_, Zero3d, Eigen::Vector3d(1, 1, 1), 1);
+    const geometry::PointCloud pcd_gt = pcd;
+
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_.resize(100);
+    Rand(mesh->vertices_, Zero3d, Eigen::Vector3d(1, 1, 1), 2);
+    mesh->triangles_.resize(200);
+    Rand(mesh->triangles_, Eigen::Vector3i(0, 0, 0),
+         Eigen::Vector3i(99, 99, 99), 3);
+
+    geometry::Image image;
+    image.Prepare(64, 48, 3, 1);
+    Rand(image.data_, 0, 255, 4);
+    const geometry::Image image_gt = image;
+
+    std::vector<std::future<bool>> results;
+    {
+        io::AsyncWriter writer(2, 1);
+        results.push_back(writer.WritePointCloud("tmp.ply", pcd));
+        results.push_back(writer.WriteTriangleMesh("tmp_mesh.ply", mesh));
+        results.push_back(writer.WriteImage("tmp.png", image));
+        // the snapshots are taken by the calls
+        pcd.points_.clear();
+        std::fill(image.data_.begin(), image.data_.end(), 0);
+        results.push_back(writer.WriteImage("tmp.unknown", image));
+        writer.Wait();
+        EXPECT_EQ(0u, writer.GetNumPending());
+    }
+    EXPECT_TRUE(results[0].get());
+    EXPECT_TRUE(results[1].get());
+    EXPECT_TRUE(results[2].get());
+    EXPECT_FALSE(results[3].get());
+
+    geometry::PointCloud pcd_read;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.ply", pcd_read));
+    ExpectEQ(pcd_gt.points_, pcd_read.points_);
+    geometry::TriangleMesh mesh_read;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_mesh.ply", mesh_read));
+    ExpectEQ(mesh->triangles_, mesh_read.triangles_);
+    geometry::Image image_read;
+    EXPECT_TRUE(io::ReadImage("tmp.png", image_read));
+    EXPECT_EQ(image_gt.data_, image_read.data_);
+    std::remove("tmp.ply");
+    std::remove("tmp_mesh.ply");
+    std::remove("tmp.png");
+}
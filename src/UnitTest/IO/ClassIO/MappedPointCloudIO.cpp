@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <numeric>
+
+#include "Open3D/IO/ClassIO/MappedPointCloudIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::PointCloud CreatePointCloud() {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    pcd.normals_.resize(1000);
+    pcd.colors_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -2, 0), Eigen::Vector3d(3, 2, 1), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         1);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 2);
+    return pcd;
+}
+
+void ExpectPointCloudEQ(const geometry::PointCloud &expected,
+                        const geometry::PointCloud &actual) {
+    ExpectEQ(expected.points_, actual.points_);
+    ExpectEQ(expected.normals_, actual.normals_);
+    ExpectEQ(expected.colors_, actual.colors_);
+}
+
+/// Streams over a mapped file and compares with the loaded point cloud.
+void TestMappedPointCloud(const std::string &filename) {
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloud(filename, pcd));
+
+    io::MappedPointCloud mapped(64);
+    EXPECT_TRUE(mapped.Open(filename));
+    EXPECT_EQ(mapped.GetNumPoints(), pcd.points_.size());
+    EXPECT_TRUE(mapped.HasNormals());
+    EXPECT_TRUE(mapped.HasColors());
+
+    geometry::PointCloud chunk;
+    std::vector<size_t> indices(50);
+    std::iota(indices.begin(), indices.end(), 100);
+    EXPECT_TRUE(mapped.ReadChunk(100, 50, chunk));
+    ExpectPointCloudEQ(*pcd.SelectByIndex(indices), chunk);
+    EXPECT_TRUE(mapped.ReadChunk(990, 50, chunk));
+    EXPECT_EQ(chunk.points_.size(), 10u);
+    ExpectEQ(pcd.points_.back(), chunk.points_.back());
+    EXPECT_FALSE(mapped.ReadChunk(1000, 1, chunk));
+
+    auto bbox = pcd.GetAxisAlignedBoundingBox();
+    auto mapped_bbox = mapped.GetAxisAlignedBoundingBox();
+    ExpectEQ(bbox.min_bound_, mapped_bbox.min_bound_);
+    ExpectEQ(bbox.max_bound_, mapped_bbox.max_bound_);
+
+    geometry::AxisAlignedBoundingBox crop_box(Eigen::Vector3d(0, -1, 0.25),
+                                              Eigen::Vector3d(2, 1, 0.75));
+    ExpectPointCloudEQ(*pcd.Crop(crop_box), *mapped.Crop(crop_box));
+    ExpectPointCloudEQ(*pcd.VoxelDownSample(0.5),
+                       *mapped.VoxelDownSample(0.5));
+
+    mapped.Close();
+    EXPECT_FALSE(mapped.IsOpened());
+    EXPECT_EQ(mapped.GetNumPoints(), 0u);
+}
+
+}  // unnamed namespace
+
+TEST(MappedPointCloudIO, PLY) {
+    EXPECT_TRUE(io::WritePointCloud("tmp.ply", CreatePointCloud()));
+    TestMappedPointCloud("tmp.ply");
+    std::remove("tmp.ply");
+}
+
+TEST(MappedPointCloudIO, PCD) {
+    EXPECT_TRUE(io::WritePointCloud("tmp.pcd", CreatePointCloud()));
+    TestMappedPointCloud("tmp.pcd");
+    std::remove("tmp.pcd");
+}
+
+TEST(MappedPointCloudIO, Empty) {
+    // the writers refuse empty point clouds
+    FILE *file = fopen("tmp.ply", "wb");
+    fputs("ply\nformat binary_little_endian 1.0\nelement vertex 0\n"
+          "property double x\nproperty double y\nproperty double z\n"
+          "end_header\n",
+          file);
+    fclose(file);
+
+    io::MappedPointCloud mapped;
+    EXPECT_TRUE(mapped.Open("tmp.ply"));
+    EXPECT_EQ(mapped.GetNumPoints(), 0u);
+    geometry::PointCloud chunk;
+    EXPECT_FALSE(mapped.ReadChunk(0, 1, chunk));
+    geometry::AxisAlignedBoundingBox crop_box(Eigen::Vector3d(0, 0, 0),
+                                              Eigen::Vector3d(1, 1, 1));
+    EXPECT_TRUE(mapped.Crop(crop_box)->IsEmpty());
+    mapped.Close();
+    std::remove("tmp.ply");
+}
+
+TEST(MappedPointCloudIO, Unsupported) {
+    io::MappedPointCloud mapped;
+    EXPECT_TRUE(io::WritePointCloud("tmp.ply", CreatePointCloud(), true));
+    EXPECT_FALSE(mapped.Open("tmp.ply"));
+    EXPECT_TRUE(io::WritePointCloud("tmp.pcd", CreatePointCloud(), false,
+                                    true));
+    EXPECT_FALSE(mapped.Open("tmp.pcd"));
+    EXPECT_TRUE(io::WritePointCloud("tmp.xyz", CreatePointCloud()));
+    EXPECT_FALSE(mapped.Open("tmp.xyz"));
+    EXPECT_FALSE(mapped.IsOpened());
+    std::remove("tmp.ply");
+    std::remove("tmp.pcd");
+    std::remove("tmp.xyz");
+}
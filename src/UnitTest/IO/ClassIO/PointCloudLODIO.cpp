@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/MappedPointCloudIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/PointCloudLODIO.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::PointCloud CreatePointCloud() {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(50000);
+    pcd.normals_.resize(50000);
+    pcd.colors_.resize(50000);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -2, 0), Eigen::Vector3d(3, 2, 1), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         1);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 2);
+    // a dense cluster that is split deeper than the rest
+    for (size_t i = 0; i < 10000; i++) {
+        pcd.points_[i] = pcd.points_[i] * 0.01;
+    }
+    return pcd;
+}
+
+std::vector<Eigen::Vector3d> SortPoints(std::vector<Eigen::Vector3d> points) {
+    std::sort(points.begin(), points.end(),
+              [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                  return std::lexicographical_compare(a.data(), a.data() + 3,
+                                                      b.data(), b.data() + 3);
+              });
+    return points;
+}
+
+void RemovePointCloudLOD(const std::string &directory) {
+    io::PointCloudLODIndex index;
+    if (io::ReadPointCloudLODIndex(directory, index)) {
+        for (const auto &node : index.nodes_) {
+            utility::filesystem::RemoveFile(
+                    directory + "/" + index.GetNodeFileName(node.name_));
+        }
+    }
+    utility::filesystem::RemoveFile(directory + "/lod.json");
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+}  // unnamed namespace
+
+TEST(PointCloudLODIO, WriteReadPointCloudLOD) {
+    geometry::PointCloud pcd = CreatePointCloud();
+    // small chunks, so that the upper nodes are sampled from several chunks
+    io::PointCloudLODOption option(1000, 16, 16, 5000);
+    EXPECT_TRUE(io::WritePointCloudLOD("tmp_lod", pcd, option));
+    EXPECT_FALSE(utility::filesystem::DirectoryExists("tmp_lod/tmp"));
+
+    io::PointCloudLODIndex index;
+    EXPECT_TRUE(io::ReadPointCloudLODIndex("tmp_lod", index));
+    EXPECT_EQ(index.num_points_, pcd.points_.size());
+    EXPECT_TRUE(index.has_normals_);
+    EXPECT_TRUE(index.has_colors_);
+    ASSERT_GT(index.nodes_.size(), 9u);
+    EXPECT_EQ(index.nodes_[0].name_, "r");
+    size_t num_points = 0;
+    std::vector<std::string> names;
+    for (const auto &node : index.nodes_) {
+        // parents come before their children
+        if (node.name_ != "r") {
+            EXPECT_TRUE(std::find(names.begin(), names.end(),
+                                  node.name_.substr(
+                                          0, node.name_.size() - 1)) !=
+                        names.end());
+        }
+        names.push_back(node.name_);
+        num_points += node.num_points_;
+        if (node.num_points_ == 0) {
+            continue;
+        }
+        geometry::PointCloud node_pcd;
+        EXPECT_TRUE(io::ReadPointCloud(
+                "tmp_lod/" + index.GetNodeFileName(node.name_), node_pcd));
+        EXPECT_EQ(node_pcd.points_.size(), node.num_points_);
+        EXPECT_TRUE(node_pcd.HasNormals());
+        EXPECT_TRUE(node_pcd.HasColors());
+        auto bbox = index.GetNodeBoundingBox(node.name_);
+        EXPECT_EQ(bbox.GetPointIndicesWithinBoundingBox(node_pcd.points_)
+                          .size(),
+                  node_pcd.points_.size());
+        if (node.num_points_ > option.max_node_points_) {
+            EXPECT_LE(node.num_points_, 16u * 16u * 16u);
+        }
+    }
+    EXPECT_EQ(num_points, pcd.points_.size());
+    EXPECT_GT(io::PointCloudLODIndex::GetNodeDepth(index.nodes_.back().name_),
+              6);
+
+    // every point is stored in exactly one node
+    geometry::PointCloud lod;
+    EXPECT_TRUE(io::ReadPointCloudLOD("tmp_lod", lod));
+    ExpectEQ(SortPoints(lod.points_), SortPoints(pcd.points_));
+    EXPECT_TRUE(io::ReadPointCloudLOD("tmp_lod", lod, 0));
+    EXPECT_EQ(lod.points_.size(), index.nodes_[0].num_points_);
+    EXPECT_TRUE(io::ReadPointCloudLOD("tmp_lod", lod, 1));
+    EXPECT_GT(lod.points_.size(), index.nodes_[0].num_points_);
+
+    RemovePointCloudLOD("tmp_lod");
+}
+
+TEST(PointCloudLODIO, WriteMappedPointCloudLOD) {
+    geometry::PointCloud pcd = CreatePointCloud();
+    EXPECT_TRUE(io::WritePointCloud("tmp.ply", pcd));
+    io::MappedPointCloud mapped;
+    EXPECT_TRUE(mapped.Open("tmp.ply"));
+    io::PointCloudLODOption option(1000, 16, 16, 5000);
+    EXPECT_TRUE(io::WritePointCloudLOD("tmp_lod", mapped, option));
+    io::PointCloudLODIndex mapped_index;
+    EXPECT_TRUE(io::ReadPointCloudLODIndex("tmp_lod", mapped_index));
+    RemovePointCloudLOD("tmp_lod");
+    mapped.Close();
+    std::remove("tmp.ply");
+
+    EXPECT_TRUE(io::WritePointCloudLOD("tmp_lod", pcd, option));
+    io::PointCloudLODIndex index;
+    EXPECT_TRUE(io::ReadPointCloudLODIndex("tmp_lod", index));
+    RemovePointCloudLOD("tmp_lod");
+    ASSERT_EQ(mapped_index.nodes_.size(), index.nodes_.size());
+    for (size_t i = 0; i < index.nodes_.size(); i++) {
+        EXPECT_EQ(mapped_index.nodes_[i].name_, index.nodes_[i].name_);
+        EXPECT_EQ(mapped_index.nodes_[i].num_points_,
+                  index.nodes_[i].num_points_);
+    }
+}
+
+TEST(PointCloudLODIO, WritePointCloudLODSingleChunk) {
+    geometry::PointCloud pcd = CreatePointCloud();
+    pcd.normals_.clear();
+    pcd.colors_.clear();
+    io::PointCloudLODOption option(1000, 16, 2);
+    EXPECT_TRUE(io::WritePointCloudLOD("tmp_lod", pcd, option));
+    io::PointCloudLODIndex index;
+    EXPECT_TRUE(io::ReadPointCloudLODIndex("tmp_lod", index));
+    EXPECT_FALSE(index.has_normals_);
+    EXPECT_EQ(io::PointCloudLODIndex::GetNodeDepth(index.nodes_.back().name_),
+              2);
+    geometry::PointCloud lod;
+    EXPECT_TRUE(io::ReadPointCloudLOD("tmp_lod", lod));
+    ExpectEQ(SortPoints(lod.points_), SortPoints(pcd.points_));
+    RemovePointCloudLOD("tmp_lod");
+
+    EXPECT_FALSE(io::WritePointCloudLOD("tmp_lod", geometry::PointCloud()));
+    EXPECT_FALSE(io::ReadPointCloudLOD("tmp_lod", lod));
+}
+
+TEST(PointCloudLODIO, WritePointCloudLODFailure) {
+    // the node files cannot be written, the chunk files are left in tmp/
+    io::PointCloudLODOption option(1000, 16, 4, 10000, "unknown");
+    EXPECT_FALSE(io::WritePointCloudLOD("tmp_lod", CreatePointCloud(), option));
+    EXPECT_FALSE(utility::filesystem::DirectoryExists("tmp_lod/tmp"));
+    RemovePointCloudLOD("tmp_lod");
+    EXPECT_FALSE(utility::filesystem::DirectoryExists("tmp_lod"));
+}
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/RGBDImageIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+/// Writes \p num_frames synthetic color and depth images as PNG files and
+/// returns their paths.
+void WriteDataset(int num_frames,
+                  std::vector<std::string> &color_paths,
+                  std::vector<std::string> &depth_paths) {
+    color_paths.clear();
+    depth_paths.clear();
+    for (int i = 0; i < num_frames; i++) {
+        geometry::Image color;
+        color.Prepare(32, 24, 3, 1);
+        Rand(color.data_, 0, 255, i);
+        geometry::Image depth;
+        depth.Prepare(32, 24, 1, 2);
+        for (int v = 0; v < 24; v++) {
+            for (int u = 0; u < 32; u++) {
+                *depth.PointerAt<uint16_t>(u, v) =
+                        uint16_t(500 + 100 * i + 20 * u + v);
+            }
+        }
+        color_paths.push_back("tmp_color_" + std::to_string(i) + ".png");
+        depth_paths.push_back("tmp_depth_" + std::to_string(i) + ".png");
+        EXPECT_TRUE(io::WriteImage(color_paths.back(), color));
+        EXPECT_TRUE(io::WriteImage(depth_paths.back(), depth));
+    }
+}
+
+void RemoveDataset(const std::vector<std::string> &color_paths,
+                   const std::vector<std::string> &depth_paths) {
+    for (size_t i = 0; i < depth_paths.size(); i++) {
+        std::remove(color_paths[i].c_str());
+        std::remove(depth_paths[i].c_str());
+    }
+}
+
+void ExpectFrameEQ(const geometry::RGBDImage &expected,
+                   const geometry::RGBDImage &actual) {
+    EXPECT_EQ(expected.depth_.width_, actual.depth_.width_);
+    EXPECT_EQ(expected.depth_.height_, actual.depth_.height_);
+    ExpectEQ(expected.depth_.data_, actual.depth_.data_);
+    EXPECT_EQ(expected.color_.num_of_channels_,
+              actual.color_.num_of_channels_);
+    ExpectEQ(expected.color_.data_, actual.color_.data_);
+}
+
+}  // unnamed namespace
+
+TEST(RGBDImageIO, ReadRGBDAssociationFile) {
+    FILE *file = fopen("tmp_associations.txt", "w");
+    fprintf(file, "# color depth\n");
+    fprintf(file, "1.0 rgb/1.png 1.1 depth/1.png\n");
+    fprintf(file, "\n");
+    fprintf(file, "2.0\t/data/rgb/2.png 2.1\t/data/depth/2.png\r\n");
+    fclose(file);
+
+    std::vector<std::string> color_paths, depth_paths;
+    EXPECT_TRUE(io::ReadRGBDAssociationFile("tmp_associations.txt",
+                                            color_paths, depth_paths));
+    EXPECT_EQ(std::vector<std::string>({"rgb/1.png", "/data/rgb/2.png"}),
+              color_paths);
+    EXPECT_EQ(std::vector<std::string>({"depth/1.png", "/data/depth/2.png"}),
+              depth_paths);
+
+    file = fopen("tmp_associations.txt", "w");
+    fprintf(file, "color/0.jpg depth/0.png\n");
+    fprintf(file, "color/1.jpg\n");
+    fclose(file);
+    EXPECT_FALSE(io::ReadRGBDAssociationFile("tmp_associations.txt",
+                                             color_paths, depth_paths));
+    std::remove("tmp_associations.txt");
+
+    EXPECT_FALSE(io::ReadRGBDAssociationFile("tmp_missing.txt", color_paths,
+                                             depth_paths));
+}
+
+TEST(RGBDImageIO, RGBDImageLoader) {
+    std::vector<std::string> color_paths, depth_paths;
+    WriteDataset(12, color_paths, depth_paths);
+
+    io::RGBDImageLoader loader(color_paths, depth_paths, 5000.0, 4.0, true, 3,
+                               4);
+    EXPECT_EQ(loader.GetNumFrames(), 12u);
+    for (int i = 0; i < 12; i++) {
+        geometry::Image color, depth;
+        io::ReadImage(color_paths[i], color);
+        io::ReadImage(depth_paths[i], depth);
+        auto expected = geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, 5000.0, 4.0, true);
+
+        EXPECT_FALSE(loader.IsEOF());
+        auto frame = loader.NextFrame();
+        ASSERT_NE(frame, nullptr);
+        ExpectFrameEQ(*expected, *frame);
+        ExpectFrameEQ(*expected, *loader.ReadFrame(i));
+    }
+    EXPECT_TRUE(loader.IsEOF());
+    EXPECT_EQ(loader.NextFrame(), nullptr);
+
+    EXPECT_TRUE(loader.SeekFrame(9));
+    EXPECT_FALSE(loader.IsEOF());
+    ExpectFrameEQ(*loader.ReadFrame(9), *loader.NextFrame());
+    EXPECT_FALSE(loader.SeekFrame(12));
+
+    RemoveDataset(color_paths, depth_paths);
+}
+
+TEST(RGBDImageIO, RGBDImageLoaderDepthOnly) {
+    std::vector<std::string> color_paths, depth_paths;
+    WriteDataset(3, color_paths, depth_paths);
+
+    io::RGBDImageLoader loader(std::vector<std::string>(), depth_paths);
+    for (int i = 0; i < 3; i++) {
+        geometry::Image depth;
+        io::ReadImage(depth_paths[i], depth);
+        auto frame = loader.NextFrame();
+        ASSERT_NE(frame, nullptr);
+        EXPECT_TRUE(frame->color_.IsEmpty());
+        ExpectEQ(depth.ConvertDepthToFloatImage(1000.0, 3.0)->data_,
+                 frame->depth_.data_);
+    }
+    EXPECT_TRUE(loader.IsEOF());
+
+    // A missing image yields an empty frame without stopping the loader.
+    std::remove(depth_paths[0].c_str());
+    io::RGBDImageLoader missing(color_paths, depth_paths);
+    EXPECT_EQ(missing.NextFrame(), nullptr);
+    EXPECT_NE(missing.NextFrame(), nullptr);
+
+    EXPECT_ANY_THROW(io::RGBDImageLoader(color_paths, {depth_paths[0]}));
+
+    RemoveDataset(color_paths, depth_paths);
+}
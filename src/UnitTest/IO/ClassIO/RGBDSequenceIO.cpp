@@ -0,0 +1,247 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/RGBDSequenceIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+/// Frame \p index of a synthetic sequence: a slanted depth ramp with noise
+/// and a random color image, every fourth frame has no color.
+geometry::RGBDImage CreateFrame(int index) {
+    geometry::RGBDImage rgbd;
+    rgbd.depth_.Prepare(64, 48, 1, 2);
+    std::vector<uint8_t> noise(64 * 48);
+    Rand(noise, 0, 7, index);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            *rgbd.depth_.PointerAt<uint16_t>(u, v) =
+                    uint16_t(1000 + 10 * index + 3 * u + v + noise[v * 64 + u]);
+        }
+    }
+    if (index % 4 != 3) {
+        rgbd.color_.Prepare(64, 48, 3, 1);
+        Rand(rgbd.color_.data_, 0, 255, index);
+    }
+    return rgbd;
+}
+
+void ExpectFrameEQ(const geometry::RGBDImage &expected,
+                   const geometry::RGBDImage &actual) {
+    EXPECT_EQ(expected.depth_.width_, actual.depth_.width_);
+    EXPECT_EQ(expected.depth_.height_, actual.depth_.height_);
+    EXPECT_EQ(expected.depth_.bytes_per_channel_,
+              actual.depth_.bytes_per_channel_);
+    ExpectEQ(expected.depth_.data_, actual.depth_.data_);
+    EXPECT_EQ(expected.color_.width_, actual.color_.width_);
+    EXPECT_EQ(expected.color_.num_of_channels_,
+              actual.color_.num_of_channels_);
+    ExpectEQ(expected.color_.data_, actual.color_.data_);
+}
+
+void WriteSequence(const std::string &filename, int num_frames) {
+    io::RGBDSequenceWriter writer;
+    EXPECT_TRUE(writer.Open(filename));
+    for (int i = 0; i < num_frames; i++) {
+        EXPECT_TRUE(writer.WriteFrame(CreateFrame(i)));
+    }
+    EXPECT_EQ(writer.GetNumFrames(), size_t(num_frames));
+    EXPECT_TRUE(writer.Close());
+}
+
+}  // unnamed namespace
+
+TEST(RGBDSequenceIO, WriteReadSequence) {
+    WriteSequence("tmp.o3drgbd", 20);
+
+    io::RGBDSequenceReader reader;
+    EXPECT_TRUE(reader.Open("tmp.o3drgbd"));
+    EXPECT_EQ(reader.GetNumFrames(), 20u);
+    for (int i = 0; i < 20; i++) {
+        EXPECT_FALSE(reader.IsEOF());
+        auto frame = reader.NextFrame();
+        ASSERT_TRUE(frame != nullptr);
+        ExpectFrameEQ(CreateFrame(i), *frame);
+    }
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_TRUE(reader.NextFrame() == nullptr);
+    reader.Close();
+
+    // the depth ramp compresses well
+    FILE *file = fopen("tmp.o3drgbd", "rb");
+    fseek(file, 0, SEEK_END);
+    long file_size = ftell(file);
+    fclose(file);
+    EXPECT_LT(file_size, 20 * 64 * 48 * (2 + 3));
+    std::remove("tmp.o3drgbd");
+}
+
+TEST(RGBDSequenceIO, SeekAndReadFrame) {
+    WriteSequence("tmp.o3drgbd", 12);
+
+    io::RGBDSequenceReader reader(2, 3);
+    EXPECT_TRUE(reader.Open("tmp.o3drgbd"));
+    ExpectFrameEQ(CreateFrame(0), *reader.NextFrame());
+    EXPECT_TRUE(reader.SeekFrame(7));
+    for (int i = 7; i < 12; i++) {
+        ExpectFrameEQ(CreateFrame(i), *reader.NextFrame());
+    }
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_TRUE(reader.SeekFrame(2));
+    ExpectFrameEQ(CreateFrame(2), *reader.NextFrame());
+    EXPECT_FALSE(reader.SeekFrame(12));
+
+    // random access does not move the playback position
+    ExpectFrameEQ(CreateFrame(10), *reader.ReadFrame(10));
+    ExpectFrameEQ(CreateFrame(3), *reader.NextFrame());
+    EXPECT_TRUE(reader.ReadFrame(12) == nullptr);
+
+    // closing with frames still in the queue
+    reader.Close();
+    EXPECT_FALSE(reader.IsOpened());
+    EXPECT_EQ(reader.GetNumFrames(), 0u);
+    std::remove("tmp.o3drgbd");
+}
+
+TEST(RGBDSequenceIO, InterruptedRecording) {
+    const int num_frames = 6;
+    WriteSequence("tmp.o3drgbd", num_frames);
+
+    // drop the frame index and a part of the last frame
+    FILE *file = fopen("tmp.o3drgbd", "rb");
+    std::vector<char> buffer(1 << 20);
+    size_t size = fread(buffer.data(), 1, buffer.size(), file);
+    fclose(file);
+    size -= 24 + 8 * num_frames + 10;
+    file = fopen("tmp.o3drgbd", "wb");
+    fwrite(buffer.data(), 1, size, file);
+    fclose(file);
+
+    io::RGBDSequenceReader reader;
+    EXPECT_TRUE(reader.Open("tmp.o3drgbd"));
+    EXPECT_EQ(reader.GetNumFrames(), size_t(num_frames - 1));
+    for (int i = 0; i < num_frames - 1; i++) {
+        ExpectFrameEQ(CreateFrame(i), *reader.NextFrame());
+    }
+    EXPECT_TRUE(reader.IsEOF());
+    reader.Close();
+    std::remove("tmp.o3drgbd");
+}
+
+TEST(RGBDSequenceIO, CorruptedIndex) {
+    const int num_frames = 6;
+    auto read_all_frames = [&]() {
+        io::RGBDSequenceReader reader;
+        EXPECT_TRUE(reader.Open("tmp.o3drgbd"));
+        EXPECT_EQ(reader.GetNumFrames(), size_t(num_frames));
+        for (int i = 0; i < num_frames; i++) {
+            auto frame = reader.NextFrame();
+            ASSERT_TRUE(frame != nullptr);
+            ExpectFrameEQ(CreateFrame(i), *frame);
+        }
+    };
+    auto patch = [](long offset, uint64_t value) {
+        FILE *file = fopen("tmp.o3drgbd", "r+b");
+        fseek(file, offset, offset < 0 ? SEEK_END : SEEK_SET);
+        fwrite(&value, 8, 1, file);
+        fclose(file);
+    };
+
+    // a frame count whose index size wraps around to the real file size
+    WriteSequence("tmp.o3drgbd", num_frames);
+    patch(-24, (uint64_t(1) << 61) + num_frames);
+    read_all_frames();
+
+    // frame offsets that are not increasing or point past the index, the
+    // frames are recovered by scanning the records
+    WriteSequence("tmp.o3drgbd", num_frames);
+    FILE *file = fopen("tmp.o3drgbd", "rb");
+    fseek(file, -16, SEEK_END);
+    uint64_t index_offset = 0;
+    ASSERT_EQ(fread(&index_offset, 8, 1, file), 1u);
+    fclose(file);
+    patch(long(index_offset + 8 * 3), 16);
+    read_all_frames();
+    WriteSequence("tmp.o3drgbd", num_frames);
+    patch(long(index_offset + 8 * 3), uint64_t(-1));
+    read_all_frames();
+    std::remove("tmp.o3drgbd");
+}
+
+TEST(RGBDSequenceIO, CorruptedFrame) {
+    auto patch = [](long offset, uint32_t value0, uint32_t value1) {
+        const uint32_t values[2] = {value0, value1};
+        FILE *file = fopen("tmp.o3drgbd", "r+b");
+        fseek(file, offset, SEEK_SET);
+        fwrite(values, sizeof(values), 1, file);
+        fclose(file);
+    };
+    // the depth image of the first frame starts after the file header with
+    // its width, height, number of channels and bytes per channel
+    const long record_offset = 16;
+
+    // an image size that overflows int
+    WriteSequence("tmp.o3drgbd", 2);
+    patch(record_offset, 1 << 20, 1 << 20);
+    io::RGBDSequenceReader reader;
+    EXPECT_TRUE(reader.Open("tmp.o3drgbd"));
+    EXPECT_TRUE(reader.NextFrame() == nullptr);
+    ExpectFrameEQ(CreateFrame(1), *reader.NextFrame());
+    EXPECT_TRUE(reader.ReadFrame(0) == nullptr);
+    reader.Close();
+
+    // a size that does not match the stored data and an unsupported number
+    // of bytes per channel
+    WriteSequence("tmp.o3drgbd", 2);
+    patch(record_offset, 64 * 1024, 48);
+    EXPECT_TRUE(reader.Open("tmp.o3drgbd"));
+    EXPECT_TRUE(reader.ReadFrame(0) == nullptr);
+    reader.Close();
+    WriteSequence("tmp.o3drgbd", 2);
+    patch(record_offset + 8, 1, 3);
+    EXPECT_TRUE(reader.Open("tmp.o3drgbd"));
+    EXPECT_TRUE(reader.ReadFrame(0) == nullptr);
+    ExpectFrameEQ(CreateFrame(1), *reader.ReadFrame(1));
+    reader.Close();
+    std::remove("tmp.o3drgbd");
+}
+
+TEST(RGBDSequenceIO, InvalidFile) {
+    FILE *file = fopen("tmp.o3drgbd", "wb");
+    fputs("not a recording", file);
+    fclose(file);
+
+    io::RGBDSequenceReader reader;
+    EXPECT_FALSE(reader.Open("tmp.o3drgbd"));
+    EXPECT_FALSE(reader.IsOpened());
+    EXPECT_FALSE(reader.Open("does_not_exist.o3drgbd"));
+    std::remove("tmp.o3drgbd");
+}
@@ -24,8 +24,70 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <string>
+
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+registration::PoseGraph CreatePoseGraph(size_t num_nodes, size_t num_edges) {
+    registration::PoseGraph pose_graph;
+    std::vector<Eigen::Vector3d> values(num_nodes + num_edges);
+    Rand(values, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    for (size_t i = 0; i < num_nodes; i++) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 1>(0, 3) = values[i];
+        pose(0, 1) = values[i](2);
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(pose));
+    }
+    for (size_t i = 0; i < num_edges; i++) {
+        Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+        transformation.block<3, 1>(0, 3) = values[num_nodes + i];
+        Eigen::Matrix6d information = Eigen::Matrix6d::Identity();
+        information(1, 4) = information(4, 1) = values[num_nodes + i](0);
+        information(0, 5) = information(5, 0) = double(i);
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                int(i % num_nodes), int((i * 7) % num_nodes), transformation,
+                information, i % 3 == 0, 0.5 + values[num_nodes + i](1)));
+    }
+    return pose_graph;
+}
+
+void ExpectPoseGraphEQ(const registration::PoseGraph &expected,
+                       const registration::PoseGraph &actual) {
+    ASSERT_EQ(expected.nodes_.size(), actual.nodes_.size());
+    ASSERT_EQ(expected.edges_.size(), actual.edges_.size());
+    for (size_t i = 0; i < expected.nodes_.size(); i++) {
+        ExpectEQ(expected.nodes_[i].pose_, actual.nodes_[i].pose_, 0.0);
+    }
+    for (size_t i = 0; i < expected.edges_.size(); i++) {
+        const auto &e = expected.edges_[i];
+        const auto &a = actual.edges_[i];
+        EXPECT_EQ(e.source_node_id_, a.source_node_id_);
+        EXPECT_EQ(e.target_node_id_, a.target_node_id_);
+        EXPECT_EQ(e.uncertain_, a.uncertain_);
+        EXPECT_EQ(e.confidence_, a.confidence_);
+        ExpectEQ(e.transformation_, a.transformation_, 0.0);
+        ExpectEQ(e.information_, a.information_, 0.0);
+    }
+}
+
+long GetFileSize(const std::string &filename) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+}  // unnamed namespace
+
 TEST(FileBIN, DISABLED_ReadMatrixXdFromBINFile) { unit_test::NotImplemented(); }
 
 TEST(FileBIN, DISABLED_WriteMatrixXdToBINFile) { unit_test::NotImplemented(); }
@@ -33,3 +95,79 @@ TEST(FileBIN, DISABLED_WriteMatrixXdToBINFile) { unit_test::NotImplemented(); }
 TEST(FileBIN, DISABLED_ReadFeatureFromBIN) { unit_test::NotImplemented(); }
 
 TEST(FileBIN, DISABLED_WriteFeatureToBIN) { unit_test::NotImplemented(); }
+
+TEST(FileBIN, WritePoseGraphToBIN) {
+    // more records than one write batch
+    registration::PoseGraph pose_graph = CreatePoseGraph(100, 5000);
+    EXPECT_TRUE(io::WritePoseGraph("tmp.bin", pose_graph));
+    // symmetric information matrices are stored as their upper triangle
+    EXPECT_EQ(GetFileSize("tmp.bin"),
+              32 + 100 * 16 * 8 + 5000 * (24 + (16 + 21) * 8));
+    registration::PoseGraph pose_graph_read;
+    EXPECT_TRUE(io::ReadPoseGraph("tmp.bin", pose_graph_read));
+    ExpectPoseGraphEQ(pose_graph, pose_graph_read);
+
+    pose_graph.edges_[10].information_(2, 3) = 0.25;
+    EXPECT_TRUE(io::WritePoseGraph("tmp.bin", pose_graph));
+    EXPECT_EQ(GetFileSize("tmp.bin"),
+              32 + 100 * 16 * 8 + 5000 * (24 + (16 + 36) * 8));
+    EXPECT_TRUE(io::ReadPoseGraph("tmp.bin", pose_graph_read));
+    ExpectPoseGraphEQ(pose_graph, pose_graph_read);
+
+    EXPECT_TRUE(io::WritePoseGraph("tmp.bin", registration::PoseGraph()));
+    EXPECT_TRUE(io::ReadPoseGraph("tmp.bin", pose_graph_read));
+    EXPECT_TRUE(pose_graph_read.nodes_.empty());
+    EXPECT_TRUE(pose_graph_read.edges_.empty());
+    std::remove("tmp.bin");
+}
+
+TEST(FileBIN, ReadPoseGraphFromBIN) {
+    registration::PoseGraph pose_graph = CreatePoseGraph(10, 20);
+    EXPECT_TRUE(io::WritePoseGraphToBIN("tmp.bin", pose_graph));
+    long size = GetFileSize("tmp.bin");
+    std::vector<char> data(size);
+    FILE *file = fopen("tmp.bin", "rb");
+    EXPECT_EQ(fread(data.data(), 1, size, file), size_t(size));
+    fclose(file);
+
+    // truncated file
+    file = fopen("tmp.bin", "wb");
+    fwrite(data.data(), 1, size - 8, file);
+    fclose(file);
+    registration::PoseGraph pose_graph_read;
+    EXPECT_FALSE(io::ReadPoseGraphFromBIN("tmp.bin", pose_graph_read));
+
+    // a trajectory is not a pose graph
+    camera::PinholeCameraTrajectory trajectory;
+    trajectory.parameters_.resize(2);
+    EXPECT_TRUE(io::WritePinholeCameraTrajectoryToBIN("tmp.bin", trajectory));
+    EXPECT_FALSE(io::ReadPoseGraphFromBIN("tmp.bin", pose_graph_read));
+    std::remove("tmp.bin");
+}
+
+TEST(FileBIN, WritePinholeCameraTrajectoryToBIN) {
+    camera::PinholeCameraTrajectory trajectory;
+    registration::PoseGraph pose_graph = CreatePoseGraph(5000, 0);
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(640, 480, 525.0 + i, 525.0,
+                                            319.5, 239.5);
+        parameters.extrinsic_ = pose_graph.nodes_[i].pose_;
+        trajectory.parameters_.push_back(parameters);
+    }
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory("tmp.bin", trajectory));
+    camera::PinholeCameraTrajectory trajectory_read;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory("tmp.bin", trajectory_read));
+    ASSERT_EQ(trajectory.parameters_.size(),
+              trajectory_read.parameters_.size());
+    for (size_t i = 0; i < trajectory.parameters_.size(); i++) {
+        const auto &e = trajectory.parameters_[i];
+        const auto &a = trajectory_read.parameters_[i];
+        EXPECT_EQ(e.intrinsic_.width_, a.intrinsic_.width_);
+        EXPECT_EQ(e.intrinsic_.height_, a.intrinsic_.height_);
+        ExpectEQ(e.intrinsic_.intrinsic_matrix_,
+                 a.intrinsic_.intrinsic_matrix_, 0.0);
+        ExpectEQ(e.extrinsic_, a.extrinsic_, 0.0);
+    }
+    std::remove("tmp.bin");
+}
@@ -0,0 +1,246 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::PointCloud CreatePointCloud(size_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.normals_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    Rand(pcd.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pcd.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 2);
+    for (auto &normal : pcd.normals_) {
+        normal.normalize();
+    }
+    // sorted like a scan, so that the chunks are spatially separated
+    std::sort(pcd.points_.begin(), pcd.points_.end(),
+              [](const Eigen::Vector3d &p0, const Eigen::Vector3d &p1) {
+                  return p0(0) < p1(0);
+              });
+    return pcd;
+}
+
+long GetFileSize(const std::string &filename) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+/// Writes an o3dpc file of \p num_chunks chunks with \p num_entries index
+/// entries that all claim a full chunk of points in an empty record, followed
+/// by \p padding bytes.
+void WriteCorruptedO3DPC(const std::string &filename,
+                         uint64_t num_chunks,
+                         uint64_t num_entries,
+                         size_t padding,
+                         uint64_t index_offset) {
+    const char magic[8] = {'O', '3', 'D', 'P', 'C', 'O', 'L', 'S'};
+    const uint32_t version = 1;
+    const uint32_t flags = 0;
+    const uint64_t num_points = num_chunks << 16;
+    const double position_step = 0.0;
+    FILE *file = fopen(filename.c_str(), "wb");
+    fwrite(magic, 1, 8, file);
+    fwrite(&version, sizeof(version), 1, file);
+    fwrite(&flags, sizeof(flags), 1, file);
+    fwrite(&num_points, sizeof(num_points), 1, file);
+    fwrite(&num_chunks, sizeof(num_chunks), 1, file);
+    fwrite(&position_step, sizeof(position_step), 1, file);
+    for (uint64_t i = 0; i < num_entries; i++) {
+        // offset, size and number of points followed by the bounding box
+        const uint64_t entry[9] = {40, 0, 1 << 16, 0, 0, 0, 0, 0, 0};
+        fwrite(entry, sizeof(entry), 1, file);
+    }
+    fwrite(std::string(padding, '\0').data(), 1, padding, file);
+    fwrite(&index_offset, sizeof(index_offset), 1, file);
+    fwrite("O3DPCIDX", 1, 8, file);
+    fclose(file);
+}
+
+}  // unnamed namespace
+
+TEST(FileO3DPC, WriteReadLossless) {
+    geometry::PointCloud pcd_gt = CreatePointCloud(150000);
+    EXPECT_TRUE(io::WritePointCloud("tmp.o3dpc", pcd_gt));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.o3dpc", pcd));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 0.0);
+    ExpectEQ(pcd.normals_, pcd_gt.normals_, 0.0);
+    ExpectEQ(pcd.colors_, pcd_gt.colors_, 0.0);
+
+    pcd_gt.normals_.clear();
+    pcd_gt.colors_.clear();
+    EXPECT_TRUE(io::WritePointCloudToO3DPC("tmp.o3dpc", pcd_gt));
+    EXPECT_TRUE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 0.0);
+    EXPECT_FALSE(pcd.HasNormals());
+    EXPECT_FALSE(pcd.HasColors());
+
+    EXPECT_TRUE(
+            io::WritePointCloudToO3DPC("tmp.o3dpc", geometry::PointCloud()));
+    EXPECT_TRUE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    EXPECT_TRUE(pcd.IsEmpty());
+    std::remove("tmp.o3dpc");
+}
+
+TEST(FileO3DPC, WriteReadCompressed) {
+    geometry::PointCloud pcd_gt = CreatePointCloud(150000);
+    EXPECT_TRUE(io::WritePointCloudToO3DPC("tmp.o3dpc", pcd_gt, false, true));
+    EXPECT_TRUE(io::WritePointCloudToPLY("tmp.ply", pcd_gt, false, false));
+    EXPECT_LT(GetFileSize("tmp.o3dpc") * 3, GetFileSize("tmp.ply"));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    ASSERT_EQ(pcd.points_.size(), pcd_gt.points_.size());
+    const double position_precision = 20.0 / double(1 << 21);
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        ExpectEQ(pcd.points_[i], pcd_gt.points_[i],
+                 position_precision * 1.000001);
+        EXPECT_LE((pcd.normals_[i] - pcd_gt.normals_[i]).norm(), 1e-4);
+        ExpectEQ(pcd.colors_[i], pcd_gt.colors_[i], 0.5 / 255.0 + 1e-12);
+    }
+    std::remove("tmp.o3dpc");
+    std::remove("tmp.ply");
+}
+
+TEST(FileO3DPC, WriteReadCompressedNaN) {
+    // organized scans mark missing points with NaN, a chunk with NaN points
+    // is stored losslessly
+    geometry::PointCloud pcd_gt = CreatePointCloud(1000);
+    pcd_gt.points_[500](1) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(io::WritePointCloudToO3DPC("tmp.o3dpc", pcd_gt, false, true));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    ASSERT_EQ(pcd.points_.size(), pcd_gt.points_.size());
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        if (i == 500) {
+            EXPECT_EQ(pcd.points_[i](0), pcd_gt.points_[i](0));
+            EXPECT_TRUE(std::isnan(pcd.points_[i](1)));
+            EXPECT_EQ(pcd.points_[i](2), pcd_gt.points_[i](2));
+        } else {
+            ExpectEQ(pcd.points_[i], pcd_gt.points_[i], 0.0);
+        }
+    }
+    std::remove("tmp.o3dpc");
+}
+
+TEST(FileO3DPC, WriteQuantizedPointCloudToO3DPC) {
+    geometry::PointCloud pcd_gt = CreatePointCloud(1000);
+    EXPECT_TRUE(io::WriteQuantizedPointCloudToO3DPC("tmp.o3dpc", pcd_gt, 0.01));
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    ASSERT_EQ(pcd.points_.size(), pcd_gt.points_.size());
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        ExpectEQ(pcd.points_[i], pcd_gt.points_[i], 0.01 * 1.000001);
+    }
+
+    // positions that do not fit the grid are stored losslessly
+    pcd_gt.points_[0](0) = 1e300;
+    EXPECT_TRUE(io::WriteQuantizedPointCloudToO3DPC("tmp.o3dpc", pcd_gt, 0.01));
+    EXPECT_TRUE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 0.0);
+    std::remove("tmp.o3dpc");
+}
+
+TEST(FileO3DPC, CropPointCloudFromO3DPC) {
+    geometry::PointCloud pcd_gt = CreatePointCloud(300000);
+    EXPECT_TRUE(io::WritePointCloudToO3DPC("tmp.o3dpc", pcd_gt));
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(-9.5, -3.0, 0.0),
+                                          Eigen::Vector3d(-8.0, 5.0, 7.0));
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::CropPointCloudFromO3DPC("tmp.o3dpc", bbox, pcd));
+    auto cropped = pcd_gt.Crop(bbox);
+    EXPECT_FALSE(cropped->IsEmpty());
+    ExpectEQ(pcd.points_, cropped->points_, 0.0);
+    ExpectEQ(pcd.normals_, cropped->normals_, 0.0);
+    ExpectEQ(pcd.colors_, cropped->colors_, 0.0);
+
+    // chunks outside of the bounding box are not decoded, so a damaged last
+    // chunk only breaks reading the whole file
+    FILE *file = fopen("tmp.o3dpc", "r+b");
+    uint64_t index_offset, chunk_offset;
+    fseek(file, -16, SEEK_END);
+    ASSERT_EQ(fread(&index_offset, sizeof(uint64_t), 1, file), 1u);
+    // the index has 5 entries of 72 bytes that start with the chunk offset
+    fseek(file, long(index_offset + 4 * 72), SEEK_SET);
+    ASSERT_EQ(fread(&chunk_offset, sizeof(uint64_t), 1, file), 1u);
+    fseek(file, long(chunk_offset), SEEK_SET);
+    fwrite(std::string(16, '\xff').data(), 1, 16, file);
+    fclose(file);
+    EXPECT_TRUE(io::CropPointCloudFromO3DPC("tmp.o3dpc", bbox, pcd));
+    ExpectEQ(pcd.points_, cropped->points_, 0.0);
+    EXPECT_FALSE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    std::remove("tmp.o3dpc");
+}
+
+TEST(FileO3DPC, ReadInvalidFile) {
+    geometry::PointCloud pcd;
+    EXPECT_FALSE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    EXPECT_TRUE(io::WritePointCloudToPLY("tmp.o3dpc", CreatePointCloud(10),
+                                         false, false));
+    EXPECT_FALSE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    std::remove("tmp.o3dpc");
+}
+
+TEST(FileO3DPC, ReadCorruptedIndex) {
+    geometry::PointCloud pcd;
+    // a file of 72000 bytes with an index of 72000 bytes, index_offset + index
+    // size wraps around to the file size
+    WriteCorruptedO3DPC("tmp.o3dpc", 1000, 999, 16, uint64_t(0) - 16);
+    EXPECT_EQ(GetFileSize("tmp.o3dpc"), 72000);
+    EXPECT_FALSE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    EXPECT_FALSE(io::ReadPointCloud("tmp.o3dpc", pcd));
+    // records too small for their number of points
+    WriteCorruptedO3DPC("tmp.o3dpc", 1000, 1000, 0, 40);
+    EXPECT_FALSE(io::ReadPointCloudFromO3DPC("tmp.o3dpc", pcd));
+    EXPECT_TRUE(pcd.IsEmpty());
+    std::remove("tmp.o3dpc");
+}
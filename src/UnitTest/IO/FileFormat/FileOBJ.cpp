@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <fstream>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJ) {
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh(
+            std::string(TEST_DATA_DIR) + "/crate/crate.obj", mesh, false));
+    EXPECT_EQ(mesh.vertices_.size(), 8u);
+    // six quads
+    EXPECT_EQ(mesh.triangles_.size(), 12u);
+    ExpectEQ(mesh.triangles_[0], Eigen::Vector3i(4, 5, 1));
+    ExpectEQ(mesh.triangles_[1], Eigen::Vector3i(4, 1, 0));
+    EXPECT_EQ(mesh.triangle_uvs_.size(), 36u);
+    ExpectEQ(mesh.triangle_uvs_[5], Eigen::Vector2d(0, 1));
+    EXPECT_FALSE(mesh.HasVertexNormals());
+    EXPECT_FALSE(mesh.HasVertexColors());
+    ASSERT_EQ(mesh.textures_.size(), 1u);
+    EXPECT_FALSE(mesh.textures_[0].IsEmpty());
+    EXPECT_EQ(mesh.triangle_material_ids_,
+              std::vector<int>(mesh.triangles_.size(), 0));
+}
+
+TEST(FileOBJ, WriteReadTriangleMeshFromOBJ) {
+    geometry::TriangleMesh mesh_gt;
+    mesh_gt.vertices_.resize(100);
+    Rand(mesh_gt.vertices_, Zero3d, Eigen::Vector3d(1, 1, 1), 0);
+    for (int i = 0; i < 150; i++) {
+        mesh_gt.triangles_.push_back(
+                Eigen::Vector3i(i % 100, (i + 1) % 100, (i + 2) % 100));
+    }
+    mesh_gt.vertex_normals_.resize(100);
+    Rand(mesh_gt.vertex_normals_, Zero3d, Eigen::Vector3d(1, 1, 1), 2);
+    for (int i = 0; i < 450; i++) {
+        mesh_gt.triangle_uvs_.push_back(
+                Eigen::Vector2d((i % 7) / 7.0, (i % 11) / 11.0));
+    }
+    EXPECT_TRUE(io::WriteTriangleMesh("tmp.obj", mesh_gt));
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.obj", mesh, false));
+    ExpectEQ(mesh.vertices_, mesh_gt.vertices_, 1e-5);
+    ExpectEQ(mesh.triangles_, mesh_gt.triangles_);
+    ExpectEQ(mesh.triangle_uvs_, mesh_gt.triangle_uvs_, 1e-5);
+    ExpectEQ(mesh.vertex_normals_, mesh_gt.vertex_normals_, 1e-5);
+    std::remove("tmp.obj");
+    std::remove("tmp.mtl");
+}
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJChunks) {
+    // several parse chunks, relative indices, polygons, vertex colors,
+    // CRLF line endings and materials selected across chunk boundaries
+    {
+        std::ofstream mtl("tmp.mtl");
+        mtl << "newmtl first\nKd 1 1 1\nnewmtl second\nKd 1 1 1\n";
+        std::ofstream obj("tmp.obj", std::ios::binary);
+        obj << "mtllib tmp.mtl\r\n";
+        for (int i = 0; i < 40000; i++) {
+            if (i == 0) {
+                obj << "usemtl first\r\n";
+            } else if (i == 30000) {
+                obj << "usemtl second\r\n";
+            }
+            for (int j = 0; j < 4; j++) {
+                obj << "v " << i << " " << j << " " << 0.5 << " 0.25 0.5 "
+                    << "0.75\r\n";
+            }
+            obj << "vn 0 0 1\r\n";
+            obj << "f -4//-1 -3//-1 -2//-1 -1//-1\r\n";
+        }
+    }
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.obj", mesh, false));
+    ASSERT_EQ(mesh.vertices_.size(), 160000u);
+    ASSERT_EQ(mesh.triangles_.size(), 80000u);
+    EXPECT_TRUE(mesh.HasVertexColors());
+    EXPECT_TRUE(mesh.HasVertexNormals());
+    EXPECT_FALSE(mesh.HasTriangleUvs());
+    EXPECT_TRUE(mesh.textures_.empty());
+    for (int i = 0; i < 40000; i++) {
+        ExpectEQ(mesh.vertices_[4 * i + 3], Eigen::Vector3d(i, 3, 0.5));
+        ExpectEQ(mesh.triangles_[2 * i],
+                 Eigen::Vector3i(4 * i, 4 * i + 1, 4 * i + 2));
+        ExpectEQ(mesh.triangles_[2 * i + 1],
+                 Eigen::Vector3i(4 * i, 4 * i + 2, 4 * i + 3));
+        EXPECT_EQ(mesh.triangle_material_ids_[2 * i], i < 30000 ? 0 : 1);
+    }
+    ExpectEQ(mesh.vertex_colors_.back(), Eigen::Vector3d(0.25, 0.5, 0.75));
+    ExpectEQ(mesh.vertex_normals_.back(), Eigen::Vector3d(0, 0, 1));
+
+    // out of range index
+    {
+        std::ofstream obj("tmp.obj");
+        obj << "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n";
+    }
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.obj", mesh, false));
+    std::remove("tmp.obj");
+    std::remove("tmp.mtl");
+}
@@ -24,8 +24,49 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <liblzf/lzf.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::PointCloud CreatePointCloud(size_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.normals_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    Rand(pcd.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pcd.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    Rand(pcd.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 2);
+    return pcd;
+}
+
+std::string ReadFile(const std::string &filename) {
+    FILE *file = fopen(filename.c_str(), "rb");
+    std::string data;
+    char buffer[4096];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.append(buffer, size);
+    }
+    fclose(file);
+    return data;
+}
+
+}  // unnamed namespace
+
 TEST(FilePCD, DISABLED_CheckHeader) { unit_test::NotImplemented(); }
 
 TEST(FilePCD, DISABLED_ReadPCDHeader) { unit_test::NotImplemented(); }
@@ -54,4 +95,68 @@ TEST(FilePCD, DISABLED_WritePCDData) { unit_test::NotImplemented(); }
 
 TEST(FilePCD, DISABLED_ReadPointCloudFromPCD) { unit_test::NotImplemented(); }
 
+TEST(FilePCD, WriteReadCompressed) {
+    // several compression blocks and decompression windows
+    geometry::PointCloud pcd_gt = CreatePointCloud(400000);
+    EXPECT_TRUE(io::WritePointCloudToPCD("tmp.pcd", pcd_gt, false, false));
+    geometry::PointCloud pcd_binary;
+    EXPECT_TRUE(io::ReadPointCloudFromPCD("tmp.pcd", pcd_binary));
+
+    EXPECT_TRUE(io::WritePointCloudToPCD("tmp.pcd", pcd_gt, false, true));
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromPCD("tmp.pcd", pcd));
+    ExpectEQ(pcd.points_, pcd_binary.points_, 0.0);
+    ExpectEQ(pcd.normals_, pcd_binary.normals_, 0.0);
+    ExpectEQ(pcd.colors_, pcd_binary.colors_, 0.0);
+    ExpectEQ(pcd.points_, pcd_gt.points_, 1e-5);
+
+    // a truncated file fails
+    std::string data = ReadFile("tmp.pcd");
+    FILE *file = fopen("tmp.pcd", "wb");
+    fwrite(data.data(), 1, data.size() - 100, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPointCloudFromPCD("tmp.pcd", pcd));
+    std::remove("tmp.pcd");
+}
+
+TEST(FilePCD, CompressedLZFStream) {
+    // the data written in parallel blocks is a single LZF stream
+    geometry::PointCloud pcd_gt = CreatePointCloud(300000);
+    pcd_gt.normals_.clear();
+    pcd_gt.colors_.clear();
+    EXPECT_TRUE(io::WritePointCloudToPCD("tmp.pcd", pcd_gt, false, true));
+    std::string data = ReadFile("tmp.pcd");
+    const std::string data_line = "DATA binary_compressed\n";
+    size_t offset = data.find(data_line) + data_line.size();
+    uint32_t sizes[2];
+    memcpy(sizes, data.data() + offset, sizeof(sizes));
+    EXPECT_EQ(offset + sizeof(sizes) + sizes[0], data.size());
+    std::vector<float> fields(sizes[1] / sizeof(float));
+    EXPECT_EQ(lzf_decompress(data.data() + offset + sizeof(sizes), sizes[0],
+                             fields.data(), sizes[1]),
+              sizes[1]);
+    ASSERT_EQ(fields.size(), pcd_gt.points_.size() * 3);
+    for (size_t i = 0; i < pcd_gt.points_.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(fields[j * pcd_gt.points_.size() + i],
+                      float(pcd_gt.points_[i](j)));
+        }
+    }
+
+    // a stream compressed as a single block, as written by PCL
+    std::vector<char> compressed(sizes[1] * 2);
+    sizes[0] = lzf_compress(fields.data(), sizes[1], compressed.data(),
+                            (unsigned int)compressed.size());
+    data.resize(offset);
+    data.append(reinterpret_cast<const char *>(sizes), sizeof(sizes));
+    data.append(compressed.data(), sizes[0]);
+    FILE *file = fopen("tmp.pcd", "wb");
+    fwrite(data.data(), 1, data.size(), file);
+    fclose(file);
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromPCD("tmp.pcd", pcd));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 1e-5);
+    std::remove("tmp.pcd");
+}
+
 TEST(FilePCD, DISABLED_WritePointCloudToPCD) { unit_test::NotImplemented(); }
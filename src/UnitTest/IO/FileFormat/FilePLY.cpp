@@ -24,8 +24,52 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+template <typename T>
+void AppendBytes(std::vector<uint8_t> &data, T value) {
+    uint8_t bytes[sizeof(T)];
+    memcpy(bytes, &value, sizeof(T));
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+void WriteFile(const std::string &filename,
+               const std::string &header,
+               const std::vector<uint8_t> &data) {
+    FILE *file = fopen(filename.c_str(), "wb");
+    fwrite(header.data(), 1, header.size(), file);
+    fwrite(data.data(), 1, data.size(), file);
+    fclose(file);
+}
+
+std::vector<Eigen::Vector3d> QuantizeColors(
+        const std::vector<Eigen::Vector3d> &colors) {
+    std::vector<Eigen::Vector3d> quantized;
+    for (const auto &color : colors) {
+        quantized.push_back(Eigen::Vector3d(uint8_t(color(0) * 255.0),
+                                            uint8_t(color(1) * 255.0),
+                                            uint8_t(color(2) * 255.0)) /
+                            255.0);
+    }
+    return quantized;
+}
+
+}  // unnamed namespace
+
 TEST(FilePLY, DISABLED_ReadVertexCallback) { unit_test::NotImplemented(); }
 
 TEST(FilePLY, DISABLED_AdvanceConsoleProgress) { unit_test::NotImplemented(); }
@@ -45,3 +89,145 @@ TEST(FilePLY, DISABLED_ReadTriangleMeshFromPLY) { unit_test::NotImplemented(); }
 TEST(FilePLY, DISABLED_WriteTriangleMeshToPLY) { unit_test::NotImplemented(); }
 
 TEST(FilePLY, DISABLED_ResetConsoleProgress) { unit_test::NotImplemented(); }
+
+TEST(FilePLY, WriteReadBinaryPointCloud) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(1000);
+    pcd_gt.normals_.resize(1000);
+    pcd_gt.colors_.resize(1000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-10, -10, -10),
+         Eigen::Vector3d(10, 10, 10), 0);
+    Rand(pcd_gt.normals_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 1);
+    Rand(pcd_gt.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1),
+         2);
+
+    EXPECT_TRUE(io::WritePointCloudToPLY("tmp.ply", pcd_gt, false));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloudFromPLY("tmp.ply", pcd_test, false));
+    ExpectEQ(pcd_gt.points_, pcd_test.points_, 0.0);
+    ExpectEQ(pcd_gt.normals_, pcd_test.normals_, 0.0);
+    ExpectEQ(QuantizeColors(pcd_gt.colors_), pcd_test.colors_, 0.0);
+
+    // ASCII files are read by rply.
+    EXPECT_TRUE(io::WritePointCloudToPLY("tmp.ply", pcd_gt, true));
+    geometry::PointCloud pcd_ascii;
+    EXPECT_TRUE(io::ReadPointCloudFromPLY("tmp.ply", pcd_ascii, false));
+    ExpectEQ(pcd_test.points_, pcd_ascii.points_, 1e-4);
+    ExpectEQ(pcd_test.colors_, pcd_ascii.colors_);
+    std::remove("tmp.ply");
+}
+
+TEST(FilePLY, ReadBinaryFloatPointCloud) {
+    // A fixed size element in front of the vertices, float coordinates,
+    // unused properties and colors that are not in RGB order.
+    const std::string header =
+            "ply\n"
+            "format binary_little_endian 1.0\n"
+            "comment scanner output\n"
+            "element scan 2\n"
+            "property int id\n"
+            "element vertex 3\n"
+            "property uchar blue\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "property float intensity\n"
+            "property uchar green\n"
+            "property uchar red\n"
+            "end_header\n";
+    std::vector<uint8_t> data;
+    AppendBytes<int32_t>(data, 7);
+    AppendBytes<int32_t>(data, 8);
+    for (int i = 0; i < 3; i++) {
+        AppendBytes<uint8_t>(data, uint8_t(10 * i));
+        AppendBytes<float>(data, 0.5f * i);
+        AppendBytes<float>(data, -1.25f * i);
+        AppendBytes<float>(data, 2.0f + i);
+        AppendBytes<float>(data, 100.0f);
+        AppendBytes<uint8_t>(data, uint8_t(20 * i));
+        AppendBytes<uint8_t>(data, 255);
+    }
+    WriteFile("tmp.ply", header, data);
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromPLY("tmp.ply", pcd, false));
+    ExpectEQ(std::vector<Eigen::Vector3d>(
+                     {{0.0, 0.0, 2.0}, {0.5, -1.25, 3.0}, {1.0, -2.5, 4.0}}),
+             pcd.points_);
+    EXPECT_FALSE(pcd.HasNormals());
+    ExpectEQ(std::vector<Eigen::Vector3d>({{255.0, 0.0, 0.0},
+                                           {255.0, 20.0, 10.0},
+                                           {255.0, 40.0, 20.0}}),
+             std::vector<Eigen::Vector3d>({pcd.colors_[0] * 255.0,
+                                           pcd.colors_[1] * 255.0,
+                                           pcd.colors_[2] * 255.0}));
+
+    // Truncated files fail instead of returning partial data.
+    data.resize(data.size() - 1);
+    WriteFile("tmp.ply", header, data);
+    EXPECT_FALSE(io::ReadPointCloudFromPLY("tmp.ply", pcd, false));
+    std::remove("tmp.ply");
+}
+
+TEST(FilePLY, WriteReadBinaryTriangleMesh) {
+    geometry::TriangleMesh mesh_gt;
+    mesh_gt.vertices_.resize(100);
+    mesh_gt.vertex_colors_.resize(100);
+    mesh_gt.triangles_.resize(200);
+    Rand(mesh_gt.vertices_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(1, 1, 1), 0);
+    Rand(mesh_gt.vertex_colors_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(1, 1, 1), 1);
+    Rand(mesh_gt.triangles_, Eigen::Vector3i(0, 0, 0),
+         Eigen::Vector3i(99, 99, 99), 2);
+
+    EXPECT_TRUE(io::WriteTriangleMeshToPLY("tmp.ply", mesh_gt, false, false,
+                                           true, true, true, false));
+    geometry::TriangleMesh mesh_test;
+    EXPECT_TRUE(io::ReadTriangleMeshFromPLY("tmp.ply", mesh_test, false));
+    ExpectEQ(mesh_gt.vertices_, mesh_test.vertices_, 0.0);
+    EXPECT_FALSE(mesh_test.HasVertexNormals());
+    ExpectEQ(QuantizeColors(mesh_gt.vertex_colors_), mesh_test.vertex_colors_,
+             0.0);
+    ExpectEQ(mesh_gt.triangles_, mesh_test.triangles_);
+    std::remove("tmp.ply");
+}
+
+TEST(FilePLY, ReadBinaryPolygonMesh) {
+    // Faces that are not triangles are triangulated by rply.
+    const std::string header =
+            "ply\n"
+            "format binary_little_endian 1.0\n"
+            "element vertex 5\n"
+            "property double x\n"
+            "property double y\n"
+            "property double z\n"
+            "element face 2\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+    std::vector<uint8_t> data;
+    const double vertices[5][3] = {
+            {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {2, 0, 0}};
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 3; j++) {
+            AppendBytes<double>(data, vertices[i][j]);
+        }
+    }
+    AppendBytes<uint8_t>(data, 3);
+    for (int index : {1, 4, 2}) {
+        AppendBytes<int32_t>(data, index);
+    }
+    AppendBytes<uint8_t>(data, 4);
+    for (int index : {0, 1, 2, 3}) {
+        AppendBytes<int32_t>(data, index);
+    }
+    WriteFile("tmp.ply", header, data);
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMeshFromPLY("tmp.ply", mesh, false));
+    EXPECT_EQ(mesh.vertices_.size(), 5u);
+    ASSERT_EQ(mesh.triangles_.size(), 3u);
+    ExpectEQ(Eigen::Vector3i(1, 4, 2), mesh.triangles_[0]);
+    std::remove("tmp.ply");
+}
@@ -24,9 +24,57 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FilePTS, DISABLED_ReadPointCloudFromPTS) { unit_test::NotImplemented(); }
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void WriteText(const std::string &filename, const std::string &text) {
+    FILE *file = fopen(filename.c_str(), "wb");
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+}
+
+}  // unnamed namespace
+
+TEST(FilePTS, ReadPointCloudFromPTS) {
+    // the file has fewer points than the header states
+    WriteText("tmp.pts",
+              "3\r\n"
+              "1 2 3 0 255 0 51\r\n"
+              "bad line\r\n");
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromPTS("tmp.pts", pcd, false));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(1.0, 2.0, 3.0),
+                                          Eigen::Vector3d::Zero(),
+                                          Eigen::Vector3d::Zero()});
+    ExpectEQ(pcd.colors_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(1.0, 0.0, 0.2),
+                                          Eigen::Vector3d::Zero(),
+                                          Eigen::Vector3d::Zero()});
+
+    // points beyond the header count are ignored
+    WriteText("tmp.pts", "1\n4 5 6\n7 8 9\n");
+    EXPECT_TRUE(io::ReadPointCloudFromPTS("tmp.pts", pcd, false));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(4.0, 5.0, 6.0)});
+    EXPECT_FALSE(pcd.HasColors());
+
+    WriteText("tmp.pts", "0\n");
+    EXPECT_FALSE(io::ReadPointCloudFromPTS("tmp.pts", pcd, false));
+    WriteText("tmp.pts", "1\n4 5\n");
+    EXPECT_FALSE(io::ReadPointCloudFromPTS("tmp.pts", pcd, false));
+    std::remove("tmp.pts");
+}
 
 TEST(FilePTS, DISABLED_ResetConsoleProgress) { unit_test::NotImplemented(); }
 
@@ -34,4 +82,30 @@ TEST(FilePTS, DISABLED_SplitString) { unit_test::NotImplemented(); }
 
 TEST(FilePTS, DISABLED_AdvanceConsoleProgress) { unit_test::NotImplemented(); }
 
-TEST(FilePTS, DISABLED_WritePointCloudToPTS) { unit_test::NotImplemented(); }
+TEST(FilePTS, WritePointCloudToPTS) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(70000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    EXPECT_TRUE(io::WritePointCloudToPTS("tmp.pts", pcd_gt));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromPTS("tmp.pts", pcd, false));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 1e-9);
+    EXPECT_FALSE(pcd.HasColors());
+
+    // colors are truncated to integers in [0, 255]
+    std::vector<Eigen::Vector3d> colors(70000);
+    pcd_gt.colors_.resize(70000);
+    for (size_t i = 0; i < colors.size(); i++) {
+        colors[i] = Eigen::Vector3d(i % 256, (i / 256) % 256, 7);
+        pcd_gt.colors_[i] = (colors[i] + Eigen::Vector3d::Constant(0.5)) /
+                            255.0;
+        colors[i] /= 255.0;
+    }
+    EXPECT_TRUE(io::WritePointCloudToPTS("tmp.pts", pcd_gt));
+    EXPECT_TRUE(io::ReadPointCloudFromPTS("tmp.pts", pcd, false));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 1e-9);
+    ExpectEQ(pcd.colors_, colors);
+    std::remove("tmp.pts");
+}
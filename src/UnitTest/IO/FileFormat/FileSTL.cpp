@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
@@ -45,3 +49,71 @@ TEST(FileSTL, WriteReadTriangleMeshFromSTL) {
     ExpectEQ(tm_gt.vertices_, tm_test.vertices_);
     ExpectEQ(tm_gt.triangles_, tm_test.triangles_);
 }
+
+TEST(FileSTL, WriteReadTriangleMeshFromSTLBlocks) {
+    // more triangles than fit into one block, without stored normals
+    geometry::TriangleMesh tm_gt;
+    const int resolution = 400;
+    for (int y = 0; y <= resolution; y++) {
+        for (int x = 0; x <= resolution; x++) {
+            tm_gt.vertices_.push_back(Eigen::Vector3d(x, y, 0.5 * (x % 3)));
+        }
+    }
+    for (int y = 0; y < resolution; y++) {
+        for (int x = 0; x < resolution; x++) {
+            int i = y * (resolution + 1) + x;
+            tm_gt.triangles_.push_back(
+                    Eigen::Vector3i(i, i + 1, i + 2 + resolution));
+            tm_gt.triangles_.push_back(
+                    Eigen::Vector3i(i, i + 2 + resolution, i + 1 + resolution));
+        }
+    }
+    EXPECT_TRUE(io::WriteTriangleMesh("tmp.stl", tm_gt));
+    tm_gt.ComputeTriangleNormals();
+
+    geometry::TriangleMesh tm_test;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.stl", tm_test, false));
+    ASSERT_EQ(tm_test.triangles_.size(), tm_gt.triangles_.size());
+    EXPECT_EQ(tm_test.vertices_.size(), 3 * tm_gt.triangles_.size());
+    ExpectEQ(tm_test.triangle_normals_, tm_gt.triangle_normals_, 1e-6);
+    for (size_t i = 0; i < tm_gt.triangles_.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            ExpectEQ(tm_test.vertices_[tm_test.triangles_[i](j)],
+                     tm_gt.vertices_[tm_gt.triangles_[i](j)]);
+        }
+    }
+
+    // merging the vertices restores the shared vertices
+    EXPECT_TRUE(io::ReadIndexedTriangleMeshFromSTL("tmp.stl", tm_test));
+    EXPECT_EQ(tm_test.vertices_.size(), tm_gt.vertices_.size());
+    ASSERT_EQ(tm_test.triangles_.size(), tm_gt.triangles_.size());
+    for (size_t i = 0; i < tm_gt.triangles_.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            ExpectEQ(tm_test.vertices_[tm_test.triangles_[i](j)],
+                     tm_gt.vertices_[tm_gt.triangles_[i](j)]);
+        }
+    }
+
+    // truncated file
+    {
+        std::vector<char> data(84 + 50 * 10);
+        FILE *file = fopen("tmp.stl", "rb");
+        ASSERT_EQ(fread(data.data(), 1, data.size(), file), data.size());
+        fclose(file);
+        file = fopen("tmp.stl", "wb");
+        fwrite(data.data(), 1, data.size(), file);
+        fclose(file);
+    }
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.stl", tm_test, false));
+
+    // a corrupted triangle count is detected before the mesh is allocated
+    {
+        FILE *file = fopen("tmp.stl", "r+b");
+        fseek(file, 80, SEEK_SET);
+        uint32_t num_of_triangles = 700000000;
+        fwrite(&num_of_triangles, 4, 1, file);
+        fclose(file);
+    }
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.stl", tm_test, false));
+    std::remove("tmp.stl");
+}
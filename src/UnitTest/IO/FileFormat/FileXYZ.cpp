@@ -24,8 +24,71 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <string>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZ, DISABLED_ReadPointCloudFromXYZ) { unit_test::NotImplemented(); }
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void WriteText(const std::string &filename, const std::string &text) {
+    FILE *file = fopen(filename.c_str(), "wb");
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+}
+
+}  // unnamed namespace
+
+TEST(FileXYZ, ReadPointCloudFromXYZ) {
+    // comments, short lines and a final line without line break
+    WriteText("tmp.xyz",
+              "# comment\n"
+              "1.5 -2 3e2\r\n"
+              "\n"
+              "4 5\n"
+              "  -0.25\t1e-3 .5 extra values\n"
+              "7 8 9");
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZ("tmp.xyz", pcd, false));
+    ExpectEQ(pcd.points_, std::vector<Eigen::Vector3d>{
+                                  Eigen::Vector3d(1.5, -2.0, 300.0),
+                                  Eigen::Vector3d(-0.25, 0.001, 0.5),
+                                  Eigen::Vector3d(7.0, 8.0, 9.0)});
+    EXPECT_FALSE(pcd.HasNormals());
+    EXPECT_FALSE(pcd.HasColors());
+
+    WriteText("tmp.xyz", "");
+    EXPECT_TRUE(io::ReadPointCloudFromXYZ("tmp.xyz", pcd, false));
+    EXPECT_TRUE(pcd.IsEmpty());
+    std::remove("tmp.xyz");
+
+    EXPECT_FALSE(io::ReadPointCloudFromXYZ("tmp.xyz", pcd, false));
+}
+
+TEST(FileXYZ, WritePointCloudToXYZ) {
+    // enough points for several chunks when reading and writing
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(100000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-1000.0, -1000.0, -1000.0),
+         Eigen::Vector3d(1000.0, 1000.0, 1000.0), 0);
+    EXPECT_TRUE(io::WritePointCloudToXYZ("tmp.xyz", pcd_gt));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZ("tmp.xyz", pcd, false));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 1e-9);
 
-TEST(FileXYZ, DISABLED_WritePointCloudToXYZ) { unit_test::NotImplemented(); }
+    pcd_gt.points_ = {Eigen::Vector3d(1.0, -0.5, 1e-11)};
+    EXPECT_TRUE(io::WritePointCloudToXYZ("tmp.xyz", pcd_gt));
+    FILE *file = fopen("tmp.xyz", "rb");
+    char text[64] = {0};
+    EXPECT_EQ(fread(text, 1, sizeof(text) - 1, file), 40u);
+    fclose(file);
+    EXPECT_EQ(std::string(text),
+              "1.0000000000 -0.5000000000 0.0000000000\n");
+    std::remove("tmp.xyz");
+}
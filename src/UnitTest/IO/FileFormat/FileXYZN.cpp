@@ -24,8 +24,58 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <string>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZN, DISABLED_ReadPointCloudFromXYZN) { unit_test::NotImplemented(); }
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void WriteText(const std::string &filename, const std::string &text) {
+    FILE *file = fopen(filename.c_str(), "wb");
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+}
+
+}  // unnamed namespace
+
+TEST(FileXYZN, ReadPointCloudFromXYZN) {
+    WriteText("tmp.xyzn",
+              "1 2 3 0 0 1\n"
+              "4 5 6 0 1\n"
+              "7 8 9 1 0 0\n");
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZN("tmp.xyzn", pcd, false));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(1.0, 2.0, 3.0),
+                                          Eigen::Vector3d(7.0, 8.0, 9.0)});
+    ExpectEQ(pcd.normals_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(0.0, 0.0, 1.0),
+                                          Eigen::Vector3d(1.0, 0.0, 0.0)});
+    std::remove("tmp.xyzn");
+}
+
+TEST(FileXYZN, WritePointCloudToXYZN) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(70000);
+    pcd_gt.normals_.resize(70000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pcd_gt.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    EXPECT_TRUE(io::WritePointCloudToXYZN("tmp.xyzn", pcd_gt));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZN("tmp.xyzn", pcd, false));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 1e-9);
+    ExpectEQ(pcd.normals_, pcd_gt.normals_, 1e-9);
+    std::remove("tmp.xyzn");
 
-TEST(FileXYZN, DISABLED_WritePointCloudToXYZN) { unit_test::NotImplemented(); }
\ No newline at end of file
+    pcd_gt.normals_.clear();
+    EXPECT_FALSE(io::WritePointCloudToXYZN("tmp.xyzn", pcd_gt));
+}
\ No newline at end of file
@@ -24,12 +24,58 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <string>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZRGB, DISABLED_ReadPointCloudFromXYZRGB) {
-    unit_test::NotImplemented();
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+void WriteText(const std::string &filename, const std::string &text) {
+    FILE *file = fopen(filename.c_str(), "wb");
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+}
+
+}  // unnamed namespace
+
+TEST(FileXYZRGB, ReadPointCloudFromXYZRGB) {
+    WriteText("tmp.xyzrgb",
+              "1 2 3 0.5 0.25 1\n"
+              "4 5 6 a b c\n"
+              "7 8 9 0 0 0");
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZRGB("tmp.xyzrgb", pcd, false));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(1.0, 2.0, 3.0),
+                                          Eigen::Vector3d(7.0, 8.0, 9.0)});
+    ExpectEQ(pcd.colors_,
+             std::vector<Eigen::Vector3d>{Eigen::Vector3d(0.5, 0.25, 1.0),
+                                          Eigen::Vector3d(0.0, 0.0, 0.0)});
+    std::remove("tmp.xyzrgb");
 }
 
-TEST(FileXYZRGB, DISABLED_WritePointCloudToXYZRGB) {
-    unit_test::NotImplemented();
+TEST(FileXYZRGB, WritePointCloudToXYZRGB) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(70000);
+    pcd_gt.colors_.resize(70000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-10.0, -10.0, -10.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    Rand(pcd_gt.colors_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    EXPECT_TRUE(io::WritePointCloudToXYZRGB("tmp.xyzrgb", pcd_gt));
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloudFromXYZRGB("tmp.xyzrgb", pcd, false));
+    ExpectEQ(pcd.points_, pcd_gt.points_, 1e-9);
+    ExpectEQ(pcd.colors_, pcd_gt.colors_, 1e-9);
+    std::remove("tmp.xyzrgb");
+
+    pcd_gt.colors_.clear();
+    EXPECT_FALSE(io::WritePointCloudToXYZRGB("tmp.xyzrgb", pcd_gt));
 }
\ No newline at end of file
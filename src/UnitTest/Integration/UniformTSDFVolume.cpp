@@ -195,6 +195,44 @@ TEST(UniformTSDFVolume, RealData) {
              /*threshold*/ 0.1);
 }
 
+TEST(UniformTSDFVolume, Raycast) {
+    camera::PinholeCameraIntrinsic intrinsic(80, 60, 60.0, 60.0, 39.5, 29.5);
+    geometry::Image depth;
+    depth.Prepare(80, 60, 1, 4);
+    for (int v = 0; v < 60; v++) {
+        for (int u = 0; u < 80; u++) {
+            *depth.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    integration::UniformTSDFVolume tsdf_volume(
+            2.0, 100, 0.08, integration::TSDFVolumeColorType::NoColor,
+            Eigen::Vector3d(-1.0, -1.0, 0.0));
+    tsdf_volume.Integrate(geometry::RGBDImage(geometry::Image(), depth),
+                          intrinsic, Eigen::Matrix4d::Identity());
+
+    // a wall at z = 1 seen from 10 cm to the left
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic(0, 3) = 0.1;
+    auto raycast = tsdf_volume.Raycast(intrinsic, extrinsic);
+    EXPECT_TRUE(raycast->color_.IsEmpty());
+    int num_hits = 0;
+    for (int v = 0; v < 60; v++) {
+        for (int u = 0; u < 80; u++) {
+            float d = *raycast->depth_.PointerAt<float>(u, v);
+            if (d == 0.0f) {
+                continue;
+            }
+            num_hits++;
+            EXPECT_NEAR(d, 1.0, 0.005);
+            EXPECT_NEAR(*raycast->vertex_map_.PointerAt<float>(u, v, 2), 1.0,
+                        0.005);
+            EXPECT_NEAR(*raycast->normal_map_.PointerAt<float>(u, v, 2), -1.0,
+                        0.01);
+        }
+    }
+    EXPECT_GT(num_hits, 80 * 60 * 3 / 4);
+}
+
 TEST(UniformTSDFVolume, DISABLED_Destructor) {}
 
 TEST(UniformTSDFVolume, DISABLED_MemberData) {}
@@ -24,8 +24,40 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/Odometry/Odometry.h"
+#include "TestUtility/Scene.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+geometry::RGBDImage CreateTexturedRGBDImage(double shift) {
+    geometry::Image color, depth;
+    color.Prepare(64, 48, 1, 4);
+    depth.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; v++) {
+        for (int u = 0; u < 64; u++) {
+            double x = u + shift;
+            *color.PointerAt<float>(u, v) =
+                    float(0.5 + 0.25 * std::sin(0.3 * x) * std::cos(0.2 * v));
+            *depth.PointerAt<float>(u, v) =
+                    float(1.0 + 0.1 * std::sin(0.1 * x + 0.05 * v));
+        }
+    }
+    return geometry::RGBDImage(color, depth);
+}
+
+const Eigen::Vector3d kCornerOffsets(0.6, 0.4, 2.0);
+
+}  // unnamed namespace
+
 TEST(Odometry, DISABLED_ComputeRGBDOdometry) { unit_test::NotImplemented(); }
 
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { unit_test::NotImplemented(); }
@@ -35,3 +67,102 @@ TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
 }
 
 TEST(Odometry, DISABLED_OdometryOption) { unit_test::NotImplemented(); }
+
+TEST(Odometry, ComputeRGBDOdometryFromFrames) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    odometry::OdometryOption option;
+    geometry::RGBDImage source = CreateTexturedRGBDImage(0.0);
+    geometry::RGBDImage target = CreateTexturedRGBDImage(0.5);
+
+    bool is_success;
+    Eigen::Matrix4d trans;
+    Eigen::Matrix6d info;
+    std::tie(is_success, trans, info) = odometry::ComputeRGBDOdometry(
+            source, target, intrinsic, Eigen::Matrix4d::Identity(),
+            odometry::RGBDOdometryJacobianFromHybridTerm(), option);
+    EXPECT_TRUE(is_success);
+
+    odometry::OdometryFrame source_frame(source, intrinsic, option);
+    odometry::OdometryFrame target_frame(target, intrinsic, option);
+    EXPECT_EQ(source_frame.pyramid_.size(), 3u);
+    EXPECT_EQ(source_frame.pyramid_xyz_.size(), 3u);
+    bool is_success_frames;
+    Eigen::Matrix4d trans_frames;
+    Eigen::Matrix6d info_frames;
+    std::tie(is_success_frames, trans_frames, info_frames) =
+            odometry::ComputeRGBDOdometry(source_frame, target_frame);
+    EXPECT_TRUE(is_success_frames);
+    ExpectEQ(trans, trans_frames);
+    ExpectEQ(info, info_frames);
+
+    // frames created with a different number of pyramid levels
+    odometry::OdometryOption option_two_levels({10, 5});
+    EXPECT_FALSE(std::get<0>(odometry::ComputeRGBDOdometry(
+            source_frame, target_frame, Eigen::Matrix4d::Identity(),
+            odometry::RGBDOdometryJacobianFromHybridTerm(),
+            option_two_levels)));
+}
+
+TEST(Odometry, DepthBilateralPreprocessing) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    odometry::OdometryOption option({20, 10, 5}, 0.03, 0.0, 4.0, 1.0, 0.05);
+    geometry::RGBDImage source = CreateTexturedRGBDImage(0.0);
+    geometry::RGBDImage target = CreateTexturedRGBDImage(0.5);
+
+    odometry::OdometryFrame source_frame(source, intrinsic, option);
+    auto depth_ref =
+            source.depth_.FilterBilateral(2, 1.0, 0.05)
+                    ->Filter(geometry::Image::FilterType::Gaussian3);
+    ExpectEQ(depth_ref->data_, source_frame.image_.depth_.data_);
+
+    odometry::OdometryFrame target_frame(target, intrinsic, option);
+    EXPECT_TRUE(std::get<0>(odometry::ComputeRGBDOdometry(
+            source_frame, target_frame, Eigen::Matrix4d::Identity(),
+            odometry::RGBDOdometryJacobianFromHybridTerm(), option)));
+}
+
+TEST(Odometry, RGBDOdometryJacobianFromPointToPlaneTerm) {
+    camera::PinholeCameraIntrinsic intrinsic(320, 240, 250.0, 250.0, 159.5,
+                                             119.5);
+    Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+    pose.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.02, Eigen::Vector3d(0.2, 1.0, 0.1).normalized())
+                    .toRotationMatrix();
+    pose.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, -0.005, 0.02);
+    geometry::RGBDImage source =
+            CreateCornerRGBDImage(intrinsic, pose, kCornerOffsets);
+    geometry::RGBDImage target = CreateCornerRGBDImage(
+            intrinsic, Eigen::Matrix4d::Identity(), kCornerOffsets);
+    // depth only frames
+    source.color_.Clear();
+    target.color_.Clear();
+
+    bool is_success;
+    Eigen::Matrix4d trans;
+    Eigen::Matrix6d info;
+    std::tie(is_success, trans, info) = odometry::ComputeRGBDOdometry(
+            source, target, intrinsic, Eigen::Matrix4d::Identity(),
+            odometry::RGBDOdometryJacobianFromPointToPlaneTerm());
+    EXPECT_TRUE(is_success);
+    ExpectEQ(pose, trans, 1e-3);
+}
+
+TEST(Odometry, RGBDOdometryTracker) {
+    camera::PinholeCameraIntrinsic intrinsic(64, 48, 50.0, 50.0, 31.5, 23.5);
+    odometry::RGBDOdometryTracker tracker(intrinsic);
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+    EXPECT_FALSE(std::get<0>(tracker.Track(CreateTexturedRGBDImage(0.0))));
+    EXPECT_TRUE(tracker.HasPreviousFrame());
+
+    for (int i = 1; i < 3; i++) {
+        auto result = tracker.Track(CreateTexturedRGBDImage(0.5 * i));
+        auto result_ref = odometry::ComputeRGBDOdometry(
+                CreateTexturedRGBDImage(0.5 * (i - 1)),
+                CreateTexturedRGBDImage(0.5 * i), intrinsic);
+        EXPECT_EQ(std::get<0>(result), std::get<0>(result_ref));
+        ExpectEQ(std::get<1>(result), std::get<1>(result_ref));
+    }
+
+    tracker.Reset();
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+}
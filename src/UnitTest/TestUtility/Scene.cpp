@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "UnitTest/TestUtility/Scene.h"
+
+using namespace open3d;
+
+// ----------------------------------------------------------------------------
+// Render a room corner from a camera with the given camera-to-world pose.
+// ----------------------------------------------------------------------------
+geometry::RGBDImage unit_test::CreateCornerRGBDImage(
+        const camera::PinholeCameraIntrinsic& intrinsic,
+        const Eigen::Matrix4d& pose,
+        const Eigen::Vector3d& offsets,
+        std::vector<int>* plane_ids) {
+    const Eigen::Matrix3d& K = intrinsic.intrinsic_matrix_;
+    const Eigen::Matrix3d normals = Eigen::Matrix3d::Identity();
+    geometry::Image depth, color;
+    depth.Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    color.Prepare(intrinsic.width_, intrinsic.height_, 3, 1);
+    if (plane_ids != nullptr) {
+        plane_ids->assign(intrinsic.width_ * intrinsic.height_, -1);
+    }
+    for (int v = 0; v < depth.height_; v++) {
+        for (int u = 0; u < depth.width_; u++) {
+            Eigen::Vector3d ray((u - K(0, 2)) / K(0, 0),
+                                (v - K(1, 2)) / K(1, 1), 1.0);
+            Eigen::Vector3d dir = pose.block<3, 3>(0, 0) * ray;
+            Eigen::Vector3d origin = pose.block<3, 1>(0, 3);
+            double d = 0.0;
+            int id = -1;
+            for (int i = 0; i < 3; i++) {
+                double t = (offsets(i) - normals.col(i).dot(origin)) /
+                           normals.col(i).dot(dir);
+                if (t > 0.0 && (d == 0.0 || t < d)) {
+                    d = t;
+                    id = i;
+                }
+            }
+            *depth.PointerAt<float>(u, v) = float(d);
+            if (id >= 0) {
+                *color.PointerAt<uint8_t>(u, v, id) = 255;
+            }
+            if (plane_ids != nullptr) {
+                (*plane_ids)[v * depth.width_ + u] = id;
+            }
+        }
+    }
+    return geometry::RGBDImage(color, depth);
+}
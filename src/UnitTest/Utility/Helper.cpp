@@ -24,6 +24,120 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Open3D/Utility/Helper.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Helper, DISABLED_SplitString) { unit_test::NotImplemented(); }
+
+TEST(Helper, ParseNumber) {
+    const char *numbers[] = {"0",
+                             "-0",
+                             "+12",
+                             "3.14159",
+                             "-.5",
+                             "7.",
+                             "1e22",
+                             "1.7976931348623157e308",
+                             "4.9406564584124654e-324",
+                             "0.1234567890123456789",
+                             "123456789012345678901234567890",
+                             "0.000000000000000000000000000001",
+                             "-123.456e-7",
+                             "2.2250738585072014E-308",
+                             "0x1p3",
+                             "inf",
+                             "-nan"};
+    for (const char *number : numbers) {
+        std::string text = std::string(" \t") + number + " 1";
+        double value = 0.0;
+        const char *end = utility::ParseNumber(
+                text.data(), text.data() + text.size(), value);
+        EXPECT_EQ(end, text.data() + 2 + strlen(number)) << number;
+        double expected = std::strtod(number, nullptr);
+        if (std::isnan(expected)) {
+            EXPECT_TRUE(std::isnan(value)) << number;
+        } else {
+            EXPECT_EQ(value, expected) << number;
+            EXPECT_EQ(std::signbit(value), std::signbit(expected)) << number;
+        }
+    }
+
+    // the exponent is not consumed without digits, the range is not null
+    // terminated
+    std::string text = "2e 5e-1x";
+    double value = 0.0;
+    const char *end =
+            utility::ParseNumber(text.data(), text.data() + 1, value);
+    EXPECT_EQ(end, text.data() + 1);
+    EXPECT_EQ(value, 2.0);
+    end = utility::ParseNumber(text.data(), text.data() + text.size(), value);
+    EXPECT_EQ(end, text.data() + 1);
+    EXPECT_EQ(utility::ParseNumber(end, text.data() + text.size(), value),
+              end);
+    end = utility::ParseNumber(end + 1, text.data() + text.size(), value);
+    EXPECT_EQ(end, text.data() + 7);
+    EXPECT_EQ(value, 0.5);
+
+    for (const char *invalid : {"", "  ", "-", ".", "e5", "abc"}) {
+        value = 1.0;
+        end = utility::ParseNumber(invalid, invalid + strlen(invalid), value);
+        EXPECT_EQ(end, invalid) << invalid;
+        EXPECT_EQ(value, 1.0);
+    }
+}
+
+TEST(Helper, ParseNumberLocale) {
+    // mantissas above 2^53, e.g. UTM coordinates printed with %.10f, and a
+    // token longer than the stack buffer of the slow path
+    const std::string numbers[] = {
+            "4512345.6789012345", "-500123.12345678901234",
+            "12345678901234567.5", "0x1.8p3",
+            "0." + std::string(80, '3') + "e-3"};
+    std::vector<double> expected;
+    for (const std::string &number : numbers) {
+        expected.push_back(std::strtod(number.c_str(), nullptr));
+    }
+    std::string old_locale = std::setlocale(LC_NUMERIC, nullptr);
+    // the results must not change under locales with a decimal comma, if any
+    // of them is installed
+    const char *locales[] = {"C", "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8",
+                             "German_Germany.1252"};
+    for (const char *locale : locales) {
+        if (std::setlocale(LC_NUMERIC, locale) == nullptr) {
+            continue;
+        }
+        for (size_t i = 0; i < expected.size(); i++) {
+            std::string text = numbers[i] + " 1";
+            double value = 0.0;
+            const char *end = utility::ParseNumber(
+                    text.data(), text.data() + text.size(), value);
+            EXPECT_EQ(end, text.data() + numbers[i].size())
+                    << locale << " " << numbers[i];
+            EXPECT_EQ(value, expected[i]) << locale << " " << numbers[i];
+        }
+    }
+    std::setlocale(LC_NUMERIC, old_locale.c_str());
+}
+
+TEST(Helper, ParseNumbers) {
+    std::string text = "1 -2.5\t3e1 x 5";
+    double values[5];
+    EXPECT_EQ(utility::ParseNumbers(text.data(), text.data() + text.size(),
+                                    values, 5),
+              3u);
+    EXPECT_EQ(values[0], 1.0);
+    EXPECT_EQ(values[1], -2.5);
+    EXPECT_EQ(values[2], 30.0);
+    EXPECT_EQ(utility::ParseNumbers(text.data(), text.data() + text.size(),
+                                    values, 2),
+              2u);
+}
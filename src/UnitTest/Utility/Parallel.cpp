@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "Open3D/Utility/Parallel.h"
+#include "TestUtility/UnitTest.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace open3d;
+using namespace std;
+using namespace unit_test;
+
+TEST(Parallel, ParallelSort) {
+#ifdef _OPENMP
+    // Force multiple blocks, independent of the number of cores.
+    int max_threads = omp_get_max_threads();
+    omp_set_num_threads(5);
+#endif
+    vector<int> values(100000);
+    Rand(values, 0, 1000, 0);
+    vector<int> ref = values;
+    std::sort(ref.begin(), ref.end());
+
+    utility::ParallelSort(values.begin(), values.end());
+    ExpectEQ(ref, values);
+
+    utility::ParallelSort(values.begin(), values.end(), std::greater<int>());
+    std::reverse(ref.begin(), ref.end());
+    ExpectEQ(ref, values);
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+}
+
+TEST(Parallel, PrefetchQueue) {
+    std::function<int(size_t)> load = [](size_t index) {
+        if (index == 7) {
+            throw std::runtime_error("failed");
+        }
+        return int(index * index);
+    };
+    utility::PrefetchQueue<int> queue(2, 10, load, 3, 2);
+    for (size_t i = 2; i < 10; i++) {
+        EXPECT_FALSE(queue.IsEmpty());
+        EXPECT_EQ(i, queue.GetNextIndex());
+        if (i == 7) {
+            EXPECT_THROW(queue.Pop(), std::runtime_error);
+        } else {
+            EXPECT_EQ(int(i * i), queue.Pop());
+        }
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+
+    // Destroying a queue with pending items stops its workers.
+    utility::PrefetchQueue<int> abandoned(0, 1000, load, 4, 8);
+    EXPECT_EQ(0, abandoned.Pop());
+}
+
+TEST(Parallel, TaskQueue) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool release = false;
+    std::vector<std::future<int>> results;
+    {
+        utility::TaskQueue queue(2, 3);
+        for (int i = 0; i < 5; i++) {
+            results.push_back(queue.Push([&, i] {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&] { return release; });
+                if (i == 3) {
+                    throw std::runtime_error("failed");
+                }
+                return i * i;
+            }));
+        }
+        // two tasks are running and three are waiting, so the queue is full
+        EXPECT_EQ(5u, queue.GetNumPending());
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            release = true;
+        }
+        cv.notify_all();
+        queue.Wait();
+        EXPECT_EQ(0u, queue.GetNumPending());
+
+        // Destroying the queue finishes the pushed tasks.
+        for (int i = 5; i < 10; i++) {
+            results.push_back(queue.Push([i] { return i * i; }));
+        }
+    }
+    for (int i = 0; i < 10; i++) {
+        if (i == 3) {
+            EXPECT_THROW(results[i].get(), std::runtime_error);
+        } else {
+            EXPECT_EQ(i * i, results[i].get());
+        }
+    }
+}